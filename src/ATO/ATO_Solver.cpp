@@ -87,6 +87,7 @@ Solver::Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
   m_optimizer->SetCommunicator(comm);
 
   m_writeDesignFrequency = problemParams.get<int>("Design Output Frequency", 0);
+  m_warmStart = problemParams.get<bool>("Warm Start State Solves", false);
 
   // Parse and create objective aggregator
   Teuchos::ParameterList& objAggregatorParams = problemParams.get<Teuchos::ParameterList>("Objective Aggregator");
@@ -498,8 +499,7 @@ void Solver::ComputeObjective(const double* p, double& g, double* dgdp)
     }
 
     // enforce PDE constraints
-    m_subProblems[i].model->evalModel((*m_subProblems[i].params_in),
-                                    (*m_subProblems[i].responses_out));
+    solveSubProblem(m_subProblems[i]);
   }
 
   if ( m_entityType == "Distributed Parameter") {
@@ -534,8 +534,7 @@ void Solver::ComputeObjective(double* p, double& g, double* dgdp)
     }
 
     // enforce PDE constraints
-    m_subProblems[i].model->evalModel((*m_subProblems[i].params_in),
-                                    (*m_subProblems[i].responses_out));
+    solveSubProblem(m_subProblems[i]);
   }
 
   if ( m_entityType == "Distributed Parameter") {
@@ -995,6 +994,47 @@ void Solver::ComputeMeasure(const std::string& measureType, const double* p,
                                 measure, dmdp, integrationMethod);
 }
 
+//**********************************************************************
+void Solver::PrepareMeasure(const std::string& measureType)
+//**********************************************************************
+{
+  m_atoProblem->prepareMeasure(measureType);
+}
+
+//**********************************************************************
+void Solver::EvaluateMeasure(const std::string& measureType, const double* p, 
+                             double& measure)
+//**********************************************************************
+{
+  // filter the topology and communicate boundary topo data
+  const int ntopos = m_topologyInfoStructs.size();
+
+  std::vector<Teuchos::RCP<TopologyStruct> > topologyStructs(ntopos);
+
+  for (int itopo=0; itopo<ntopos; ++itopo) {
+    Teuchos::RCP<TopologyInfoStruct> topoStruct = m_topologyInfoStructs[itopo];
+    Teuchos::RCP<Thyra_Vector> topoVec = topoStruct->localVector;
+    {
+      Teuchos::ArrayRCP<double> ltopo = Albany::getNonconstLocalData(topoVec);
+      const int numLocalNodes = ltopo.size();
+      const int offset = itopo*numLocalNodes;
+      for (int lid=0; lid<numLocalNodes; ++lid) {
+        ltopo[lid] = p[lid+offset];
+      }
+    }
+    smoothTopology(topoStruct);
+
+    Teuchos::RCP<Thyra_Vector> overlapTopoVec = topoStruct->overlapVector;
+    m_cas_manager->scatter(topoVec,overlapTopoVec,Albany::CombineMode::INSERT);
+
+    topologyStructs[itopo] = Teuchos::rcp(new TopologyStruct());
+    topologyStructs[itopo]->topology = topoStruct->topology; 
+    topologyStructs[itopo]->dataVector = overlapTopoVec;
+  }
+
+  m_atoProblem->evaluateMeasure(measureType, topologyStructs, measure);
+}
+
 //**********************************************************************
 void Solver::ComputeVolume(double* p, const double* dfdp, 
                            double& v, double threshhold, double minP)
@@ -1030,8 +1070,7 @@ void Solver::Compute(const double* p, double& g, double* dgdp, double& c, double
     }
 
     // enforce PDE constraints
-    m_subProblems[i].model->evalModel(*m_subProblems[i].params_in,
-                                      *m_subProblems[i].responses_out);
+    solveSubProblem(m_subProblems[i]);
   }
 
   if ( m_entityType == "Distributed Parameter") {
@@ -1053,6 +1092,26 @@ void Solver::Compute(const double* p, double& g, double* dgdp, double& c, double
   m_iteration++;
 }
 
+//**********************************************************************
+void Solver::solveSubProblem(SolverSubSolver& sub)
+//**********************************************************************
+{
+  // Successive designs differ only slightly, so the state of the previous
+  // design is a much better initial guess than the original one. The
+  // solution is the last response of the solver.
+  if (sub.solved) {
+    auto x_nominal = Teuchos::rcp_const_cast<Thyra_Vector>(sub.physics_model->getNominalValues().get_x());
+    if (m_warmStart) {
+      x_nominal->assign(*sub.responses_out->get_g(sub.responses_out->Ng()-1));
+    } else {
+      x_nominal->assign(*sub.x_init);
+    }
+  }
+
+  sub.model->evalModel(*sub.params_in, *sub.responses_out);
+  sub.solved = true;
+}
+
 //**********************************************************************
 int Solver::GetNumOptDofs() const
 //**********************************************************************
@@ -1082,6 +1141,8 @@ Solver::CreateSubSolver (const Teuchos::RCP<Teuchos::ParameterList> appParams,
   //! Create solver factory, which reads xml input filen
   Albany::SolverFactory slvrfctry(appParams, comm);
   ret.model = slvrfctry.createAndGetAlbanyApp(ret.app, comm, comm, initial_guess);
+  ret.physics_model = slvrfctry.returnModel();
+  ret.x_init = ret.physics_model->getNominalValues().get_x()->clone_v();
 
   Teuchos::ParameterList& problemParams = appParams->sublist("Problem");
 
@@ -1417,6 +1478,7 @@ Solver::getValidProblemParameters() const
   validPL->set<int>("Number of Homogenization Problems", 0, "Number of homogenization problems");
   validPL->set<bool>("Verbose Output", false, "Enable detailed output mode");
   validPL->set<int>("Design Output Frequency", 0, "Write isosurface every N iterations");
+  validPL->set<bool>("Warm Start State Solves", false, "Start state solves from the solution of the previous design iteration");
   validPL->set<std::string>("Name", "", "String to designate Problem");
 
   // Specify physics problem(s)
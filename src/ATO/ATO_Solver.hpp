@@ -43,9 +43,17 @@ struct SolverSubSolver {
   Teuchos::RCP<Thyra_InArgs>          params_in;
   Teuchos::RCP<Thyra_OutArgs>         responses_out;
 
+  // The physics model (wrapped by the solver in 'model'), whose nominal
+  // solution is the initial guess of the solve, and a copy of the original one
+  Teuchos::RCP<Thyra_ModelEvaluator>  physics_model;
+  Teuchos::RCP<const Thyra_Vector>    x_init;
+  bool                                solved = false;
+
   void freeUp() {
     app   = Teuchos::null;
     model = Teuchos::null;
+    physics_model = Teuchos::null;
+    x_init = Teuchos::null;
   }
 };
 
@@ -99,6 +107,8 @@ public:
   void ComputeMeasure(const std::string& measureType, const double* p,
                       double& measure, double* dmdp, const std::string& integrationMethod) override;
   void ComputeMeasure(const std::string& measureType, double& measure) override;
+  void PrepareMeasure(const std::string& measureType) override;
+  void EvaluateMeasure(const std::string& measureType, const double* p, double& measure) override;
   int GetNumOptDofs() const override;
 
 private:
@@ -106,6 +116,7 @@ private:
   // data
   int m_iteration;
   int m_writeDesignFrequency;
+  bool m_warmStart;     // start each state solve from the previous design's solution
   int m_numDims;
   int m_num_parameters; // for sensitivity analysis
   int m_num_responses;
@@ -187,6 +198,7 @@ private:
   void copyTopologyIntoParameter(const double* p, SolverSubSolver& sub);
   void copyObjectiveFromStateMgr( double& g, double* dgdp );
   void copyConstraintFromStateMgr( double& c, double* dcdp );
+  void solveSubProblem(SolverSubSolver& sub);
   Teuchos::RCP<const Teuchos::ParameterList> getValidProblemParameters() const;
 
   Teuchos::RCP<Teuchos::ParameterList>
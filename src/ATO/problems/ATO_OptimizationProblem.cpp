@@ -195,6 +195,31 @@ setupTopOpt( Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct> >  _meshSpe
     isNonconformal = configSpec.get<bool>("Nonconformal");
   }
 
+  // Cut cells in conformal integration are re-integrated only if a nodal
+  // topology value changed by more than this.
+  conformalReuseTolerance = 0.0;
+  if(configSpec.isType<double>("Conformal Integration Reuse Tolerance")) {
+    conformalReuseTolerance = configSpec.get<double>("Conformal Integration Reuse Tolerance");
+  }
+
+  // The measure derivative of uncut cells is zero. Off by default, since
+  // existing results were computed with the previous cell's derivative.
+  conformalZeroUncutDerivative = false;
+  if(configSpec.isType<bool>("Conformal Integration Zero Uncut Derivative")) {
+    conformalZeroUncutDerivative = configSpec.get<bool>("Conformal Integration Zero Uncut Derivative");
+  }
+
+  // Recompute every cached cell measure and check that it agrees (debugging aid).
+  verifyConformalReuse = false;
+  if(configSpec.isType<bool>("Verify Conformal Integration Reuse")) {
+    verifyConformalReuse = configSpec.get<bool>("Verify Conformal Integration Reuse");
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION( verifyConformalReuse && conformalReuseTolerance != 0.0,
+                              Teuchos::Exceptions::InvalidParameter, std::endl <<
+                              "Error!  In ATO::OptimizationProblem setup: " << std::endl <<
+                              "'Verify Conformal Integration Reuse' requires a zero " <<
+                              "'Conformal Integration Reuse Tolerance'." << std::endl);
+
   int numPhysSets = meshSpecs.size();
 
   cellTypes.resize(numPhysSets);
@@ -815,6 +840,137 @@ computeMeasure (const std::string& measureType,
 }
 
 
+/******************************************************************************/
+void OptimizationProblem::
+prepareMeasure (const std::string& measureType)
+{
+  const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+        wsElNodeID = disc->getWsElNodeID();
+  int numWorksets = wsElNodeID.size();
+
+  const Albany::WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const Albany::WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+
+  Teuchos::RCP<BlockMeasureMap> measureModel = measureModels.at(measureType);
+  auto indexer = Albany::createGlobalLocalIndexer(overlapNodeVs);
+
+  preparedMeasureType = measureType;
+  measureWorksets.clear();
+  measureNodeLids.clear();
+  measureQPWeights.clear();
+
+  for(int ws=0; ws<numWorksets; ws++){
+
+    // not all blocks are required to have all measures 
+    if(measureModel->find(wsEBNames[ws]) == measureModel->end()) {
+      continue;
+    }
+
+    int physIndex = wsPhysIndex[ws];
+    int numNodes  = basisAtQPs[physIndex].extent(0);
+    int numCells  = weighted_measure[ws].extent(0);
+    int numQPs    = weighted_measure[ws].extent(1);
+
+    // the weights of nonconformal integration change with the design
+    Albany::MDArray savedWeights;
+    if(isNonconformal){
+      Albany::StateArray&
+      stateArrayRef = stateMgr->getStateArray(Albany::StateManager::ELEM, ws);
+      savedWeights = stateArrayRef["Weights"];
+    }
+
+    std::vector<LO> lids(numCells*numNodes);
+    std::vector<double> weights(numCells*numQPs);
+    for(int cell=0; cell<numCells; cell++){
+      for(int node=0; node<numNodes; node++){
+        lids[cell*numNodes+node] = indexer->getLocalElement(wsElNodeID[ws][cell][node]);
+      }
+      for(int qp=0; qp<numQPs; qp++){
+        weights[cell*numQPs+qp] = isNonconformal ? savedWeights(cell,qp)
+                                                 : weighted_measure[ws](cell,qp);
+      }
+    }
+
+    measureWorksets.push_back(ws);
+    measureNodeLids.push_back(std::move(lids));
+    measureQPWeights.push_back(std::move(weights));
+  }
+}
+
+/******************************************************************************/
+void OptimizationProblem::
+evaluateMeasure (const std::string& measureType, 
+                 const std::vector<Teuchos::RCP<TopologyStruct>>& topologyStructs,
+                 double& measure)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION( measureType != preparedMeasureType, std::logic_error, std::endl <<
+    "Error!  In ATO::OptimizationProblem::evaluateMeasure:  Measure '" << measureType <<
+    "' was not prepared.  Call prepareMeasure first." << std::endl);
+
+  const Albany::WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const Albany::WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+
+  std::vector<Teuchos::ArrayRCP<const double>> topoValues(nTopologies);
+  Teuchos::Array<Teuchos::RCP<Topology> > topologies(nTopologies);
+  for(int itopo=0; itopo<nTopologies; itopo++){
+    topologies[itopo] = topologyStructs[itopo]->topology;
+    topoValues[itopo] = Albany::getLocalData(topologyStructs[itopo]->dataVector.getConst());
+  }
+
+  Teuchos::Array<double> pVals(nTopologies);
+  Teuchos::RCP<BlockMeasureMap> measureModel = measureModels.at(measureType);
+
+  double localm = 0.0;
+  int numMeasureWorksets = measureWorksets.size();
+  for(int iws=0; iws<numMeasureWorksets; iws++){
+
+    int ws        = measureWorksets[iws];
+    int physIndex = wsPhysIndex[ws];
+    int numNodes  = basisAtQPs[physIndex].extent(0);
+    int numQPs    = basisAtQPs[physIndex].extent(1);
+    int numCells  = measureQPWeights[iws].size()/numQPs;
+
+    Teuchos::RCP<MeasureModel> blockMeasureModel = measureModel->at(wsEBNames[ws]);
+    const LO* lids = measureNodeLids[iws].data();
+    const double* weights = measureQPWeights[iws].data();
+
+    for(int cell=0; cell<numCells; cell++){
+      for(int qp=0; qp<numQPs; qp++){
+        for(int itopo=0; itopo<nTopologies; itopo++) pVals[itopo]=0.0;
+        for(int node=0; node<numNodes; node++){
+          LO lid = lids[cell*numNodes+node];
+          for(int itopo=0; itopo<nTopologies; itopo++) {
+            pVals[itopo] += topoValues[itopo][lid]*basisAtQPs[physIndex](node,qp);
+          }
+        }
+        localm += blockMeasureModel->Evaluate(pVals, topologies)*weights[cell*numQPs+qp];
+      }
+    }
+  }
+
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &localm, &measure);
+}
+
+/******************************************************************************/
+SubIntegrator& OptimizationProblem::
+getConformalIntegrator (int ws, int physIndex, int topoIndex)
+{
+  // The cell cache holds the cut of one topology, so each topology gets its own.
+  if(topoIndex >= (int)conformalIntegrators.size()) conformalIntegrators.resize(topoIndex+1);
+  std::vector<Teuchos::RCP<SubIntegrator> >& integrators = conformalIntegrators[topoIndex];
+  if(ws >= (int)integrators.size()) integrators.resize(ws+1);
+
+  Teuchos::RCP<SubIntegrator>& integrator = integrators[ws];
+  if(integrator.is_null()){
+    integrator = Teuchos::rcp(new SubIntegrator(cellTypes[physIndex],intrepidBasis[physIndex],
+                                                /*maxRefs=*/1,/*maxErr=*/1e-5));
+    integrator->setReuseTolerance(conformalReuseTolerance);
+    integrator->setVerifyCache(verifyConformalReuse);
+    integrator->setZeroUncutDerivative(conformalZeroUncutDerivative);
+  }
+  return *integrator;
+}
+
 /******************************************************************************/
 void OptimizationProblem::
 computeConformalMeasure (const std::string& measureType, 
@@ -865,8 +1021,6 @@ computeConformalMeasure (const std::string& measureType,
     int numQPs    = weighted_measure[ws].extent(1);
     int numDims   = cubatures[physIndex]->getDimension();
 
-    SubIntegrator myDicer(cellTypes[physIndex],intrepidBasis[physIndex],/*maxRefs=*/1,/*maxErr=*/1e-5);
-
     coordCon = Kokkos::DynRankView<RealType, PHX::Device>("coordCon", numNodes, numDims);
     topoVals = Kokkos::DynRankView<RealType, PHX::Device>("topoVals", numNodes);
     dMdtopo = Kokkos::DynRankView<RealType, PHX::Device>("dMdtopo", numNodes);
@@ -883,6 +1037,8 @@ computeConformalMeasure (const std::string& measureType,
     int materialTopologyIndex = blockMeasureModel->getMaterialTopologyIndex();
     Teuchos::ArrayRCP<const double> p = Albany::getLocalData(topologyStructs[materialTopologyIndex]->dataVector.getConst());
     Teuchos::RCP<Topology> materialTopology = topologyStructs[materialTopologyIndex]->topology;
+
+    SubIntegrator& myDicer = getConformalIntegrator(ws, physIndex, materialTopologyIndex);
       
     for(int cell=0; cell<numCells; cell++){
 
@@ -899,10 +1055,10 @@ computeConformalMeasure (const std::string& measureType,
       double weight=0.0;
       if(dmdp != nullptr ){
         myDicer.getMeasure(weight, topoVals, coordCon, 
-                           materialTopology->getInterfaceValue(), Sense::Positive);
+                           materialTopology->getInterfaceValue(), Sense::Positive, cell);
       } else {
         myDicer.getMeasure(weight, dMdtopo, topoVals, coordCon, 
-                           materialTopology->getInterfaceValue(), Sense::Positive);
+                           materialTopology->getInterfaceValue(), Sense::Positive, cell);
       }
 
       double totalWeight = 0.0;
@@ -1005,7 +1161,7 @@ computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topolog
     int numCells  = weighted_measure[ws].extent(0);
     int numDims   = cubatures[physIndex]->getDimension();
 
-    SubIntegrator myDicer(cellTypes[physIndex],intrepidBasis[physIndex],/*maxRefs=*/1,/*maxErr=*/1e-5);
+    SubIntegrator& myDicer = getConformalIntegrator(ws, physIndex, /*topoIndex=*/0);
 
     coordCon = Kokkos::DynRankView<RealType, PHX::Device>("coordCon", numNodes, numDims);  //inefficient, reallocating memory. 
     topoVals = Kokkos::DynRankView<RealType, PHX::Device>("topoVals", numNodes);   //inefficient, reallocating memory. 
@@ -1023,14 +1179,14 @@ computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topolog
       if( dvdp == nullptr ){
         double weight=0.0;
         myDicer.getMeasure(weight, topoVals, coordCon, 
-                           topology->getInterfaceValue(), Sense::Positive);
+                           topology->getInterfaceValue(), Sense::Positive, cell);
         localv += weight;
 
       } else { 
 
         double weight=0.0;
         myDicer.getMeasure(weight, dMdtopo, topoVals, coordCon, 
-                           topology->getInterfaceValue(), Sense::Positive);
+                           topology->getInterfaceValue(), Sense::Positive, cell);
         localv += weight;
 
         for(int node=0; node<numNodes; node++){
@@ -20,6 +20,7 @@ namespace ATO {
 
 // ATO forward declarations
 class MeasureModel;
+class SubIntegrator;
 class Topology;
 
 using BlockMeasureMap = std::unordered_map<std::string, Teuchos::RCP<MeasureModel>>;
@@ -51,8 +52,18 @@ public:
 
   void ComputeMeasure (const std::string& measure, double& v);
 
+  // Store the node ids and quadrature weights of a measure at the current
+  // design, so that evaluateMeasure only integrates the penalized topology.
+  void prepareMeasure (const std::string& measure);
+
+  void evaluateMeasure (const std::string& measure, 
+                        const std::vector<Teuchos::RCP<TopologyStruct>>& topologyStructs,
+                        double& v);
+
   void setDiscretization(Teuchos::RCP<Albany::AbstractDiscretization> _disc) {
      disc = _disc;
+     conformalIntegrators.clear();
+     preparedMeasureType.clear();
   }
 
   void setCommunicator(const Teuchos::RCP<const Teuchos_Comm>& _comm) {
@@ -67,6 +78,8 @@ protected:
   void setupTopOpt( Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct> >  _meshSpecs,
                     Albany::StateManager& _stateMgr);
 
+  SubIntegrator& getConformalIntegrator(int ws, int physIndex, int topoIndex);
+
   Teuchos::RCP<Albany::AbstractDiscretization> disc;
   Teuchos::RCP<const Teuchos_Comm> comm;
 
@@ -100,6 +113,20 @@ protected:
   int nTopologies;
 
   bool isNonconformal;
+
+  // One per topology and workset, kept across calls so that the cell measures
+  // they cache are reused between design iterations.
+  std::vector<std::vector<Teuchos::RCP<SubIntegrator> > > conformalIntegrators;
+  double conformalReuseTolerance = 0.0;
+  bool verifyConformalReuse = false;
+  bool conformalZeroUncutDerivative = false;
+
+  // Set by prepareMeasure: the worksets that have the measure, with the local
+  // node ids and quadrature weights of their cells.
+  std::string preparedMeasureType;
+  std::vector<int> measureWorksets;
+  std::vector<std::vector<LO> > measureNodeLids;
+  std::vector<std::vector<double> > measureQPWeights;
 };
 
 class MeasureModel
@@ -117,18 +117,36 @@ class SubIntegrator
                 uint maxRefs, RealType maxErr);
   virtual ~SubIntegrator(){};
 
+  // If 'cell' is given (i.e., the index of the cell among the ones this
+  // integrator is used for), results are cached across calls: the measure of
+  // an uncut cell is kept as long as its coordinates don't change, and the
+  // measure of a cut cell is reused if no nodal value changed side and by
+  // more than the reuse tolerance.
   void getMeasure(RealType& measure, 
                   const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
                   RealType zeroVal,
-                  Sense sense);
+                  Sense sense,
+                  int cell = -1);
 
   void getMeasure(RealType& measure, 
                   Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
                   const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
                   RealType zeroVal,
-                  Sense sense);
+                  Sense sense,
+                  int cell = -1);
+
+  void setReuseTolerance(RealType tol){ reuseTolerance = tol; }
+  void clearCache(){ cellCache.clear(); }
+
+  // Debugging aid: also compute every cached result from scratch, and throw
+  // if the two differ. Only meaningful with a zero reuse tolerance.
+  void setVerifyCache(bool verify){ verifyCache = verify; }
+
+  // Set the measure derivative of uncut cells to zero. By default it is left
+  // unchanged, i.e., it keeps the values of the previous cell.
+  void setZeroUncutDerivative(bool zero){ zeroUncutDerivative = zero; }
 
   void getCubature(std::vector<std::vector<RealType> >& refPoints, std::vector<RealType>& weights, 
                    const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
@@ -154,6 +172,56 @@ class SubIntegrator
 
   Teuchos::RCP<shards::CellTopology> cellTopology;
 
+  void evalMeasure(RealType& measure, 
+                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                   const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+                   RealType zeroVal, Sense sense, int cell);
+
+  void evalMeasure(RealType& measure, 
+                   Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
+                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                   const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+                   RealType zeroVal, Sense sense, int cell);
+
+  void verifyCached(int cell, RealType measure, RealType uncachedMeasure,
+                    const Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo,
+                    const Kokkos::DynRankView<RealType, PHX::Device>* uncachedDMdtopo) const;
+
+  enum class CellStatus { Inside, Outside, Cut };
+
+  // Per cell results of previous calls
+  struct CellCache {
+    std::vector<RealType> coords;     // nodal coordinates the entry is valid for
+    bool     hasCellMeasure = false;
+    RealType cellMeasure    = 0.0;    // measure of the whole cell
+
+    bool     hasCut     = false;
+    RealType zeroVal    = 0.0;
+    Sense    sense      = Sense::Positive;
+    std::vector<RealType> topoVals;   // nodal values of the last cut evaluation
+    RealType cutMeasure = 0.0;
+    std::vector<RealType> dMdtopo;    // empty if the derivative wasn't computed
+  };
+
+  bool included(RealType val, RealType zeroVal, Sense sense) const
+  { return sense == Sense::Positive ? val >= zeroVal : val <= zeroVal; }
+
+  CellStatus classify(const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                      RealType zeroVal, Sense sense) const;
+
+  CellCache* getCellCache(int cell, const Kokkos::DynRankView<RealType, PHX::Device>& coordCon);
+
+  RealType getCellMeasure(const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, CellCache* cache);
+
+  const CellCache* findCut(const CellCache* cache,
+                           const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                           RealType zeroVal, Sense sense, bool needDerivative) const;
+
+  void storeCut(CellCache* cache,
+                const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                RealType zeroVal, Sense sense, RealType measure,
+                const Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo);
+
   template <typename V, typename P>
   V Volume(Simplex<V,P>& simplex);
 
@@ -193,6 +261,15 @@ class SubIntegrator
 
   uint maxRefinements;
   RealType maxError;
+
+  // The interpolant of a linear basis is bounded by the nodal values, so cells
+  // can be classified from the nodal values alone.
+  bool linearBasis;
+
+  RealType reuseTolerance;
+  bool verifyCache;
+  bool zeroUncutDerivative;
+  std::vector<CellCache> cellCache;
 };
 
 }
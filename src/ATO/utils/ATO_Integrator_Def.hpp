@@ -8,6 +8,8 @@
 #include <MiniTensor.h>
 #include <Shards_CellTopologyData.h>
 #include <map>
+#include <algorithm>
+#include <Teuchos_TestForException.hpp>
 #include <Intrepid2_HGRAD_TET_C1_FEM.hpp>
 #include <Intrepid2_HGRAD_HEX_C1_FEM.hpp>
 
@@ -58,9 +60,94 @@ void ATO::SubIntegrator::getMeasure(
      RealType& measure, 
      const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
      const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
-     const RealType zeroVal, Sense sense)
+     const RealType zeroVal, Sense sense, int cell)
 //******************************************************************************//
 {
+  evalMeasure(measure, topoVals, coordCon, zeroVal, sense, cell);
+
+  if( verifyCache && cell >= 0 ){
+    RealType uncachedMeasure = 0.0;
+    evalMeasure(uncachedMeasure, topoVals, coordCon, zeroVal, sense, /*cell=*/-1);
+    verifyCached(cell, measure, uncachedMeasure, nullptr, nullptr);
+  }
+}
+//******************************************************************************//
+void ATO::SubIntegrator::getMeasure(
+     RealType& measure, 
+     Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+     const RealType zeroVal, Sense sense, int cell)
+//******************************************************************************//
+{
+  evalMeasure(measure, dMdtopo, topoVals, coordCon, zeroVal, sense, cell);
+
+  if( verifyCache && cell >= 0 ){
+    RealType uncachedMeasure = 0.0;
+    // start from the same values, which uncut cells may leave untouched
+    Kokkos::DynRankView<RealType, PHX::Device> uncachedDMdtopo("dMdtopo", dMdtopo.size());
+    Kokkos::deep_copy(uncachedDMdtopo, dMdtopo);
+    evalMeasure(uncachedMeasure, uncachedDMdtopo, topoVals, coordCon, zeroVal, sense, /*cell=*/-1);
+    verifyCached(cell, measure, uncachedMeasure, &dMdtopo, &uncachedDMdtopo);
+  }
+}
+//******************************************************************************//
+void ATO::SubIntegrator::verifyCached(
+     int cell, RealType measure, RealType uncachedMeasure,
+     const Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo,
+     const Kokkos::DynRankView<RealType, PHX::Device>* uncachedDMdtopo) const
+//******************************************************************************//
+{
+  // With a zero reuse tolerance the cached values are computed from the same
+  // data, so they should agree to round-off.
+  const RealType tol = 1e-12;
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    fabs(measure-uncachedMeasure) > tol*std::max(fabs(measure),fabs(uncachedMeasure)),
+    std::logic_error, "Error! Conformal integration: cached measure " << measure
+    << " of cell " << cell << " differs from the uncached one, " << uncachedMeasure << ".\n");
+
+  if( dMdtopo == nullptr ) return;
+
+  uint nTopoVals = uncachedDMdtopo->size();
+  TEUCHOS_TEST_FOR_EXCEPTION( dMdtopo->size() != nTopoVals, std::logic_error,
+    "Error! Conformal integration: cached measure derivative of cell " << cell
+    << " has the wrong size.\n");
+
+  RealType scale = 0.0;
+  for(uint i=0; i<nTopoVals; i++) scale = std::max(scale, fabs((*uncachedDMdtopo)(i)));
+  for(uint i=0; i<nTopoVals; i++){
+    TEUCHOS_TEST_FOR_EXCEPTION( fabs((*dMdtopo)(i)-(*uncachedDMdtopo)(i)) > tol*scale,
+      std::logic_error, "Error! Conformal integration: cached measure derivative "
+      << (*dMdtopo)(i) << " of cell " << cell << ", node " << i
+      << " differs from the uncached one, " << (*uncachedDMdtopo)(i) << ".\n");
+  }
+}
+//******************************************************************************//
+void ATO::SubIntegrator::evalMeasure(
+     RealType& measure, 
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+     const RealType zeroVal, Sense sense, int cell)
+//******************************************************************************//
+{
+
+  CellCache* cache = getCellCache(cell, coordCon);
+
+  const CellStatus status = classify(topoVals, zeroVal, sense);
+  if( status == CellStatus::Outside ){
+    measure = 0.0;
+    return;
+  } else
+  if( status == CellStatus::Inside ){
+    measure = getCellMeasure(coordCon, cache);
+    return;
+  }
+
+  if( const CellCache* cut = findCut(cache, topoVals, zeroVal, sense, /*needDerivative=*/false) ){
+    measure = cut->cutMeasure;
+    return;
+  }
 
   measure = 0.0;
   RealType volumeChange = 1e6;
@@ -100,22 +187,48 @@ void ATO::SubIntegrator::getMeasure(
       Refine(refinement[level-1], refinement[level]);
     }
   }
+
+  storeCut(cache, topoVals, zeroVal, sense, measure, /*dMdtopo=*/nullptr);
 }
 //******************************************************************************//
-void ATO::SubIntegrator::getMeasure(
+void ATO::SubIntegrator::evalMeasure(
      RealType& measure, 
      Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
      const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
      const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
-     const RealType zeroVal, Sense sense)
+     const RealType zeroVal, Sense sense, int cell)
 //******************************************************************************//
 {
   
+  uint nTopoVals = topoVals.size();
+
+  CellCache* cache = getCellCache(cell, coordCon);
+
+  // The measure of an uncut cell doesn't depend on the nodal values. Unless
+  // asked to zero it, dMdtopo is left as is, as the integration always did.
+  const CellStatus status = classify(topoVals, zeroVal, sense);
+  if( status != CellStatus::Cut ){
+    if( zeroUncutDerivative ){
+      if( dMdtopo.size() != nTopoVals )
+        dMdtopo = Kokkos::DynRankView<RealType, PHX::Device>("dMdtopo", nTopoVals);
+      for(uint i=0; i<nTopoVals; i++) dMdtopo(i) = 0.0;
+    }
+    measure = (status == CellStatus::Inside) ? getCellMeasure(coordCon, cache) : 0.0;
+    return;
+  }
+
+  if( const CellCache* cut = findCut(cache, topoVals, zeroVal, sense, /*needDerivative=*/true) ){
+    if( dMdtopo.size() != nTopoVals )
+      dMdtopo = Kokkos::DynRankView<RealType, PHX::Device>("dMdtopo", nTopoVals);
+    for(uint i=0; i<nTopoVals; i++) dMdtopo(i) = cut->dMdtopo[i];
+    measure = cut->cutMeasure;
+    return;
+  }
+
   measure = 0.0;
   DFadType volumeChange = 1e6;
   DFadType tolerance(maxError);
 
-  uint nTopoVals = topoVals.size();
   DFadType Mfad;
   Kokkos::DynRankView<DFadType, PHX::Device> Tfad("Tfad", nTopoVals, nTopoVals);
   Kokkos::DynRankView<RealType, PHX::Device> Tval("Tval", nTopoVals);
@@ -167,6 +280,120 @@ void ATO::SubIntegrator::getMeasure(
     }
   }
 
+  if( dMdtopo.size() == nTopoVals )
+    storeCut(cache, topoVals, zeroVal, sense, measure, &dMdtopo);
+}
+
+//******************************************************************************//
+ATO::SubIntegrator::CellStatus
+ATO::SubIntegrator::classify(
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const RealType zeroVal, Sense sense) const
+//******************************************************************************//
+{
+  if( !linearBasis ) return CellStatus::Cut;
+
+  uint nTopoVals = topoVals.size();
+  uint nIncluded = 0;
+  for(uint i=0; i<nTopoVals; i++)
+    if( included(topoVals(i), zeroVal, sense) ) nIncluded++;
+
+  if( nIncluded == nTopoVals ) return CellStatus::Inside;
+  if( nIncluded == 0 ) return CellStatus::Outside;
+  return CellStatus::Cut;
+}
+
+//******************************************************************************//
+ATO::SubIntegrator::CellCache*
+ATO::SubIntegrator::getCellCache(
+     int cell, const Kokkos::DynRankView<RealType, PHX::Device>& coordCon)
+//******************************************************************************//
+{
+  if( cell < 0 ) return nullptr;
+
+  if( cell >= (int)cellCache.size() ) cellCache.resize(cell+1);
+  CellCache& cache = cellCache[cell];
+
+  // if the cell moved, nothing computed for it before is valid
+  int nCoords = coordCon.size();
+  bool sameCoords = ((int)cache.coords.size() == nCoords);
+  for(int i=0; i<nCoords && sameCoords; i++)
+    sameCoords = (cache.coords[i] == coordCon.data()[i]);
+
+  if( !sameCoords ){
+    cache = CellCache();
+    cache.coords.assign(coordCon.data(), coordCon.data()+nCoords);
+  }
+  return &cache;
+}
+
+//******************************************************************************//
+RealType ATO::SubIntegrator::getCellMeasure(
+     const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+     CellCache* cache)
+//******************************************************************************//
+{
+  if( cache != nullptr && cache->hasCellMeasure ) return cache->cellMeasure;
+
+  RealType cellMeasure = 0.0;
+  typename std::vector<Simplex<RealType,RealType> >::iterator it;
+  for(it=refinement[0].begin(); it!=refinement[0].end(); it++){
+     cellMeasure += Volume(*it, coordCon);
+  }
+
+  if( cache != nullptr ){
+    cache->hasCellMeasure = true;
+    cache->cellMeasure = cellMeasure;
+  }
+  return cellMeasure;
+}
+
+//******************************************************************************//
+const ATO::SubIntegrator::CellCache*
+ATO::SubIntegrator::findCut(
+     const CellCache* cache,
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const RealType zeroVal, Sense sense, bool needDerivative) const
+//******************************************************************************//
+{
+  if( cache == nullptr || !cache->hasCut ) return nullptr;
+  if( cache->zeroVal != zeroVal || cache->sense != sense ) return nullptr;
+  if( needDerivative && cache->dMdtopo.empty() ) return nullptr;
+
+  uint nTopoVals = topoVals.size();
+  if( cache->topoVals.size() != nTopoVals ) return nullptr;
+
+  for(uint i=0; i<nTopoVals; i++){
+    RealType oldVal = cache->topoVals[i];
+    if( included(topoVals(i), zeroVal, sense) != included(oldVal, zeroVal, sense) ) return nullptr;
+    if( fabs(topoVals(i) - oldVal) > reuseTolerance ) return nullptr;
+  }
+  return cache;
+}
+
+//******************************************************************************//
+void ATO::SubIntegrator::storeCut(
+     CellCache* cache,
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const RealType zeroVal, Sense sense, RealType measure,
+     const Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo)
+//******************************************************************************//
+{
+  if( cache == nullptr ) return;
+
+  uint nTopoVals = topoVals.size();
+  cache->hasCut = true;
+  cache->zeroVal = zeroVal;
+  cache->sense = sense;
+  cache->cutMeasure = measure;
+  cache->topoVals.resize(nTopoVals);
+  for(uint i=0; i<nTopoVals; i++) cache->topoVals[i] = topoVals(i);
+
+  cache->dMdtopo.clear();
+  if( dMdtopo != nullptr ){
+    cache->dMdtopo.resize(nTopoVals);
+    for(uint i=0; i<nTopoVals; i++) cache->dMdtopo[i] = (*dMdtopo)(i);
+  }
 }
 //******************************************************************************//
 template<typename V, typename P>
@@ -1030,12 +1257,17 @@ uint _maxRefs, RealType _maxErr):
    cellTopology(_celltype),
    basis(_basis),
    maxRefinements(_maxRefs),
-   maxError(_maxErr)
+   maxError(_maxErr),
+   reuseTolerance(0.0),
+   verifyCache(false),
+   zeroUncutDerivative(false)
 //******************************************************************************//
 {
 
   refinement.resize(1);
 
+  linearBasis = (basis->getDegree() == 1);
+
   nDims = cellTopology->getDimension();
   parentCoords = Kokkos::DynRankView<RealType, PHX::Device>("parentCoords", basis->getCardinality(),nDims);  //inefficient, reallocating memory. 
   _basis->getDofCoords(parentCoords);
@@ -34,6 +34,11 @@ public:
     ComputeMeasure(measureType, p, measure, dmdp, "Gauss Quadrature");
   }
 
+  // Precompute the quadrature data of a measure at the current design, then
+  // evaluate it at designs p with only local work and one all-reduce.
+  virtual void PrepareMeasure(const std::string& measureType) = 0;
+  virtual void EvaluateMeasure(const std::string& measureType, const double* p, double& measure) = 0;
+
   virtual void InitializeOptDofs(double* p) = 0;
   virtual void getOptDofsLowerBound (Teuchos::Array<double>& b) const = 0;
   virtual void getOptDofsUpperBound (Teuchos::Array<double>& b) const = 0;
@@ -96,6 +96,7 @@ Optimizer(optimizerParams)
   dfdp = nullptr;
   dgdp = nullptr;
   dmdp = nullptr;
+  _measureWeightsValid = false;
 
   _moveLimit     = optimizerParams.get<double>("Move Limiter");
   _stabExponent  = optimizerParams.get<double>("Stabilization Parameter");
@@ -128,6 +129,14 @@ Optimizer(optimizerParams)
     } else {
       _useNewtonSearch = true;
     }
+    if (measureParams.isType<bool>("Precompute Measure Weights") ) {
+      _precomputeMeasureWeights = measureParams.get<bool>("Precompute Measure Weights");
+    } else {
+      _precomputeMeasureWeights = false;
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(_precomputeMeasureWeights && _measureIntMethod != "Gauss Quadrature",
+                               Teuchos::Exceptions::InvalidParameter,
+                               "Error! 'Precompute Measure Weights' requires the 'Gauss Quadrature' integration method.\n");
   } else {
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
                                "Error! Missing 'Measure Enforcement' ParameterList.\n");
@@ -319,6 +328,7 @@ Optimizer_OC::Initialize()
   for (int i=0; i<numOptDofs; i++) {
     p_last[i] = p[i];
   }
+  _measureWeightsValid = false;
   solverInterface->ComputeMeasure(_measureType, p, measure, dmdp);
 
   computeUpdatedTopology();
@@ -449,6 +459,7 @@ Optimizer_OC::Optimize()
     for (int i=0; i<numOptDofs; i++) {
       p_last[i] = p[i];
     }
+    _measureWeightsValid = false;
   
     if (g != 0.0) {
       // if the constraint condition isn't satisfied, modify the measure budget.
@@ -725,6 +736,12 @@ void
 Optimizer_OC::computeUpdatedTopology()
 /******************************************************************************/
 {
+  // The quadrature weights only change with the design (nonconformal
+  // integration), so they are stored once per design iteration.
+  if (_precomputeMeasureWeights && !_measureWeightsValid) {
+    solverInterface->PrepareMeasure(_measureType);
+    _measureWeightsValid = true;
+  }
 
   // find multiplier that enforces measure constraint
   Teuchos::Array<double> upperBound, lowerBound;
@@ -781,7 +798,7 @@ Optimizer_OC::computeUpdatedTopology()
     // compute new measure
     if (_useNewtonSearch) {
       double prevResidual = measure - _measureConstraint*_optMeasure;
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      measure = evaluateMeasure();
       double newResidual = measure - _measureConstraint*_optMeasure;
       if (newResidual > 0.0) {
         residRatio = newResidual/prevResidual;
@@ -792,7 +809,7 @@ Optimizer_OC::computeUpdatedTopology()
         v2 = vmid;
       }
     } else {
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      measure = evaluateMeasure();
       double newResidual = measure - _measureConstraint*_optMeasure;
       if (newResidual > 0.0) {
         v1 = vmid;
@@ -837,7 +854,7 @@ Optimizer_OC::computeUpdatedTopology()
         p[i] = p_new;
       }
       // compute new measure
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      measure = evaluateMeasure();
       double f0 =  (measure - _measureConstraint*_optMeasure);
 
       if (comm->getRank()==0) {
@@ -870,7 +887,7 @@ Optimizer_OC::computeUpdatedTopology()
         p[i] = p_new;
       }
       // compute new measure
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      measure = evaluateMeasure();
       double f1 =  (measure - _measureConstraint*_optMeasure);
 
       if (f1-f0 == 0.0 ) break;
@@ -912,7 +929,7 @@ Optimizer_OC::computeUpdatedTopology()
         }
     
         // compute new measure
-        solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+        measure = evaluateMeasure();
         double newResidual = measure - _measureConstraint*_optMeasure;
         if (newResidual > 0.0) {
           v1 = vmid;
@@ -928,11 +945,35 @@ Optimizer_OC::computeUpdatedTopology()
     }
   }
 
+  // verify the measure of the final topology with the full integration
+  if (_precomputeMeasureWeights) {
+    double evaluatedMeasure = measure;
+    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+    TEUCHOS_TEST_FOR_EXCEPTION(( fabs(measure - evaluatedMeasure) > 1.0e-10*_optMeasure ),
+                               std::logic_error,
+                               "Measure enforcement: Measure from precomputed weights (" << evaluatedMeasure
+                               << ") differs from the computed measure (" << measure << ").\n");
+  }
+
   TEUCHOS_TEST_FOR_EXCEPTION(( fabs(measure - _measureConstraint*_optMeasure) > _measureAccpTol*_optMeasure ),
                              Teuchos::Exceptions::InvalidParameter, 
                              "Enforcement of measure constraint failed:  Exceeded max iterations.\n"); 
 }
 
+/******************************************************************************/
+double
+Optimizer_OC::evaluateMeasure()
+/******************************************************************************/
+{
+  double measure = 0.0;
+  if (_precomputeMeasureWeights) {
+    solverInterface->EvaluateMeasure(_measureType, p, measure);
+  } else {
+    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+  }
+  return measure;
+}
+
 #ifdef ATO_USES_NLOPT
 /******************************************************************************/
 void
@@ -66,6 +66,7 @@ class Optimizer_OC : public Optimizer {
   void Initialize();
  protected:
   void computeUpdatedTopology();
+  double evaluateMeasure();
 
   double* p;
   double* p_last;
@@ -95,6 +96,8 @@ class Optimizer_OC : public Optimizer {
   double _maxMeasure;
   double _optMeasure;
   bool   _useNewtonSearch;
+  bool   _precomputeMeasureWeights;
+  bool   _measureWeightsValid;
 
 };
 
@@ -12,6 +12,9 @@
 
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_TpetraThyraUtils.hpp"
+#include "Aeras_HydrostaticProblem.hpp"
+#include "Teuchos_Time.hpp"
+#include "Teuchos_CommHelpers.hpp"
 
 //uncomment the following to write stuff out to matrix market to debug
 //#define WRITE_TO_MATRIX_MARKET_TO_MM_FILE
@@ -49,6 +52,9 @@ Teuchos::RCP<Thyra_LinearOp> getOnlyNonzeros (const Teuchos::RCP<Thyra_LinearOp>
   using Teuchos::Array;
   using Teuchos::ArrayView;
 
+  TEUCHOS_TEST_FOR_EXCEPTION(Albany::getBlockSize(A_op)>1, std::logic_error,
+      "Error! The assembled hyperviscosity operator must be a Tpetra_CrsMatrix, "
+      "which is incompatible with 'Point Block Jacobian'.\n");
   auto A = Albany::getTpetraMatrix(A_op);
 
   TEUCHOS_ASSERT(A->hasColMap());
@@ -94,9 +100,35 @@ HVDecorator(const Teuchos::RCP<Albany::Application>& app_,
   std::cout << "In HVDecorator app name: " << app->getProblemPL()->get("Name", "") << std::endl;
 #endif
 
+  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+  Teuchos::Time setupTimer("HVDecorator setup");
+  setupTimer.start();
+
+  const Teuchos::RCP<Aeras::HydrostaticProblem> hsProblem =
+    Teuchos::rcp_dynamic_cast<Aeras::HydrostaticProblem>(app->getProblem());
+  if (hsProblem != Teuchos::null)
+    hv_op_ = hsProblem->getHyperviscosityOperator();
+
+  // The assembled Laplace operator is filtered and applied as a Tpetra_CrsMatrix.
+  // Check this before assembling it.
+  TEUCHOS_TEST_FOR_EXCEPTION(hv_op_ == Teuchos::null &&
+      appParams->sublist("Discretization").get<bool>("Point Block Jacobian", false),
+      std::logic_error,
+      "Error! 'Point Block Jacobian' is not supported with the assembled explicit "
+      "hyperviscosity operator. Turn it off, or set 'Matrix-Free Hyperviscosity' "
+      "in the problem list.\n");
+
   // Create and store mass and Laplacian operators (in CrsMatrix form). 
   Teuchos::RCP<Thyra_LinearOp> mass = createOperatorDiag(1.0, 0.0, 0.0);
-  Teuchos::RCP<Thyra_LinearOp> laplace = createOperator(0.0, 0.0, 1.0);
+  Teuchos::RCP<Thyra_LinearOp> laplace;
+  if (hv_op_ == Teuchos::null) {
+    laplace = createOperator(0.0, 0.0, 1.0);
+  } else {
+    // The Laplace fill records the element operators in hv_op_ instead of
+    // assembling them, so the (diagonal) W operator is enough here.
+    createOperatorDiag(0.0, 0.0, 1.0);
+    hv_op_->setup(app->getDiscretization());
+  }
 
   Teuchos::RCP<const Thyra_VectorSpace> mass_vs = mass->range(); 
 
@@ -109,9 +141,36 @@ HVDecorator(const Teuchos::RCP<Albany::Application>& app_,
   wrk_ = Thyra::createMember(mass_vs);
   // 3. Remove the structural zeros, numerical zeros, from the Laplace
   // operator.
-  laplace_ = getOnlyNonzeros(laplace);
+  if (hv_op_ == Teuchos::null)
+    laplace_ = getOnlyNonzeros(laplace);
   xtilde = Thyra::createMember(mass_vs);
 
+  setupTimer.stop();
+
+  // Report the storage used by the Laplace operator, summed over all ranks,
+  // when a verbosity above the default has been requested.
+  if (this->getVerbLevel() >= Teuchos::VERB_MEDIUM) {
+    std::size_t laplaceBytes = 0;
+    if (hv_op_ == Teuchos::null) {
+      const LO numRows = Albany::getLocalSubdim(laplace_->range());
+      for (LO row=0; row<numRows; ++row)
+        laplaceBytes += Albany::getNumEntriesInLocalRow(laplace_, row)*(sizeof(ST)+sizeof(LO));
+      laplaceBytes += (numRows+1)*sizeof(std::size_t);
+    } else {
+      laplaceBytes = hv_op_->storageBytes();
+    }
+    const Teuchos::RCP<const Teuchos_Comm> comm = app->getComm();
+    double localBytes = static_cast<double>(laplaceBytes);
+    double totalBytes = 0.0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &localBytes, &totalBytes);
+    if (comm->getRank() == 0) {
+      *out << "HVDecorator: "
+           << (hv_op_ == Teuchos::null ? "assembled" : "matrix-free")
+           << " Laplace operator, " << totalBytes << " bytes, setup time "
+           << setupTimer.totalElapsedTime() << " s" << std::endl;
+    }
+  }
+
 //OG In case of a parallel run by some reason laplace.mm file contains indices
 //out of range with non-trivial entries. I haven't debugged this yet. AB suggested to
 //compare the product L*x (L is the Laplace, x is an arbitrary vector)
@@ -175,6 +234,13 @@ applyLinvML(Teuchos::RCP<const Thyra_Vector> x_in, Teuchos::RCP<Thyra_Vector> x_
   std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
 #endif
 
+  if (hv_op_ != Teuchos::null) {
+    hv_op_->apply(*x_in, *wrk_);
+    Thyra::ele_wise_scale(*inv_mass_diag_, wrk_.ptr());
+    hv_op_->apply(*wrk_, *x_out);
+    return;
+  }
+
   // x_out = laplace_ * x_in
   laplace_->apply(Thyra::NOTRANS, *x_in, wrk_.ptr(), 1.0, 0.0);
 
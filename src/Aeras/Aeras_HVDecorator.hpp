@@ -14,6 +14,8 @@
 
 #include "Thyra_ModelEvaluatorDefaultBase.hpp"
 
+#include "Aeras_HyperviscosityOperator.hpp"
+
 namespace Aeras {
 
 ///
@@ -47,6 +49,9 @@ private:
 
   //Mass and Laplace operators
   Teuchos::RCP<Thyra_LinearOp> laplace_; 
+  //Element-by-element Laplace operator, used instead of laplace_ with
+  //"Matrix-Free Hyperviscosity"
+  Teuchos::RCP<HyperviscosityOperator> hv_op_;
   Teuchos::RCP<Thyra_Vector>   inv_mass_diag_, wrk_;
   Teuchos::RCP<Thyra_Vector>   xtilde; 
 };
@@ -21,6 +21,7 @@
 #include "Albany_DiscretizationUtils.hpp"
 
 #include "Aeras_Layouts.hpp"
+#include "Aeras_HyperviscosityOperator.hpp"
 
 namespace Aeras {
 /** \brief Gathers Coordinates values from the Newton coordinates vector into 
@@ -76,6 +77,10 @@ protected:
 protected:
   double sqrtHVcoef;
 
+  //! If set, the hyperviscosity Laplacian is recorded element by element
+  //! here instead of being summed into the Jacobian
+  Teuchos::RCP<HyperviscosityOperator> hvOperator;
+
 };
 
 template<typename EvalT, typename Traits> class ComputeAndScatterJac;
@@ -128,6 +133,12 @@ public:
 private:
   Kokkos::DynRankView<LO, PHX::Device> colT;
 
+  // Matrix-free hyperviscosity: the Laplace kernel records the element
+  // operators here (one row per cell) instead of scattering them
+  bool recordHV;
+  Kokkos::View<RealType**, PHX::Device> hvVelocity;
+  Kokkos::View<RealType**, PHX::Device> hvScalar;
+
 #endif // ALBANY_KOKKOS_UNDER_DEVELOPMENT
 };
 
@@ -65,6 +65,9 @@ ComputeAndScatterJacBase(const Teuchos::ParameterList& p,
   double HVcoef = p.get<double>("HV coefficient");
   sqrtHVcoef = std::sqrt(HVcoef);
 
+  if (p.isParameter("Hyperviscosity Operator"))
+    hvOperator = p.get<Teuchos::RCP<HyperviscosityOperator> >("Hyperviscosity Operator");
+
 }
 
 // **********************************************************************
@@ -215,6 +218,17 @@ operator() (const ComputeAndScatterJac_buildLaplace_Tag<numn>& tag, const int& c
     }
   }
 
+  //Matrix-free hyperviscosity: keep the element operators and skip the scatter.
+  if (recordHV) {
+    for (int ii = 0; ii < 2*numn; ii++)
+      for (int jj = 0; jj < 2*numn; jj++)
+        hvVelocity(cell, ii*2*numn+jj) = this->sqrtHVcoef * KTGRKK[ii][jj];
+    for (int no = 0; no < numn; no++)
+      for (int mo = 0; mo < numn; mo++)
+        hvScalar(cell, no*numn+mo) = this->sqrtHVcoef * GR[no*3][mo*3];
+    return;
+  }
+
   LO row;
   int col;
   for (int node = 0; node < this->numNodes; ++node) {
@@ -431,6 +445,11 @@ evaluateFields(typename Traits::EvalData workset)
     Kokkos::DynRankView<RealType, PHX::Device>  L("KK", numn*2, numn*2);
     Kokkos::DynRankView<RealType, PHX::Device>  GRKK("KK", numn*3,numn*2); 
     Kokkos::DynRankView<RealType, PHX::Device>  KTGRKK("KK", numn*2,numn*2); 
+    if (this->hvOperator != Teuchos::null) {
+      this->hvOperator->setLayout(numn, this->numDims, this->numLevels, this->numNodeVar,
+                                  this->numVectorLevelVar, this->numScalarLevelVar, this->numTracerVar);
+      this->hvOperator->resizeWorkset(workset.wsIndex, workset.numCells);
+    }
     for (int cell=0; cell < workset.numCells; ++cell ) {
       const int neq = nodeID.extent(2);
       col.resize(neq * this->numNodes);
@@ -497,6 +516,19 @@ evaluateFields(typename Traits::EvalData workset)
           for(int cc = 0; cc < 3*numn; cc++)
             KTGRKK(ii,jj) += KK(cc,ii)*GRKK(cc,jj);
 
+      //Matrix-free hyperviscosity: keep the element operators and skip the scatter.
+      if (this->hvOperator != Teuchos::null) {
+        double* V = this->hvOperator->velocityBlock(workset.wsIndex, cell);
+        double* S = this->hvOperator->scalarBlock(workset.wsIndex, cell);
+        for (int ii = 0; ii < 2*numn; ii++)
+          for (int jj = 0; jj < 2*numn; jj++)
+            V[ii*2*numn+jj] = this->sqrtHVcoef * KTGRKK(ii,jj);
+        for (int no = 0; no < numn; no++)
+          for (int mo = 0; mo < numn; mo++)
+            S[no*numn+mo] = this->sqrtHVcoef * GR(no*3,mo*3);
+        continue;
+      }
+
       for (int node = 0; node < this->numNodes; ++node) {
         int n = 0, eq = 0;
         //dealing with surf pressure
@@ -610,10 +642,17 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
   bool buildLaplace = ( workset.j_coeff == 0.0 )&&( workset.m_coeff == 0.0 )&&( workset.n_coeff == 1.0 );
+  recordHV = buildLaplace && (this->hvOperator != Teuchos::null);
   if ( buildLaplace ) {
     // Temporary data structure
     colT = Kokkos::DynRankView<LO, PHX::Device>("col", workset.numCells, neq*this->numNodes);
 
+    if (recordHV) {
+      const int numn = this->numNodes;
+      hvVelocity = Kokkos::View<RealType**, PHX::Device>("hvVelocity", workset.numCells, 4*numn*numn);
+      hvScalar   = Kokkos::View<RealType**, PHX::Device>("hvScalar", workset.numCells, numn*numn);
+    }
+
     // numNodes must be known at compile time in order to construct static arrays inside kernel
     switch (this->numNodes) {
       case 9: {
@@ -652,6 +691,25 @@ evaluateFields(typename Traits::EvalData workset)
         break;
       }
     }
+
+    // Hand the recorded element operators over to the (host) operator
+    if (recordHV) {
+      const int numn = this->numNodes;
+      this->hvOperator->setLayout(numn, this->numDims, this->numLevels, this->numNodeVar,
+                                  this->numVectorLevelVar, this->numScalarLevelVar, this->numTracerVar);
+      this->hvOperator->resizeWorkset(workset.wsIndex, workset.numCells);
+
+      auto hvVelocity_h = Kokkos::create_mirror_view(hvVelocity);
+      auto hvScalar_h   = Kokkos::create_mirror_view(hvScalar);
+      Kokkos::deep_copy(hvVelocity_h, hvVelocity);
+      Kokkos::deep_copy(hvScalar_h, hvScalar);
+      for (int cell = 0; cell < workset.numCells; ++cell) {
+        double* V = this->hvOperator->velocityBlock(workset.wsIndex, cell);
+        double* S = this->hvOperator->scalarBlock(workset.wsIndex, cell);
+        for (int k = 0; k < 4*numn*numn; ++k) V[k] = hvVelocity_h(cell,k);
+        for (int k = 0; k < numn*numn; ++k)   S[k] = hvScalar_h(cell,k);
+      }
+    }
   }
 
 #endif // ALBANY_KOKKOS_UNDER_DEVELOPMENT
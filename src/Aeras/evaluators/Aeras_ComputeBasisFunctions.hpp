@@ -18,6 +18,7 @@
 #include "PHAL_Dimension.hpp"
 #include "PHAL_Utilities.hpp"
 #include "Aeras_Layouts.hpp"
+#include "Aeras_TensorProductBasis.hpp"
 
 namespace Albany { class StateManager; }
 
@@ -66,6 +67,9 @@ private:
   Kokkos::DynRankView<RealType, PHX::Device>    refPoints;
   Kokkos::DynRankView<RealType, PHX::Device>    refWeights;
 
+  //! Sum-factorized phi/dphi on collocated spectral elements
+  TensorProductBasis tensorBasis;
+
   // Output:
   //! Basis Functions at quadrature points
   PHX::MDField<MeshScalarT,Cell,QuadPoint> weighted_measure;
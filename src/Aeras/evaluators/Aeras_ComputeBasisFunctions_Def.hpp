@@ -97,6 +97,7 @@ postRegistrationSetup(typename Traits::SetupData d,
   intrepidBasis->getValues(val_at_cub_points,  refPoints, Intrepid2::OPERATOR_VALUE);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
   intrepidBasis->getValues(D2_at_cub_points,   refPoints, Intrepid2::OPERATOR_D2);
+  tensorBasis.setup(val_at_cub_points, grad_at_cub_points, refPoints, numNodes, numQPs);
 
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   val_at_cub_points_CUDA=Kokkos::View<RealType**, PHX::Device>("val_at_cub_points_CUDA", numNodes, numQPs);
@@ -443,6 +444,23 @@ evaluateFields(typename Traits::EvalData workset)
               jacobian(e,q,b1,b2) = 0;
       
 
+      if (tensorBasis.isActive()) {
+        // Collocated tensor-product basis: phi is the nodal coordinate and
+        // dphi is the 1D derivative matrix applied along each direction.
+        const int n = tensorBasis.order();
+        for (int i = 0; i<n;            ++i)
+          for (int j = 0; j<n;          ++j) {
+            const int q = tensorBasis.qp(i,j);
+            for (int d = 0; d<spatialDim; ++d) {
+              phi(q,d) = coordVec(e,tensorBasis.node(i,j),d);
+              for (int a = 0; a<n;      ++a)
+                dphi(q,d,0) += tensorBasis.D(i,a) * coordVec(e,tensorBasis.node(a,j),d);
+              for (int b = 0; b<n;      ++b)
+                dphi(q,d,1) += tensorBasis.D(j,b) * coordVec(e,tensorBasis.node(i,b),d);
+            }
+          }
+      }
+      else {
       for (int q = 0; q<numQPs;         ++q) 
         for (int d = 0; d<spatialDim;   ++d) 
           for (int v = 0; v<numNodes;  ++v)
@@ -453,6 +471,7 @@ evaluateFields(typename Traits::EvalData workset)
           for (int d = 0; d<spatialDim; ++d) 
             for (int b = 0; b<basisDim; ++b) 
               dphi(q,d,b) += coordVec(e,v,d) * grad_at_cub_points(v,q,b);
+      }
   
       for (int q = 0; q<numQPs;         ++q) 
         for (int d = 0; d<spatialDim;   ++d) 
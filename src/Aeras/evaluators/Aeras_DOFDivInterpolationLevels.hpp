@@ -16,6 +16,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductBasis.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -67,6 +68,9 @@ private:
   Kokkos::DynRankView<RealType, PHX::Device>    grad_at_cub_points;
   Kokkos::DynRankView<ScalarT, PHX::Device>     vcontra;
 
+  //! Sum-factorized kernel on collocated spectral elements
+  TensorProductBasis tensorBasis;
+
   const int numNodes;
   const int numDims;
   const int numQPs;
@@ -68,6 +68,10 @@ postRegistrationSetup(typename Traits::SetupData d,
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
+  Kokkos::DynRankView<RealType, PHX::Device> val_at_cub_points("XXX", numNodes, numQPs);
+  intrepidBasis->getValues(val_at_cub_points, refPoints, Intrepid2::OPERATOR_VALUE);
+  tensorBasis.setup(val_at_cub_points, grad_at_cub_points, refPoints, numNodes, numQPs);
+
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   vcontra = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, 2);
 #endif
@@ -145,6 +149,38 @@ evaluateFields(typename Traits::EvalData workset)
     }
   }//end of original div
 
+  else if (tensorBasis.isActive()) {
+    // Collocated tensor-product basis: the reference divergence of the
+    // contravariant field is D applied along xi plus D applied along eta.
+    const int n = tensorBasis.order();
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int level=0; level < numLevels; ++level) {
+        for (int node=0; node < numNodes; ++node) {
+          const MeshScalarT jinv00 = jacobian_inv(cell, node, 0, 0);
+          const MeshScalarT jinv01 = jacobian_inv(cell, node, 0, 1);
+          const MeshScalarT jinv10 = jacobian_inv(cell, node, 1, 0);
+          const MeshScalarT jinv11 = jacobian_inv(cell, node, 1, 1);
+          const MeshScalarT det_j  = jacobian_det(cell,node);
+
+          vcontra(node, 0 ) = det_j*(jinv00*val_node(cell, node, level, 0) + jinv01*val_node(cell, node, level, 1) );
+          vcontra(node, 1 ) = det_j*(jinv10*val_node(cell, node, level, 0) + jinv11*val_node(cell, node, level, 1) );
+        }
+
+        for (int i=0; i < n; ++i) {
+          for (int j=0; j < n; ++j) {
+            const int qp = tensorBasis.qp(i,j);
+            ScalarT div = 0.0;
+            for (int a=0; a < n; ++a)
+              div += tensorBasis.D(i,a)*vcontra(tensorBasis.node(a,j), 0);
+            for (int b=0; b < n; ++b)
+              div += tensorBasis.D(j,b)*vcontra(tensorBasis.node(i,b), 1);
+            div_val_qp(cell, qp, level) = div/jacobian_det(cell,qp);
+          }
+        }
+      }
+    }
+  }//end of sum-factorized div
+
   else {
     //rather slow, needs revision
     for (int cell=0; cell < workset.numCells; ++cell) {
@@ -14,6 +14,10 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductBasis.hpp"
+
+#include "Intrepid2_Basis.hpp"
+#include "Intrepid2_Cubature.hpp"
 
 namespace Aeras {
 /** \brief Finite Element Interpolation Evaluator
@@ -21,6 +25,11 @@ namespace Aeras {
     This evaluator interpolates nodal DOF values to their
     gradients at quad points.
 
+    If the "Intrepid2 Basis" and "Cubature" are supplied and describe a
+    collocated tensor-product (spectral) basis, the gradient is evaluated
+    by sum factorization: the physical map at each quad point is read
+    back from GradBF and applied to 1D reference derivatives.
+
 */
 
 template<typename EvalT, typename Traits>
@@ -57,6 +66,11 @@ private:
   const int numQPs;
   const int numLevels;
 
+  //! Optional, enables the sum-factorized kernel on collocated spectral elements
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
+  TensorProductBasis tensorBasis;
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
@@ -106,6 +120,11 @@ private:
   const int numQPs;
   const int numLevels;
 
+  //! Optional, enables the sum-factorized kernel on collocated spectral elements
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature;
+  TensorProductBasis tensorBasis;
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
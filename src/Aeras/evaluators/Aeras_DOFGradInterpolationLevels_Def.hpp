@@ -29,6 +29,11 @@ DOFGradInterpolationLevels(Teuchos::ParameterList& p,
   this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
+  if (p.isParameter("Intrepid2 Basis") && p.isParameter("Cubature")) {
+    intrepidBasis = p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis");
+    cubature      = p.get<Teuchos::RCP <Intrepid2::Cubature<PHX::Device> > >("Cubature");
+  }
+
   this->setName("Aeras::DOFGradInterpolationLevels"+PHX::print<EvalT>());
 
   //std::cout << "Aeras::DOFGradInterpolationLevels: " << numDims << " " << numQPs << " " << numLevels << std::endl;
@@ -43,6 +48,17 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(val_node,fm);
   this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
+
+  if (intrepidBasis != Teuchos::null && intrepidBasis->getBaseCellTopology().getDimension() == 2) {
+    Kokkos::DynRankView<RealType, PHX::Device> refPoints("XXX", numQPs, 2);
+    Kokkos::DynRankView<RealType, PHX::Device> refWeights("XXX", numQPs);
+    Kokkos::DynRankView<RealType, PHX::Device> val_at_cub_points("XXX", numNodes, numQPs);
+    Kokkos::DynRankView<RealType, PHX::Device> grad_at_cub_points("XXX", numNodes, numQPs, 2);
+    cubature->getCubature(refPoints, refWeights);
+    intrepidBasis->getValues(val_at_cub_points, refPoints, Intrepid2::OPERATOR_VALUE);
+    intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
+    tensorBasis.setup(val_at_cub_points, grad_at_cub_points, refPoints, numNodes, numQPs);
+  }
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
 }
 
@@ -103,6 +119,37 @@ evaluateFields(typename Traits::EvalData workset)
   }
   */
 
+  if (tensorBasis.isActive()) {
+    // GradBF(node,qp,:) = M_qp * (reference gradient of node at qp); for a
+    // node on the same eta line the reference gradient is (D(i,a), 0), so
+    // each column of M_qp is one GradBF entry divided by a D entry.
+    const int n = tensorBasis.order();
+    std::vector<MeshScalarT> map_xi(numDims), map_eta(numDims);
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int i=0; i < n; ++i) {
+        for (int j=0; j < n; ++j) {
+          const int qp = tensorBasis.qp(i,j);
+          const int ip = tensorBasis.partner(i);
+          const int jp = tensorBasis.partner(j);
+          for (int dim=0; dim<numDims; dim++) {
+            map_xi[dim]  = GradBF(cell, tensorBasis.node(ip,j), qp, dim) / tensorBasis.D(i,ip);
+            map_eta[dim] = GradBF(cell, tensorBasis.node(i,jp), qp, dim) / tensorBasis.D(j,jp);
+          }
+          for (int level=0; level < numLevels; ++level) {
+            ScalarT dxi = 0.0, deta = 0.0;
+            for (int a=0; a < n; ++a)
+              dxi  += tensorBasis.D(i,a) * val_node(cell, tensorBasis.node(a,j), level);
+            for (int b=0; b < n; ++b)
+              deta += tensorBasis.D(j,b) * val_node(cell, tensorBasis.node(i,b), level);
+            for (int dim=0; dim<numDims; dim++)
+              grad_val_qp(cell,qp,level,dim) = map_xi[dim]*dxi + map_eta[dim]*deta;
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
       for (int level=0; level < numLevels; ++level) {
@@ -148,6 +195,11 @@ DOFGradInterpolationLevels_noDeriv(Teuchos::ParameterList& p,
   this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
+  if (p.isParameter("Intrepid2 Basis") && p.isParameter("Cubature")) {
+    intrepidBasis = p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis");
+    cubature      = p.get<Teuchos::RCP <Intrepid2::Cubature<PHX::Device> > >("Cubature");
+  }
+
   this->setName("Aeras::DOFGradInterpolationLevels_noDeriv"+PHX::print<EvalT>());
 }
 
@@ -160,6 +212,17 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(val_node,fm);
   this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
+
+  if (intrepidBasis != Teuchos::null && intrepidBasis->getBaseCellTopology().getDimension() == 2) {
+    Kokkos::DynRankView<RealType, PHX::Device> refPoints("XXX", numQPs, 2);
+    Kokkos::DynRankView<RealType, PHX::Device> refWeights("XXX", numQPs);
+    Kokkos::DynRankView<RealType, PHX::Device> val_at_cub_points("XXX", numNodes, numQPs);
+    Kokkos::DynRankView<RealType, PHX::Device> grad_at_cub_points("XXX", numNodes, numQPs, 2);
+    cubature->getCubature(refPoints, refWeights);
+    intrepidBasis->getValues(val_at_cub_points, refPoints, Intrepid2::OPERATOR_VALUE);
+    intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
+    tensorBasis.setup(val_at_cub_points, grad_at_cub_points, refPoints, numNodes, numQPs);
+  }
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
 }
 
@@ -194,6 +257,35 @@ evaluateFields(typename Traits::EvalData workset)
   // for (int i=0; i < grad_val_qp.size() ; i++) grad_val_qp[i] = 0.0;
   // Intrepid2::FunctionSpaceTools:: evaluate<ScalarT>(grad_val_qp, val_node, GradBF);
 
+  if (tensorBasis.isActive()) {
+    // Same factorization as DOFGradInterpolationLevels.
+    const int n = tensorBasis.order();
+    std::vector<MeshScalarT> map_xi(numDims), map_eta(numDims);
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int i=0; i < n; ++i) {
+        for (int j=0; j < n; ++j) {
+          const int qp = tensorBasis.qp(i,j);
+          const int ip = tensorBasis.partner(i);
+          const int jp = tensorBasis.partner(j);
+          for (int dim=0; dim<numDims; dim++) {
+            map_xi[dim]  = GradBF(cell, tensorBasis.node(ip,j), qp, dim) / tensorBasis.D(i,ip);
+            map_eta[dim] = GradBF(cell, tensorBasis.node(i,jp), qp, dim) / tensorBasis.D(j,jp);
+          }
+          for (int level=0; level < numLevels; ++level) {
+            MeshScalarT dxi = 0.0, deta = 0.0;
+            for (int a=0; a < n; ++a)
+              dxi  += tensorBasis.D(i,a) * val_node(cell, tensorBasis.node(a,j), level);
+            for (int b=0; b < n; ++b)
+              deta += tensorBasis.D(j,b) * val_node(cell, tensorBasis.node(i,b), level);
+            for (int dim=0; dim<numDims; dim++)
+              grad_val_qp(cell,qp,level,dim) = map_xi[dim]*dxi + map_eta[dim]*deta;
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
       for (int level=0; level < numLevels; ++level) {
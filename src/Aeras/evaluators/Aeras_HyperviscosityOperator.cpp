@@ -0,0 +1,141 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Aeras_HyperviscosityOperator.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace Aeras
+{
+
+HyperviscosityOperator::HyperviscosityOperator()
+ : num_nodes_(0), num_dims_(0), num_levels_(0),
+   num_node_var_(0), num_vector_level_var_(0),
+   num_scalar_level_var_(0), num_tracer_var_(0),
+   vel_size_(0), scl_size_(0)
+{
+}
+
+void HyperviscosityOperator::
+setLayout(const int numNodes, const int numDims, const int numLevels,
+          const int numNodeVar, const int numVectorLevelVar,
+          const int numScalarLevelVar, const int numTracerVar)
+{
+  num_nodes_            = numNodes;
+  num_dims_             = numDims;
+  num_levels_           = numLevels;
+  num_node_var_         = numNodeVar;
+  num_vector_level_var_ = numVectorLevelVar;
+  num_scalar_level_var_ = numScalarLevelVar;
+  num_tracer_var_       = numTracerVar;
+  vel_size_ = 4*numNodes*numNodes;
+  scl_size_ = numNodes*numNodes;
+}
+
+void HyperviscosityOperator::
+resizeWorkset(const int ws, const int numCells)
+{
+  if (ws >= static_cast<int>(velocity_.size())) {
+    velocity_.resize(ws+1);
+    scalar_.resize(ws+1);
+  }
+  velocity_[ws].assign(numCells*vel_size_, 0.0);
+  scalar_[ws].assign(numCells*scl_size_, 0.0);
+}
+
+void HyperviscosityOperator::
+setup(const Teuchos::RCP<const Albany::AbstractDiscretization>& disc)
+{
+  const int numWorksets = disc->getWsElNodeEqID().size();
+  TEUCHOS_TEST_FOR_EXCEPTION(static_cast<int>(velocity_.size()) != numWorksets,
+      std::logic_error,
+      "Aeras::HyperviscosityOperator: element operators were recorded for "
+      << velocity_.size() << " worksets, the discretization has " << numWorksets << ".\n");
+
+  disc_ = disc;
+  cas_manager_ = Albany::createCombineAndScatterManager(disc->getVectorSpace(),
+                                                        disc->getOverlapVectorSpace());
+  overlapped_x_ = Thyra::createMember(disc->getOverlapVectorSpace());
+  overlapped_y_ = Thyra::createMember(disc->getOverlapVectorSpace());
+}
+
+void HyperviscosityOperator::
+apply(const Thyra_Vector& x, Thyra_Vector& y) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(disc_.is_null(), std::logic_error,
+      "Aeras::HyperviscosityOperator::apply called before setup.\n");
+
+  cas_manager_->scatter(x, *overlapped_x_, Albany::CombineMode::INSERT);
+  overlapped_y_->assign(0.0);
+
+  const auto xv = Albany::getLocalData(*overlapped_x_);
+  const auto yv = Albany::getNonconstLocalData(*overlapped_y_);
+
+  const auto& wsElNodeEqID = disc_->getWsElNodeEqID();
+  const int numn = num_nodes_;
+
+  // Same DOF walk as ComputeAndScatterJac: nodal variables carry no
+  // hyperviscosity, then per level the vector and scalar variables, then
+  // per level the tracers.
+  for (int ws = 0; ws < static_cast<int>(wsElNodeEqID.size()); ++ws) {
+    const auto& nodeID = wsElNodeEqID[ws];
+    const int numCells = nodeID.extent(0);
+    for (int cell = 0; cell < numCells; ++cell) {
+      const double* V = &velocity_[ws][cell*vel_size_];
+      const double* S = &scalar_[ws][cell*scl_size_];
+
+      int n = num_node_var_;
+      for (int level = 0; level < num_levels_; ++level) {
+        for (int j = 0; j < num_vector_level_var_; ++j, n += num_dims_) {
+          for (int node = 0; node < numn; ++node) {
+            for (int c = 0; c < 2; ++c) {
+              const double* row = V + (2*node+c)*2*numn;
+              double val = 0.0;
+              for (int m = 0; m < numn; ++m)
+                val += row[2*m]   * xv[nodeID(cell,m,n)]
+                    +  row[2*m+1] * xv[nodeID(cell,m,n+1)];
+              yv[nodeID(cell,node,n+c)] += val;
+            }
+          }
+        }
+        for (int j = 0; j < num_scalar_level_var_; ++j, ++n) {
+          for (int node = 0; node < numn; ++node) {
+            const double* row = S + node*numn;
+            double val = 0.0;
+            for (int m = 0; m < numn; ++m)
+              val += row[m] * xv[nodeID(cell,m,n)];
+            yv[nodeID(cell,node,n)] += val;
+          }
+        }
+      }
+      for (int level = 0; level < num_levels_; ++level) {
+        for (int j = 0; j < num_tracer_var_; ++j, ++n) {
+          for (int node = 0; node < numn; ++node) {
+            const double* row = S + node*numn;
+            double val = 0.0;
+            for (int m = 0; m < numn; ++m)
+              val += row[m] * xv[nodeID(cell,m,n)];
+            yv[nodeID(cell,node,n)] += val;
+          }
+        }
+      }
+    }
+  }
+
+  y.assign(0.0);
+  cas_manager_->combine(*overlapped_y_, y, Albany::CombineMode::ADD);
+}
+
+std::size_t HyperviscosityOperator::
+storageBytes() const
+{
+  std::size_t bytes = 0;
+  for (std::size_t ws = 0; ws < velocity_.size(); ++ws)
+    bytes += (velocity_[ws].size() + scalar_[ws].size())*sizeof(double);
+  return bytes;
+}
+
+} // namespace Aeras
@@ -0,0 +1,83 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_HYPERVISCOSITY_OPERATOR_HPP
+#define AERAS_HYPERVISCOSITY_OPERATOR_HPP
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+namespace Aeras {
+
+///
+/// \brief Matrix-free hyperviscosity Laplacian
+///
+/// Holds, for every cell, the dense element operators that
+/// ComputeAndScatterJac would otherwise sum into the implicit Jacobian:
+/// a (2 numNodes)x(2 numNodes) block coupling the two horizontal velocity
+/// components of a level, and a numNodes x numNodes block used for
+/// temperature and tracers. Both already include sqrt(tau).
+///
+/// apply() computes y = L x element by element from the overlapped x,
+/// so neither the implicit Jacobian graph nor the assembled Laplacian
+/// has to be allocated. Dirichlet rows are not modified, which matches
+/// the sphere problems this is used for (they have no Dirichlet BCs).
+///
+class HyperviscosityOperator {
+
+public:
+
+  HyperviscosityOperator();
+
+  //! DOF layout of a node; must match the ordering in ComputeAndScatterJac
+  void setLayout(const int numNodes, const int numDims, const int numLevels,
+                 const int numNodeVar, const int numVectorLevelVar,
+                 const int numScalarLevelVar, const int numTracerVar);
+
+  //! Make room for the cells of a workset before recording into it
+  void resizeWorkset(const int ws, const int numCells);
+
+  //! Row-major block, row/col index 2*node+component
+  double* velocityBlock(const int ws, const int cell) {
+    return &velocity_[ws][cell*vel_size_];
+  }
+
+  //! Row-major block, row/col index node
+  double* scalarBlock(const int ws, const int cell) {
+    return &scalar_[ws][cell*scl_size_];
+  }
+
+  //! Bind to the discretization once the element operators are recorded
+  void setup(const Teuchos::RCP<const Albany::AbstractDiscretization>& disc);
+
+  //! y = L x, with x and y in the owned vector space
+  void apply(const Thyra_Vector& x, Thyra_Vector& y) const;
+
+  //! Bytes held by the element operators
+  std::size_t storageBytes() const;
+
+private:
+
+  int num_nodes_, num_dims_, num_levels_;
+  int num_node_var_, num_vector_level_var_, num_scalar_level_var_, num_tracer_var_;
+  int vel_size_, scl_size_;
+
+  std::vector<std::vector<double> > velocity_;
+  std::vector<std::vector<double> > scalar_;
+
+  Teuchos::RCP<const Albany::AbstractDiscretization> disc_;
+  Teuchos::RCP<const Albany::CombineAndScatterManager> cas_manager_;
+  Teuchos::RCP<Thyra_Vector> overlapped_x_, overlapped_y_;
+};
+
+} // namespace Aeras
+
+#endif // AERAS_HYPERVISCOSITY_OPERATOR_HPP
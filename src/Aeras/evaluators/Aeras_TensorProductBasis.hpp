@@ -0,0 +1,165 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_TENSOR_PRODUCT_BASIS_HPP
+#define AERAS_TENSOR_PRODUCT_BASIS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Albany_ScalarOrdinalTypes.hpp"
+
+namespace Aeras {
+
+/** \brief Tensor-product structure of a collocated spectral quad basis
+
+    Aeras::SpectralDiscretization builds Gauss-Lobatto-Legendre elements
+    whose nodes coincide with the quadrature points.  The basis is then
+    l_a(xi) l_b(eta), its value matrix is the identity and its reference
+    gradient factors into the 1D differentiation matrix D(i,a) = l_a'(xi_i):
+
+      du/dxi  (xi_i, eta_j) = sum_a D(i,a) u(a,j)
+      du/deta (xi_i, eta_j) = sum_b D(j,b) u(i,b)
+
+    which costs O(n^3) per element instead of the O(n^4) dense
+    node-by-quadrature-point contraction (n = points per direction).
+
+    setup() inspects the values and gradients returned by the Intrepid2
+    basis and only activates when this structure is present to round-off;
+    otherwise isActive() is false and callers keep the dense kernels.
+*/
+class TensorProductBasis {
+
+public:
+
+  TensorProductBasis() : n1d(0) {}
+
+  template<typename ValView, typename GradView, typename PointView>
+  bool setup(const ValView& val, const GradView& grad, const PointView& refPoints,
+             const int numNodes, const int numQPs);
+
+  bool isActive() const { return n1d > 0; }
+
+  //! Points per direction
+  int order() const { return n1d; }
+
+  //! Quadrature point located at (xi_i, eta_j)
+  int qp(const int i, const int j) const { return qpIndex[i*n1d+j]; }
+
+  //! Node whose basis function is l_a(xi) l_b(eta)
+  int node(const int a, const int b) const { return nodeIndex[a*n1d+b]; }
+
+  //! 1D differentiation matrix, D(i,a) = l_a'(xi_i)
+  RealType D(const int i, const int a) const { return Dmat[i*n1d+a]; }
+
+  //! Off-diagonal column with the largest |D(i,a)|, used to recover the
+  //! physical map at a quadrature point from a precomputed GradBF field.
+  int partner(const int i) const { return partnerIndex[i]; }
+
+private:
+
+  int n1d;
+  std::vector<int>      qpIndex;
+  std::vector<int>      nodeIndex;
+  std::vector<int>      partnerIndex;
+  std::vector<RealType> Dmat;
+};
+
+//**********************************************************************
+template<typename ValView, typename GradView, typename PointView>
+bool TensorProductBasis::
+setup(const ValView& val, const GradView& grad, const PointView& refPoints,
+      const int numNodes, const int numQPs)
+{
+  n1d = 0;
+  if (numNodes != numQPs || numQPs < 4) return false;
+
+  // Distinct 1D abscissas along xi; a tensor grid has the same set along eta.
+  std::vector<RealType> x;
+  for (int q=0; q<numQPs; ++q) x.push_back(refPoints(q,0));
+  std::sort(x.begin(), x.end());
+  const RealType ptol = 1.0e-10*std::max(RealType(1.0), std::abs(x.back()-x.front()));
+  std::vector<RealType> x1d(1, x[0]);
+  for (std::size_t k=1; k<x.size(); ++k)
+    if (x[k]-x1d.back() > ptol) x1d.push_back(x[k]);
+  const int n = x1d.size();
+  if (n*n != numQPs) return false;
+
+  const auto locate = [&](const RealType y) {
+    const auto it = std::lower_bound(x1d.begin(), x1d.end(), y-ptol);
+    if (it == x1d.end() || std::abs(*it-y) > ptol) return -1;
+    return static_cast<int>(it-x1d.begin());
+  };
+
+  std::vector<int> qps(n*n, -1), nodes(n*n, -1);
+  for (int q=0; q<numQPs; ++q) {
+    const int i = locate(refPoints(q,0));
+    const int j = locate(refPoints(q,1));
+    if (i < 0 || j < 0 || qps[i*n+j] >= 0) return false;
+    qps[i*n+j] = q;
+  }
+
+  // Collocation: every basis function is one at exactly one point, zero elsewhere.
+  const RealType vtol = 1.0e-10;
+  for (int v=0; v<numNodes; ++v) {
+    int at = -1;
+    for (int q=0; q<numQPs; ++q) {
+      const RealType phi = val(v,q);
+      if (std::abs(phi-1.0) < vtol) {
+        if (at >= 0) return false;
+        at = q;
+      }
+      else if (std::abs(phi) > vtol) return false;
+    }
+    if (at < 0) return false;
+    const int i = locate(refPoints(at,0));
+    const int j = locate(refPoints(at,1));
+    if (nodes[i*n+j] >= 0) return false;
+    nodes[i*n+j] = v;
+  }
+
+  std::vector<RealType> Dm(n*n);
+  RealType dmax = 0.0;
+  for (int i=0; i<n; ++i)
+    for (int a=0; a<n; ++a) {
+      Dm[i*n+a] = grad(nodes[a*n+0], qps[i*n+0], 0);
+      dmax = std::max(dmax, std::abs(Dm[i*n+a]));
+    }
+
+  // The full gradient table must factor exactly through D.
+  const RealType gtol = 1.0e-8*std::max(RealType(1.0), dmax);
+  for (int a=0; a<n; ++a)
+    for (int b=0; b<n; ++b)
+      for (int i=0; i<n; ++i)
+        for (int j=0; j<n; ++j) {
+          const int v = nodes[a*n+b], q = qps[i*n+j];
+          const RealType gxi  = (b == j) ? Dm[i*n+a] : 0.0;
+          const RealType geta = (a == i) ? Dm[j*n+b] : 0.0;
+          if (std::abs(grad(v,q,0)-gxi)  > gtol) return false;
+          if (std::abs(grad(v,q,1)-geta) > gtol) return false;
+        }
+
+  std::vector<int> partners(n);
+  for (int i=0; i<n; ++i) {
+    int best = (i == 0) ? 1 : 0;
+    for (int a=0; a<n; ++a)
+      if (a != i && std::abs(Dm[i*n+a]) > std::abs(Dm[i*n+best])) best = a;
+    if (std::abs(Dm[i*n+best]) <= gtol) return false;
+    partners[i] = best;
+  }
+
+  qpIndex.swap(qps);
+  nodeIndex.swap(nodes);
+  partnerIndex.swap(partners);
+  Dmat.swap(Dm);
+  n1d = n;
+  return true;
+}
+
+}
+
+#endif
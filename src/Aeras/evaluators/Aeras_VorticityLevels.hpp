@@ -14,6 +14,7 @@
 
 #include "Aeras_Layouts.hpp"
 #include "Aeras_Dimension.hpp"
+#include "Aeras_TensorProductBasis.hpp"
 
 #include "Intrepid2_Basis.hpp"
 #include "Intrepid2_Cubature.hpp"
@@ -66,6 +67,9 @@ private:
   Kokkos::DynRankView<RealType, PHX::Device>    grad_at_cub_points;
   Kokkos::DynRankView<ScalarT, PHX::Device>     vco;
 
+  //! Sum-factorized kernel on collocated spectral elements
+  TensorProductBasis tensorBasis;
+
   const int numNodes;
   const int numDims;
   const int numQPs;
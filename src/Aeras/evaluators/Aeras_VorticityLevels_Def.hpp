@@ -59,6 +59,10 @@ postRegistrationSetup(typename Traits::SetupData d,
   cubature->getCubature(refPoints, refWeights);
   intrepidBasis->getValues(grad_at_cub_points, refPoints, Intrepid2::OPERATOR_GRAD);
 
+  Kokkos::DynRankView<RealType, PHX::Device> val_at_cub_points("XXX", numNodes, numQPs);
+  intrepidBasis->getValues(val_at_cub_points, refPoints, Intrepid2::OPERATOR_VALUE);
+  tensorBasis.setup(val_at_cub_points, grad_at_cub_points, refPoints, numNodes, numQPs);
+
   vco = Kokkos::createDynRankView(val_node.get_view(), "XXX", numNodes, 2);
   d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
 }
@@ -132,6 +136,37 @@ evaluateFields(typename Traits::EvalData workset)
     }
   }
 #else
+  if (tensorBasis.isActive()) {
+    // Collocated tensor-product basis: apply the 1D derivative matrix
+    // along each direction instead of the full grad_at_cub_points table.
+    const int n = tensorBasis.order();
+    for (int cell=0; cell < workset.numCells; ++cell) {
+      for (int level=0; level < numLevels; ++level) {
+        for (int node=0; node < numNodes; ++node) {
+          const MeshScalarT j00 = jacobian(cell, node, 0, 0);
+          const MeshScalarT j01 = jacobian(cell, node, 0, 1);
+          const MeshScalarT j10 = jacobian(cell, node, 1, 0);
+          const MeshScalarT j11 = jacobian(cell, node, 1, 1);
+
+          vco(node, 0 ) = j00*val_node(cell, node, level, 0) + j10*val_node(cell, node, level, 1);
+          vco(node, 1 ) = j01*val_node(cell, node, level, 0) + j11*val_node(cell, node, level, 1);
+        }
+
+        for (int i=0; i < n; ++i) {
+          for (int j=0; j < n; ++j) {
+            const int qp = tensorBasis.qp(i,j);
+            ScalarT tmp = 0.0;
+            for (int a=0; a < n; ++a)
+              tmp += tensorBasis.D(i,a)*vco(tensorBasis.node(a,j), 1);
+            for (int b=0; b < n; ++b)
+              tmp -= tensorBasis.D(j,b)*vco(tensorBasis.node(i,b), 0);
+            vort_val_qp(cell,qp,level) = tmp/jacobian_det(cell,qp);
+          }
+        }
+      }
+    }
+  }
+  else {
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int level=0; level < numLevels; ++level) {
       for (std::size_t node=0; node < numNodes; ++node) {
@@ -153,6 +188,7 @@ evaluateFields(typename Traits::EvalData workset)
       }
     }
   }
+  }
 
   /*
   if( this->getName() == "Aeras::VorticityLevels<Residual>"){
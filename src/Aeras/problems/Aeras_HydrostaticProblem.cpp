@@ -34,6 +34,9 @@ HydrostaticProblem( const Teuchos::RCP<Teuchos::ParameterList>& params_,
 
   neq       = 1 + (3*numLevels) + (numTracers*numLevels);
 
+  if (params_->sublist("Hydrostatic Problem").get<bool>("Matrix-Free Hyperviscosity", false))
+    hvOperator = Teuchos::rcp(new Aeras::HyperviscosityOperator);
+
   // Set the num PDEs for the null space object to pass to ML
   this->rigidBodyModes->setNumPDEs(neq);
 }
@@ -451,6 +454,8 @@ HydrostaticProblem::constructEvaluators<PHAL::AlbanyTraits::Jacobian>(
 
 
     p->set<double>("HV coefficient", HVcoef);
+    if (hvOperator != Teuchos::null)
+      p->set< RCP<Aeras::HyperviscosityOperator> >("Hyperviscosity Operator", hvOperator);
 
     ev = rcp(new Aeras::ComputeAndScatterJac<EvalT,AlbanyTraits>(*p,dl));
     fm0.registerEvaluator<EvalT>(ev);
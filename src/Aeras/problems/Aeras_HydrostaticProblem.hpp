@@ -125,6 +125,10 @@ namespace Aeras {
     void constructDirichletEvaluators(const Albany::MeshSpecsStruct& meshSpecs);
     void constructNeumannEvaluators(const Teuchos::RCP<Albany::MeshSpecsStruct>& meshSpecs);
 
+    //! Element-by-element hyperviscosity Laplacian, null unless
+    //! "Matrix-Free Hyperviscosity" is set
+    Teuchos::RCP<Aeras::HyperviscosityOperator> getHyperviscosityOperator() const { return hvOperator; }
+
   protected:
     Teuchos::RCP<Aeras::Layouts> dl;
     const Teuchos::ArrayRCP<std::string> dof_names_tracers;
@@ -133,6 +137,7 @@ namespace Aeras {
     const int numTracers;
     //! Problem PL 
     const Teuchos::RCP<Teuchos::ParameterList> params;
+    Teuchos::RCP<Aeras::HyperviscosityOperator> hvOperator;
 
   };
 
@@ -317,6 +322,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", dof_names_tracers[t]);
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
 
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -434,6 +441,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", dof_names_levels[1]);
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_levels_gradient[1]);
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
     
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -473,6 +482,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Variable Name", "KineticEnergy");
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", "KineticEnergy_gradient");
+    p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
   
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
@@ -601,6 +612,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Variable Name"            ,   "Pressure");
       p->set<string>("Gradient BF Name"    ,   "Grad BF");
       p->set<string>("Gradient Variable Name",   "Gradient QP Pressure");
+      p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
     
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
@@ -751,6 +764,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Variable Name",          "GeoPotential");
       p->set<string>("Gradient BF Name",       "Grad BF");
       p->set<string>("Gradient Variable Name", "Gradient QP GeoPotential");
+      p->set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+      p->set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > > ("Intrepid2 Basis", intrepidBasis);
     
       ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
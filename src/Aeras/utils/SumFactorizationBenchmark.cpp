@@ -0,0 +1,177 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Cost of the dense versus sum-factorized reference gradient on a
+// Gauss-Lobatto-Legendre quad as a function of the points per direction.
+//
+//   AerasSumFactorizationBenchmark [max points per direction] [elements]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Aeras_TensorProductBasis.hpp"
+
+namespace {
+
+// Legendre polynomial of degree p and its derivative at x.
+void legendre(const int p, const double x, double& L, double& dL)
+{
+  double L0 = 1.0, L1 = x;
+  if (p == 0) { L = 1.0; dL = 0.0; return; }
+  for (int k=2; k<=p; ++k) {
+    const double L2 = ((2*k-1)*x*L1 - (k-1)*L0)/k;
+    L0 = L1; L1 = L2;
+  }
+  L  = L1;
+  dL = p*(x*L1 - L0)/(x*x - 1.0);
+}
+
+// Gauss-Lobatto-Legendre points and the 1D differentiation matrix.
+void gll(const int n, std::vector<double>& x, std::vector<double>& D)
+{
+  const int p = n-1;
+  x.resize(n);
+  x[0] = -1.0; x[p] = 1.0;
+  for (int k=1; k<p; ++k) {
+    double xk = -std::cos(M_PI*k/p);
+    for (int it=0; it<100; ++it) {
+      // Newton on (1-x^2) L_p'(x), i.e. on L_{p-1} - L_{p+1}.
+      double Lm, dLm, Lp, dLp;
+      legendre(p-1, xk, Lm, dLm);
+      legendre(p+1, xk, Lp, dLp);
+      const double dx = (Lm-Lp)/(dLm-dLp);
+      xk -= dx;
+      if (std::abs(dx) < 1.0e-15) break;
+    }
+    x[k] = xk;
+  }
+  std::vector<double> L(n);
+  for (int k=0; k<n; ++k) { double dL; legendre(p, x[k], L[k], dL); }
+  D.assign(n*n, 0.0);
+  for (int i=0; i<n; ++i)
+    for (int a=0; a<n; ++a)
+      if (i != a) D[i*n+a] = L[i]/(L[a]*(x[i]-x[a]));
+  D[0] = -0.25*p*(p+1);
+  D[p*n+p] = 0.25*p*(p+1);
+}
+
+// Basis tables laid out like the Intrepid2 views the evaluators see.
+// Nodes are numbered eta-fastest and quadrature points xi-fastest so the
+// detection has to recover a nontrivial permutation.
+struct Tables {
+  int n;
+  std::vector<double> x, D, val, grad, pts;
+  double operator()(const int q, const int r) const { return pts[q*2+r]; }
+  int node(const int a, const int b) const { return b*n+a; }
+  int qp(const int i, const int j) const { return i*n+j; }
+};
+
+struct ValView {
+  const Tables* t;
+  double operator()(const int v, const int q) const { return t->val[v*t->n*t->n+q]; }
+};
+struct GradView {
+  const Tables* t;
+  double operator()(const int v, const int q, const int r) const {
+    return t->grad[(v*t->n*t->n+q)*2+r];
+  }
+};
+
+void build(const int n, Tables& t)
+{
+  t.n = n;
+  gll(n, t.x, t.D);
+  const int N = n*n;
+  t.val.assign(N*N, 0.0);
+  t.grad.assign(N*N*2, 0.0);
+  t.pts.assign(N*2, 0.0);
+  for (int i=0; i<n; ++i)
+    for (int j=0; j<n; ++j) {
+      t.pts[t.qp(i,j)*2+0] = t.x[i];
+      t.pts[t.qp(i,j)*2+1] = t.x[j];
+    }
+  for (int a=0; a<n; ++a)
+    for (int b=0; b<n; ++b)
+      for (int i=0; i<n; ++i)
+        for (int j=0; j<n; ++j) {
+          const int v = t.node(a,b), q = t.qp(i,j);
+          t.val[v*N+q] = (a == i && b == j) ? 1.0 : 0.0;
+          t.grad[(v*N+q)*2+0] = (b == j) ? t.D[i*n+a] : 0.0;
+          t.grad[(v*N+q)*2+1] = (a == i) ? t.D[j*n+b] : 0.0;
+        }
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+  const int maxOrder = argc > 1 ? std::atoi(argv[1]) : 10;
+  const int numElems = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+  std::cout << std::setw(4) << "n" << std::setw(14) << "dense [ns]"
+            << std::setw(14) << "factor [ns]" << std::setw(10) << "speedup"
+            << std::setw(14) << "max diff" << std::endl;
+
+  bool ok = true;
+  for (int n=2; n<=maxOrder; ++n) {
+    Tables t;
+    build(n, t);
+    const ValView  val  = {&t};
+    const GradView grad = {&t};
+    const int N = n*n;
+
+    Aeras::TensorProductBasis tp;
+    if (!tp.setup(val, grad, t, N, N)) {
+      std::cout << std::setw(4) << n << "  tensor-product structure not detected" << std::endl;
+      ok = false;
+      continue;
+    }
+
+    std::vector<double> u(numElems*N), dense(numElems*N*2), fact(numElems*N*2);
+    for (std::size_t k=0; k<u.size(); ++k) u[k] = dist(gen);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int e=0; e<numElems; ++e)
+      for (int q=0; q<N; ++q)
+        for (int r=0; r<2; ++r) {
+          double s = 0.0;
+          for (int v=0; v<N; ++v) s += u[e*N+v]*grad(v,q,r);
+          dense[(e*N+q)*2+r] = s;
+        }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int e=0; e<numElems; ++e)
+      for (int i=0; i<n; ++i)
+        for (int j=0; j<n; ++j) {
+          double dxi = 0.0, deta = 0.0;
+          for (int a=0; a<n; ++a) dxi  += tp.D(i,a)*u[e*N+tp.node(a,j)];
+          for (int b=0; b<n; ++b) deta += tp.D(j,b)*u[e*N+tp.node(i,b)];
+          fact[(e*N+tp.qp(i,j))*2+0] = dxi;
+          fact[(e*N+tp.qp(i,j))*2+1] = deta;
+        }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double diff = 0.0;
+    for (std::size_t k=0; k<dense.size(); ++k)
+      diff = std::max(diff, std::abs(dense[k]-fact[k]));
+    if (diff > 1.0e-10*n*n) ok = false;
+
+    const double td = std::chrono::duration<double, std::nano>(t1-t0).count()/numElems;
+    const double tf = std::chrono::duration<double, std::nano>(t2-t1).count()/numElems;
+    std::cout << std::setw(4) << n << std::setw(14) << std::fixed << std::setprecision(1) << td
+              << std::setw(14) << tf << std::setw(10) << std::setprecision(2) << td/tf
+              << std::setw(14) << std::scientific << std::setprecision(2) << diff
+              << std::defaultfloat << std::endl;
+  }
+  return ok ? 0 : 1;
+}
@@ -789,6 +789,12 @@ Application::finalSetUp(
   // Now setup response functions (see note above)
   for (int i = 0; i < responses.size(); i++) { responses[i]->setup(); }
 
+  // Layer-wise element activation (element birth)
+  if (problemParams->isSublist("Element Activation") == true) {
+    elementActivation = rcp(new ElementActivation(
+        problemParams->sublist("Element Activation"), disc, out));
+  }
+
   // Set up memory for workset
   fm = problem->getFieldManager();
   TEUCHOS_TEST_FOR_EXCEPTION(
@@ -797,6 +803,32 @@ Application::finalSetUp(
       "getFieldManager not implemented!!!");
   dfm = problem->getDirichletFieldManager();
 
+  // Optionally save states as part of the residual fill. Not available with
+  // RCU, which treats the state sweep specially, nor with SDBCs, for which
+  // the residual is evaluated at a modified solution.
+  save_states_in_residual_ =
+      problemParams->get("Save States In Residual Fill", false);
+  if (save_states_in_residual_ == true &&
+      (Teuchos::nonnull(rc_mgr) || problem->useSDBCs() == true)) {
+    *out << "Warning: 'Save States In Residual Fill' is not supported with "
+            "RCU or SDBCs, ignoring it.\n";
+    save_states_in_residual_ = false;
+  }
+  if (save_states_in_residual_ == true) {
+    Teuchos::RCP<PHX::DataLayout> dummy =
+        Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+    for (int ps = 0; ps < fm.size(); ++ps) {
+      std::string elementBlockName = meshSpecs[ps]->ebName;
+      std::vector<std::string> const responseIDs_to_require =
+          stateMgr.getResidResponseIDsToRequire(elementBlockName);
+      for (auto const& responseID : responseIDs_to_require) {
+        PHX::Tag<PHAL::AlbanyTraits::Residual::ScalarT> res_response_tag(
+            responseID, dummy);
+        fm[ps]->requireField<PHAL::AlbanyTraits::Residual>(res_response_tag);
+      }
+    }
+  }
+
   offsets_    = problem->getOffsets();
   nodeSetIDs_ = problem->getNodeSetIDs();
 
@@ -1376,6 +1408,7 @@ Application::computeGlobalResidualImpl(
     workset.f = overlapped_f;
 
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (isWorksetInactive(ws) == true) continue;
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
@@ -1392,6 +1425,28 @@ Application::computeGlobalResidualImpl(
             ->evaluateFields<EvalT>(workset);
       }
     }
+
+    // The state-saving evaluators ran as part of this fill, so remember
+    // the solution they correspond to.
+    if (save_states_in_residual_ == true) {
+      auto const copy_into = [](Teuchos::RCP<Thyra_Vector>&      dst,
+                                Teuchos::RCP<const Thyra_Vector> src) {
+        if (Teuchos::is_null(src)) {
+          dst = Teuchos::null;
+          return;
+        }
+        if (Teuchos::is_null(dst) ||
+            dst->space()->isCompatible(*src->space()) == false) {
+          dst = Thyra::createMember(src->space());
+        }
+        dst->assign(*src);
+      };
+      copy_into(states_x_, x);
+      copy_into(states_xdot_, x_dot);
+      copy_into(states_xdotdot_, x_dotdot);
+      states_time_  = this_time;
+      states_valid_ = true;
+    }
   }
 
   // Assemble the residual into a non-overlapping vector
@@ -1400,6 +1455,11 @@ Application::computeGlobalResidualImpl(
     cas_manager->combine(overlapped_f, f, CombineMode::ADD);
   }
 
+  // Rows of DOFs outside the active elements are empty
+  if (Teuchos::nonnull(elementActivation)) {
+    elementActivation->padInactiveRows(f, Teuchos::null);
+  }
+
   // Allocate scaleVec_
 #ifdef ALBANY_MPI
   if (scale != 1.0) {
@@ -1599,6 +1659,7 @@ Application::computeGlobalJacobianImpl(
     }
 #endif
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (isWorksetInactive(ws) == true) continue;
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
@@ -1630,6 +1691,12 @@ Application::computeGlobalJacobianImpl(
     cas_manager->combine(overlapped_jac, jac, CombineMode::ADD);
   }
 
+  // Rows of DOFs outside the active elements are empty, so put the
+  // identity on them to keep the system nonsingular
+  if (Teuchos::nonnull(elementActivation)) {
+    elementActivation->padInactiveRows(f, jac);
+  }
+
   // scale Jacobian
   if (scaleBCdofs == false && scale != 1.0) {
     fillComplete(jac);
@@ -2011,6 +2078,7 @@ Application::computeGlobalTangent(
     workset.param_offset = param_offset;
 
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (isWorksetInactive(ws) == true) continue;
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
@@ -2190,6 +2258,7 @@ Application::applyGlobalDistParamDerivImpl(
     workset.transpose_dist_param_deriv = trans;
 
     for (int ws = 0; ws < numWorksets; ws++) {
+      if (isWorksetInactive(ws) == true) continue;
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
@@ -2402,6 +2471,11 @@ Application::evaluateStateFieldManager(
     Teuchos::Ptr<const Thyra_Vector> xdot,
     Teuchos::Ptr<const Thyra_Vector> xdotdot)
 {
+  // The last residual fill already saved the states at this solution
+  if (statesSavedByResidualFill(current_time, x, xdot, xdotdot) == true) {
+    return;
+  }
+
   TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: State Residual");
   {
     std::string evalName = PHAL::evalName<PHAL::AlbanyTraits::Residual>("SFM",0);
@@ -2452,6 +2526,7 @@ Application::evaluateStateFieldManager(
   // Perform fill via field manager
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->beginEvaluatingSfm();
   for (int ws = 0; ws < numWorksets; ws++) {
+    if (isWorksetInactive(ws) == true) continue;
     const std::string evalName = PHAL::evalName<PHAL::AlbanyTraits::Residual>(
         "SFM", wsPhysIndex[ws]);
     loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws, evalName);
@@ -2460,6 +2535,44 @@ Application::evaluateStateFieldManager(
   if (Teuchos::nonnull(rc_mgr)) rc_mgr->endEvaluatingSfm();
 }
 
+bool
+Application::statesSavedByResidualFill(
+    const double                     current_time,
+    const Thyra_Vector&              x,
+    Teuchos::Ptr<const Thyra_Vector> xdot,
+    Teuchos::Ptr<const Thyra_Vector> xdotdot)
+{
+  if (save_states_in_residual_ == false || states_valid_ == false) {
+    return false;
+  }
+
+  // The saved values are used at most once; after updateStates the same
+  // solution would give different states.
+  states_valid_ = false;
+
+  if (states_time_ != current_time) return false;
+
+  // Compare in place, the stored copies are not needed afterwards. The
+  // norms are global reductions, so all ranks take the same branch.
+  auto const same = [](Teuchos::RCP<Thyra_Vector> const& saved,
+                       Teuchos::Ptr<const Thyra_Vector>  given) {
+    if (Teuchos::is_null(saved) || Teuchos::is_null(given)) {
+      return Teuchos::is_null(saved) && Teuchos::is_null(given);
+    }
+    saved->update(-1.0, *given);
+    return saved->norm_inf() == 0.0;
+  };
+
+  if (same(states_x_, Teuchos::ptrFromRef(x)) == false) return false;
+  if (same(states_xdot_, xdot) == false) return false;
+  if (same(states_xdotdot_, xdotdot) == false) return false;
+
+  // Distributed parameters changed after the residual fill
+  if (distParamLib->needs_scatter() == true) return false;
+
+  return true;
+}
+
 void
 Application::registerShapeParameters()
 {
@@ -2566,6 +2679,19 @@ Application::loadBasicWorksetInfo(PHAL::Workset& workset, double current_time)
   // workset.delta_time = delta_time;
   workset.transientTerms    = Teuchos::nonnull(workset.xdot);
   workset.accelerationTerms = Teuchos::nonnull(workset.xdotdot);
+
+  // Every fill goes through here, so keep the active elements in sync
+  // with the time of the fill.
+  if (Teuchos::nonnull(elementActivation)) {
+    elementActivation->update(current_time);
+  }
+}
+
+bool
+Application::isWorksetInactive(int const ws) const
+{
+  return Teuchos::nonnull(elementActivation) &&
+         elementActivation->isWorksetActive(ws) == false;
 }
 
 void
@@ -13,6 +13,7 @@
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_SerialDenseMatrix.hpp"
+#include "Teuchos_TestForException.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
@@ -23,6 +24,7 @@
 
 #include "AAdapt_AdaptiveSolutionManager.hpp"
 #include "Albany_DiscretizationFactory.hpp"
+#include "Albany_ElementActivation.hpp"
 
 #include "Sacado_ParameterAccessor.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -132,6 +134,20 @@ class Application
     return response_observ_freq;
   }
 
+  //! Number of time (or continuation) steps completed, advanced by the
+  //! observer of this application
+  Teuchos::RCP<const int>
+  getCompletedSteps() const
+  {
+    return completed_steps;
+  }
+
+  void
+  notifyStepCompleted()
+  {
+    ++(*completed_steps);
+  }
+
   Teuchos::Array<unsigned int>
   getMarkersForRelativeResponses() const
   {
@@ -403,6 +419,16 @@ class Application
       const double             current_time,
       const Thyra_MultiVector& x);
 
+  //! Whether the last residual fill already saved the states for this
+  //! solution, so the state field manager sweep can be skipped. Consumes
+  //! the saved fill: a second call for the same solution returns false.
+  bool
+  statesSavedByResidualFill(
+      const double                     current_time,
+      const Thyra_Vector&              x,
+      Teuchos::Ptr<const Thyra_Vector> xdot,
+      Teuchos::Ptr<const Thyra_Vector> xdotdot);
+
   //! Access to number of worksets - needed for working with StateManager
   int
   getNumWorksets()
@@ -461,6 +487,10 @@ class Application
   void
   loadBasicWorksetInfo(PHAL::Workset& workset, double current_time);
 
+  //! True if element activation is in use and workset ws is not active
+  bool
+  isWorksetInactive(int const ws) const;
+
   void
   loadBasicWorksetInfoSDBCs(
       PHAL::Workset&                          workset,
@@ -694,6 +724,37 @@ class Application
     xdotdot_ = xdotdot;
   }
 
+  // Schwarz boundary values of the node set coupled to app_index, when
+  // that application lives on other ranks and its solution cannot be
+  // read directly. values[f][dim * ns_node + i] is component i of the
+  // solution (f = 0) or of its time derivatives (f = 1, 2).
+  void
+  setSchwarzBoundaryValues(
+      int const                           app_index,
+      std::vector<std::vector<ST>> const& values)
+  {
+    schwarz_boundary_values_[app_index] = values;
+  }
+
+  bool
+  hasSchwarzBoundaryValues(int const app_index) const
+  {
+    return schwarz_boundary_values_.find(app_index) !=
+           schwarz_boundary_values_.end();
+  }
+
+  std::vector<std::vector<ST>> const&
+  getSchwarzBoundaryValues(int const app_index) const
+  {
+    auto it = schwarz_boundary_values_.find(app_index);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        it == schwarz_boundary_values_.end(),
+        std::logic_error,
+        "No Schwarz boundary values received from application "
+            << app_index << ".\n");
+    return it->second;
+  }
+
   void
   setSchwarzAlternating(bool const isa)
   {
@@ -720,6 +781,8 @@ class Application
   Teuchos::RCP<Thyra_Vector const> xdot_{Teuchos::null};
   Teuchos::RCP<Thyra_Vector const> xdotdot_{Teuchos::null};
 
+  std::map<int, std::vector<std::vector<ST>>> schwarz_boundary_values_;
+
   bool is_schwarz_alternating_{false};
 
 #endif  // ALBANY_LCM
@@ -774,6 +837,9 @@ class Application
   //! Reference configuration (update) manager
   Teuchos::RCP<AAdapt::rc::Manager> rc_mgr;
 
+  //! Layer-wise element activation, null if not in use
+  Teuchos::RCP<ElementActivation> elementActivation;
+
   //! Response functions
   Teuchos::Array<Teuchos::RCP<Albany::AbstractResponseFunction>> responses;
 
@@ -789,6 +855,19 @@ class Application
   //! Phalanx Field Manager for states
   Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> sfm;
 
+  //! Evaluate the state-saving fields as part of every residual fill, and
+  //! skip the state field manager sweep when the observed solution is the
+  //! one of the last residual fill
+  bool save_states_in_residual_{false};
+
+  //! Solution, time derivatives and time of the last residual fill that
+  //! saved states
+  Teuchos::RCP<Thyra_Vector> states_x_;
+  Teuchos::RCP<Thyra_Vector> states_xdot_;
+  Teuchos::RCP<Thyra_Vector> states_xdotdot_;
+  double                     states_time_{0.0};
+  bool                       states_valid_{false};
+
   bool explicit_scheme;
 
   //! Data for Physics-Based Preconditioners
@@ -867,6 +946,9 @@ class Application
   // how often one wants the responses to be computed/printed
   int response_observ_freq;
 
+  // time (or continuation) steps completed, see notifyStepCompleted
+  Teuchos::RCP<int> completed_steps{Teuchos::rcp(new int(0))};
+
   // local responses
   Teuchos::Array<unsigned int> relative_responses;
 };
@@ -897,6 +979,9 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, const int& ws,
 #endif
   workset.EBName               = wsEBNames[ws];
   workset.wsIndex              = ws;
+  workset.activeCells          = Teuchos::nonnull(elementActivation) ?
+                                     elementActivation->activeCells(ws) :
+                                     Kokkos::View<const int*, PHX::Device>();
 
   workset.local_Vp.resize(workset.numCells);
 
@@ -14,6 +14,7 @@
 
 #include "Albany_StateInfoStruct.hpp" // For IDArray
 #include "Albany_ThyraTypes.hpp"
+#include "Albany_ThyraUtils.hpp"
 #include "Albany_CombineAndScatterManager.hpp"
 
 namespace Albany {
@@ -80,6 +81,7 @@ public:
   //! Fill overlapped vector from owned vector (CombineMode = INSERT)
   void scatter() const {
     cas_manager->scatter(owned_vec, overlapped_vec, CombineMode::INSERT);
+    mark_scattered();
   }
 
   //! Fill owned vector from overlapped vector (CombineMode = ZERO)
@@ -88,8 +90,41 @@ public:
     //       during the evaluation phase, and simply copy what's local in the
     //       overlapped_vec into the owned_vec
     cas_manager->combine(overlapped_vec, owned_vec, CombineMode::ZERO);
+    invalidate();
   }
 
+  //! Whether the local part of the owned vector differs from what was last scattered.
+  //  The owned vector is handed out as a non-const RCP and written in place
+  //  (model evaluator, solvers, scatter evaluators), so rather than relying on
+  //  callers to flag modifications we compare against a local snapshot. This
+  //  is a purely local check: callers must agree across ranks before skipping
+  //  the (collective) scatter.
+  bool owned_changed_locally() const {
+    if (!snapshot_valid) {
+      return true;
+    }
+    auto data = getLocalData(owned_vec.getConst());
+    if (data.size()!=scattered_values.size()) {
+      return true;
+    }
+    for (int i=0; i<data.size(); ++i) {
+      if (data[i]!=scattered_values[i]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Record that the overlapped vector is now consistent with the owned one
+  void mark_scattered() const {
+    auto data = getLocalData(owned_vec.getConst());
+    scattered_values.assign(data.begin(),data.end());
+    snapshot_valid = true;
+  }
+
+  //! Force the next library scatter to re-import this parameter
+  void invalidate() const { snapshot_valid = false; }
+
   //! Get the CombineAndScatterManager for this parameter
   virtual Teuchos::RCP<const CombineAndScatterManager> get_cas_manager () const { return cas_manager; }
 
@@ -111,6 +146,10 @@ protected:
 
   //! Vector over worksets, containing DOF's map from (elem, node, nComp) into local id
   Teuchos::RCP<const id_array_vec_type> ws_elem_dofs;
+
+  //! Local owned values at the time of the last scatter
+  mutable Teuchos::Array<ST>  scattered_values;
+  mutable bool                snapshot_valid = false;
 };
 
 } // namespace Albany
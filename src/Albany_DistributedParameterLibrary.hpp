@@ -8,11 +8,14 @@
 #define ALBANY_DISTRIBUTED_PARAMETER_LIBRARY_HPP
 
 #include <map>
+#include <vector>
 
+#include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_TestForException.hpp"
 
 #include "Albany_DistributedParameter.hpp"
+#include "Albany_ThyraUtils.hpp"
 
 namespace Albany {
 
@@ -38,6 +41,7 @@ public:
   void add(const std::string& name,
            const Teuchos::RCP<param_type>& param) {
     param_map[name] = param;
+    groups.clear();
   }
 
   //! Get parameter from library
@@ -54,12 +58,64 @@ public:
     return param_map.find(name) != param_map.end();
   }
 
-  //! Loop through the stored parameters and scatter each of them
+  //! Scatter the stored parameters whose owned vector changed since their last scatter
+  //  Parameters sharing the same owned/overlapped vector spaces are imported
+  //  together as one multivector, so the halo exchange happens once per group.
   void scatter() const
   {
-    const_iterator it = param_map.begin();
-    while(it != param_map.end())
-      (it++)->second->scatter();
+    if (param_map.empty()) {
+      return;
+    }
+    if (groups.empty()) {
+      build_groups();
+    }
+
+    std::vector<Teuchos::RCP<param_type>> params;
+    for (const auto& it : param_map) {
+      params.push_back(it.second);
+    }
+    const std::vector<int> changed = changed_params();
+
+    for (auto& g : groups) {
+      std::vector<int> members;
+      for (int idx : g.members) {
+        if (changed[idx]==1) {
+          members.push_back(idx);
+        }
+      }
+      if (members.empty()) {
+        continue;
+      }
+      if (members.size()==1) {
+        params[members[0]]->scatter();
+        continue;
+      }
+
+      const int n = members.size();
+      if (g.owned_mv.is_null() || g.owned_mv->domain()->dim()!=n) {
+        g.owned_mv = Thyra::createMembers(params[members[0]]->vector_space(),n);
+        g.overlapped_mv = Thyra::createMembers(params[members[0]]->overlap_vector_space(),n);
+      }
+      for (int j=0; j<n; ++j) {
+        g.owned_mv->col(j)->assign(*params[members[j]]->vector());
+      }
+      params[members[0]]->get_cas_manager()->scatter(*g.owned_mv,*g.overlapped_mv,CombineMode::INSERT);
+      for (int j=0; j<n; ++j) {
+        params[members[j]]->overlapped_vector()->assign(*g.overlapped_mv->col(j));
+        params[members[j]]->mark_scattered();
+      }
+    }
+  }
+
+  //! Whether any stored parameter changed since its last scatter (collective)
+  bool needs_scatter() const
+  {
+    for (int c : changed_params()) {
+      if (c==1) {
+        return true;
+      }
+    }
+    return false;
   }
 
   //! Loop through the stored parameters and combine each of them
@@ -84,9 +140,61 @@ public:
 
 protected:
 
+  //! Parameters that can be imported together, by index in param_map order
+  struct ScatterGroup {
+    std::vector<int>                    members;
+    Teuchos::RCP<Thyra_MultiVector>     owned_mv;
+    Teuchos::RCP<Thyra_MultiVector>     overlapped_mv;
+  };
+
+  //! Flags of the parameters (in param_map order) that changed on any rank
+  std::vector<int> changed_params() const
+  {
+    const int num_params = param_map.size();
+    std::vector<int> local_changed(num_params,0), changed(num_params,0);
+    if (num_params==0) {
+      return changed;
+    }
+    int idx = 0;
+    for (const auto& it : param_map) {
+      local_changed[idx++] = it.second->owned_changed_locally() ? 1 : 0;
+    }
+    auto comm = getComm(param_map.begin()->second->vector_space());
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, num_params,
+                       local_changed.data(), changed.data());
+    return changed;
+  }
+
+  //! Group the parameters by (owned, overlapped) vector spaces
+  void build_groups() const
+  {
+    std::vector<Teuchos::RCP<param_type>> params;
+    for (const auto& it : param_map) {
+      const int idx = params.size();
+      params.push_back(it.second);
+      bool found = false;
+      for (auto& g : groups) {
+        const auto& first = params[g.members[0]];
+        if (sameAs(first->vector_space(),it.second->vector_space()) &&
+            sameAs(first->overlap_vector_space(),it.second->overlap_vector_space())) {
+          g.members.push_back(idx);
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        groups.emplace_back();
+        groups.back().members.push_back(idx);
+      }
+    }
+  }
+
   //! Map between parameter name and parameter object
   param_map_type param_map;
 
+  //! Scatter groups, rebuilt lazily after parameters are added
+  mutable std::vector<ScatterGroup> groups;
+
 };
 
 } // namespace Albany
@@ -0,0 +1,175 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ElementActivation.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "Albany_ThyraUtils.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace Albany {
+
+ElementActivation::ElementActivation(
+    Teuchos::ParameterList const&               params,
+    Teuchos::RCP<AbstractDiscretization> const& disc,
+    Teuchos::RCP<Teuchos::FancyOStream> const&  out)
+    : disc_(disc), out_(out)
+{
+  int const num_dims = disc_->getNumDim();
+
+  build_dir_       = params.get<int>("Build Direction", num_dims - 1);
+  initial_height_  = params.get<double>("Initial Height", 0.0);
+  layer_thickness_ = params.get<double>("Layer Thickness");
+
+  Teuchos::Array<double> const times =
+      params.get<Teuchos::Array<double>>("Layer Times");
+  layer_times_ = times.toVector();
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      build_dir_ < 0 || build_dir_ >= num_dims,
+      std::logic_error,
+      "Element Activation: invalid Build Direction " << build_dir_ << "\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      layer_thickness_ <= 0.0,
+      std::logic_error,
+      "Element Activation: Layer Thickness must be positive\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      std::is_sorted(layer_times_.begin(), layer_times_.end()) == false,
+      std::logic_error,
+      "Element Activation: Layer Times must be nondecreasing\n");
+
+  cas_manager_ = createCombineAndScatterManager(
+      disc_->getVectorSpace(), disc_->getOverlapVectorSpace());
+
+  // The mesh does not move, so the lowest point of each cell along the
+  // build direction is computed once.
+  auto const& coords       = disc_->getCoords();
+  auto const& wsElNodeEqID = disc_->getWsElNodeEqID();
+  int const   num_worksets = wsElNodeEqID.size();
+
+  cell_min_height_.resize(num_worksets);
+  cell_active_.resize(num_worksets);
+  ws_active_.resize(num_worksets, true);
+  ws_all_active_.resize(num_worksets, true);
+  for (int ws = 0; ws < num_worksets; ++ws) {
+    int const num_cells = wsElNodeEqID[ws].extent(0);
+    int const num_nodes = wsElNodeEqID[ws].extent(1);
+    cell_min_height_[ws].resize(num_cells, std::numeric_limits<double>::max());
+    cell_active_[ws] =
+        Kokkos::View<int*, PHX::Device>("Active Cells", num_cells);
+    for (int cell = 0; cell < num_cells; ++cell) {
+      for (int node = 0; node < num_nodes; ++node) {
+        cell_min_height_[ws][cell] = std::min(
+            cell_min_height_[ws][cell], coords[ws][cell][node][build_dir_]);
+      }
+    }
+  }
+}
+
+double
+ElementActivation::depositedHeight(double const time) const
+{
+  auto const num_layers =
+      std::upper_bound(layer_times_.begin(), layer_times_.end(), time) -
+      layer_times_.begin();
+  return initial_height_ + layer_thickness_ * num_layers;
+}
+
+bool
+ElementActivation::update(double const time)
+{
+  // Nothing changes between layer deposition times.
+  int const num_layers =
+      std::upper_bound(layer_times_.begin(), layer_times_.end(), time) -
+      layer_times_.begin();
+  if (num_layers == num_layers_) return false;
+  num_layers_ = num_layers;
+
+  // A cell is active if it lies (partly) below the deposited height.
+  // Cells whose lowest face is at the current top are not.
+  double const height = depositedHeight(time);
+  double const tol    = 1.0e-10 * layer_thickness_;
+  int const    num_ws = cell_min_height_.size();
+
+  // Mark the DOFs of the active cells and find the owned DOFs that are
+  // not marked on any process.
+  auto const overlapped_mark =
+      Thyra::createMember(disc_->getOverlapVectorSpace());
+  auto const owned_mark = Thyra::createMember(disc_->getVectorSpace());
+  overlapped_mark->assign(0.0);
+
+  auto const  mark_view    = getNonconstLocalData(overlapped_mark);
+  auto const& wsElNodeEqID = disc_->getWsElNodeEqID();
+
+  num_active_ws_    = 0;
+  num_active_cells_ = 0;
+  for (int ws = 0; ws < num_ws; ++ws) {
+    auto const& elNodeEqID = wsElNodeEqID[ws];
+    int const   num_cells  = elNodeEqID.extent(0);
+    int const   num_nodes  = elNodeEqID.extent(1);
+    int const   num_eqs    = elNodeEqID.extent(2);
+
+    auto active = Kokkos::create_mirror_view(cell_active_[ws]);
+    int  num_ws_active_cells = 0;
+    for (int cell = 0; cell < num_cells; ++cell) {
+      active(cell) = cell_min_height_[ws][cell] < height - tol ? 1 : 0;
+      if (active(cell) == 0) continue;
+      ++num_ws_active_cells;
+      for (int node = 0; node < num_nodes; ++node) {
+        for (int eq = 0; eq < num_eqs; ++eq) {
+          mark_view[elNodeEqID(cell, node, eq)] = 1.0;
+        }
+      }
+    }
+    Kokkos::deep_copy(cell_active_[ws], active);
+
+    ws_active_[ws]     = num_ws_active_cells > 0;
+    ws_all_active_[ws] = num_ws_active_cells == num_cells;
+    if (ws_active_[ws] == true) ++num_active_ws_;
+    num_active_cells_ += num_ws_active_cells;
+  }
+  cas_manager_->combine(overlapped_mark, owned_mark, CombineMode::ADD);
+
+  inactive_dofs_.clear();
+  auto const owned_view = getLocalData(owned_mark.getConst());
+  for (LO dof = 0; dof < owned_view.size(); ++dof) {
+    if (owned_view[dof] == 0.0) inactive_dofs_.push_back(dof);
+  }
+
+  *out_ << "Element Activation: " << num_layers << " layers deposited, height "
+        << height << ", " << num_active_cells_ << " local cells in "
+        << num_active_ws_ << " of " << num_ws << " local worksets active, "
+        << inactive_dofs_.size()
+        << " local inactive DOFs\n";
+
+  return true;
+}
+
+void
+ElementActivation::padInactiveRows(
+    Teuchos::RCP<Thyra_Vector> const&   f,
+    Teuchos::RCP<Thyra_LinearOp> const& jac) const
+{
+  if (inactive_dofs_.size() == 0) return;
+
+  if (Teuchos::nonnull(f)) {
+    auto const f_view = getNonconstLocalData(f);
+    for (auto const dof : inactive_dofs_) { f_view[dof] = 0.0; }
+  }
+
+  if (Teuchos::nonnull(jac)) {
+    Teuchos::Array<LO> index(1);
+    Teuchos::Array<ST> value(1, 1.0);
+    for (auto const dof : inactive_dofs_) {
+      index[0] = dof;
+      setLocalRowValues(jac, dof, index(), value());
+    }
+  }
+}
+
+}  // namespace Albany
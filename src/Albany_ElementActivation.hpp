@@ -0,0 +1,123 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_ELEMENT_ACTIVATION_HPP
+#define ALBANY_ELEMENT_ACTIVATION_HPP
+
+#include <vector>
+
+#include "Phalanx_KokkosDeviceTypes.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+namespace Albany {
+
+/// Element birth for layer-by-layer deposition.
+/* \brief Cells become active when the deposited height, given by a
+ * schedule of layer deposition times, is above their lowest node along
+ * the build direction. Worksets without active cells are skipped in the
+ * fills, and the scatter evaluators do not assemble the inactive cells of
+ * the other worksets. The DOFs that belong to no active cell have empty
+ * rows, which are padded with the identity so that the solved system
+ * stays nonsingular and those DOFs keep their current value.
+ *
+ * The schedule is read from the "Element Activation" sublist of the
+ * problem:
+ *   "Build Direction"  : coordinate index of the build direction
+ *   "Initial Height"   : height of the substrate, active from the start
+ *   "Layer Thickness"  : thickness of each deposited layer
+ *   "Layer Times"      : deposition time of each layer, nondecreasing
+ */
+class ElementActivation
+{
+ public:
+  ElementActivation(
+      Teuchos::ParameterList const&               params,
+      Teuchos::RCP<AbstractDiscretization> const& disc,
+      Teuchos::RCP<Teuchos::FancyOStream> const&  out);
+
+  /// Update the active set for the given time. Returns true if it changed.
+  bool
+  update(double const time);
+
+  bool
+  isWorksetActive(int const ws) const
+  {
+    return ws_active_[ws];
+  }
+
+  /// Nonzero entry for the active cells of the workset; empty if they
+  /// all are, so that the scatter can skip the check.
+  Kokkos::View<int const*, PHX::Device>
+  activeCells(int const ws) const
+  {
+    if (ws_all_active_[ws] == true) {
+      return Kokkos::View<int const*, PHX::Device>();
+    }
+    return cell_active_[ws];
+  }
+
+  /// Height deposited by the given time along the build direction
+  double
+  depositedHeight(double const time) const;
+
+  /// Zero the residual and put a unit diagonal on the Jacobian rows of
+  /// the inactive owned DOFs. Either argument may be null.
+  void
+  padInactiveRows(
+      Teuchos::RCP<Thyra_Vector> const&   f,
+      Teuchos::RCP<Thyra_LinearOp> const& jac) const;
+
+  int
+  numActiveWorksets() const
+  {
+    return num_active_ws_;
+  }
+
+  int
+  numActiveCells() const
+  {
+    return num_active_cells_;
+  }
+
+  /// Number of owned DOFs not touched by any active cell
+  int
+  numInactiveDofs() const
+  {
+    return inactive_dofs_.size();
+  }
+
+ private:
+  Teuchos::RCP<AbstractDiscretization>   disc_;
+  Teuchos::RCP<CombineAndScatterManager> cas_manager_;
+  Teuchos::RCP<Teuchos::FancyOStream>    out_;
+
+  int                 build_dir_;
+  double              initial_height_;
+  double              layer_thickness_;
+  std::vector<double> layer_times_;
+
+  // Lowest node of each cell along the build direction, per workset
+  std::vector<std::vector<double>> cell_min_height_;
+
+  std::vector<Kokkos::View<int*, PHX::Device>> cell_active_;
+  std::vector<bool>                            ws_active_;
+  std::vector<bool>                            ws_all_active_;
+  int num_active_ws_{-1};
+  int num_active_cells_{-1};
+  int num_layers_{-1};
+
+  // Owned local ids of the DOFs not touched by any active cell
+  Teuchos::Array<LO> inactive_dofs_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_ELEMENT_ACTIVATION_HPP
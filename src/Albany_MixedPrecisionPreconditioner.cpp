@@ -0,0 +1,239 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_MixedPrecisionPreconditioner.hpp"
+
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_TpetraThyraUtils.hpp"
+
+#include "Thyra_DefaultPreconditioner.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#if defined(HAVE_TPETRA_INST_FLOAT)
+#include "Ifpack2_Factory.hpp"
+#endif
+
+namespace {
+
+#if defined(HAVE_TPETRA_INST_FLOAT)
+
+// A double precision operator applying a preconditioner built on a
+// single precision copy of a double precision matrix.
+class FloatPrecOperator : public Tpetra_Operator
+{
+public:
+  using float_matrix_type     = Tpetra::CrsMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>;
+  using float_row_matrix_type = Tpetra::RowMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>;
+  using float_mv_type         = Tpetra::MultiVector<float, Tpetra_LO, Tpetra_GO, KokkosNode>;
+  using float_prec_type       = Ifpack2::Preconditioner<float, Tpetra_LO, Tpetra_GO, KokkosNode>;
+
+  FloatPrecOperator (const std::string& precType, const Teuchos::ParameterList& precParams)
+   : m_prec_type (precType)
+   , m_prec_params (precParams)
+  {}
+
+  // Refresh the float copy of A, and (re)compute the preconditioner.
+  void compute (const Teuchos::RCP<const Tpetra_CrsMatrix>& A) {
+    const bool same_graph = Teuchos::nonnull(m_A_float) &&
+                            A->getCrsGraph().get()==m_graph.get();
+    if (same_graph) {
+      // Same sparsity: simply downcast the values, which are stored in the same order
+      auto src = A->getLocalMatrix().values;
+      auto dst = m_A_float->getLocalMatrix().values;
+      TEUCHOS_TEST_FOR_EXCEPTION (src.extent(0)!=dst.extent(0), std::logic_error,
+                                  "Error! The float copy of the matrix has a different number of entries.\n");
+      using exec_space = KokkosNode::execution_space;
+      Kokkos::parallel_for ("Albany::MixedPrecision::downcast",
+                            Kokkos::RangePolicy<exec_space>(0,src.extent(0)),
+                            KOKKOS_LAMBDA (const int i) {
+        dst(i) = static_cast<float>(src(i));
+      });
+    } else {
+      m_graph   = A->getCrsGraph();
+      m_A_float = A->convert<float>();
+      m_prec    = Ifpack2::Factory::create<float_row_matrix_type>(m_prec_type,m_A_float);
+      m_prec->setParameters(m_prec_params);
+      m_prec->initialize();
+    }
+    m_prec->compute();
+  }
+
+  Teuchos::RCP<const Tpetra_Map> getDomainMap () const override { return m_A_float->getDomainMap(); }
+  Teuchos::RCP<const Tpetra_Map> getRangeMap  () const override { return m_A_float->getRangeMap(); }
+
+  bool hasTransposeApply () const override { return false; }
+
+  void apply (const Tpetra_MultiVector& X,
+              Tpetra_MultiVector& Y,
+              Teuchos::ETransp mode = Teuchos::NO_TRANS,
+              ST alpha = Teuchos::ScalarTraits<ST>::one(),
+              ST beta = Teuchos::ScalarTraits<ST>::zero()) const override
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION (mode!=Teuchos::NO_TRANS, std::logic_error,
+                                "Error! The mixed precision preconditioner does not support transpose apply.\n");
+
+    const auto numVectors = X.getNumVectors();
+    if (m_X_float.is_null() || m_X_float->getNumVectors()!=numVectors) {
+      m_X_float = Teuchos::rcp(new float_mv_type(X.getMap(),numVectors,false));
+      m_Y_float = Teuchos::rcp(new float_mv_type(Y.getMap(),numVectors,false));
+    }
+
+    Tpetra::deep_copy(*m_X_float,X);
+    m_prec->apply(*m_X_float,*m_Y_float);
+
+    if (alpha==Teuchos::ScalarTraits<ST>::one() && beta==Teuchos::ScalarTraits<ST>::zero()) {
+      Tpetra::deep_copy(Y,*m_Y_float);
+    } else {
+      Tpetra_MultiVector Y_prec(Y.getMap(),numVectors,false);
+      Tpetra::deep_copy(Y_prec,*m_Y_float);
+      Y.update(alpha,Y_prec,beta);
+    }
+  }
+
+private:
+  std::string               m_prec_type;
+  Teuchos::ParameterList    m_prec_params;
+
+  Teuchos::RCP<const Tpetra_CrsGraph>   m_graph;
+  Teuchos::RCP<float_matrix_type>       m_A_float;
+  Teuchos::RCP<float_prec_type>         m_prec;
+
+  // Work vectors for the conversions
+  mutable Teuchos::RCP<float_mv_type>   m_X_float;
+  mutable Teuchos::RCP<float_mv_type>   m_Y_float;
+};
+
+#endif // HAVE_TPETRA_INST_FLOAT
+
+} // anonymous namespace
+
+namespace Albany {
+
+bool MixedPrecisionPreconditionerFactory::
+isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+#if defined(HAVE_TPETRA_INST_FLOAT)
+  // Point-block matrices ('Point Block Jacobian') cannot be converted to float
+  return getBlockSize(fwdOpSrc.getOp())==1 &&
+         Teuchos::nonnull(getConstTpetraMatrix(fwdOpSrc.getOp(),false));
+#else
+  (void) fwdOpSrc;
+  return false;
+#endif
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>> MixedPrecisionPreconditionerFactory::
+createPrec () const
+{
+  return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>());
+}
+
+void MixedPrecisionPreconditionerFactory::
+initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                Thyra::PreconditionerBase<ST>* prec,
+                const Thyra::ESupportSolveUse /* supportSolveUse */) const
+{
+#if defined(HAVE_TPETRA_INST_FLOAT)
+  TEUCHOS_TEST_FOR_EXCEPTION (getBlockSize(fwdOpSrc->getOp())>1, std::logic_error,
+                              "Error! The mixed precision preconditioner requires a Tpetra_CrsMatrix, "
+                              "which is incompatible with 'Point Block Jacobian'.\n");
+  auto A = getConstTpetraMatrix(fwdOpSrc->getOp(),false);
+  TEUCHOS_TEST_FOR_EXCEPTION (A.is_null(), std::logic_error,
+                              "Error! The mixed precision preconditioner requires the operator to be a Tpetra_CrsMatrix.\n");
+
+  auto defaultPrec = dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+  TEUCHOS_TEST_FOR_EXCEPTION (defaultPrec==nullptr, std::logic_error,
+                              "Error! The input preconditioner was not created by this factory.\n");
+
+  // Reuse the float matrix and preconditioner from a previous initialization, if any
+  Teuchos::RCP<FloatPrecOperator> precOp;
+  auto oldPrecOp = defaultPrec->getNonconstUnspecifiedPrecOp();
+  if (Teuchos::nonnull(oldPrecOp)) {
+    precOp = Teuchos::rcp_dynamic_cast<FloatPrecOperator>(getTpetraOperator(oldPrecOp,false));
+  }
+  if (precOp.is_null()) {
+    const auto params = getParameterList();
+    precOp = Teuchos::rcp(new FloatPrecOperator(params->get<std::string>("Prec Type"),
+                                                params->sublist("Ifpack2 Settings")));
+  }
+
+  precOp->compute(A);
+  defaultPrec->initializeUnspecified(createThyraLinearOp(precOp));
+#else
+  (void) fwdOpSrc;
+  (void) prec;
+  TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+                              "Error! The mixed precision preconditioner requires Tpetra to be instantiated on float.\n");
+#endif
+}
+
+void MixedPrecisionPreconditionerFactory::
+uninitializePrec (Thyra::PreconditionerBase<ST>* prec,
+                  Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+                  Thyra::ESupportSolveUse* supportSolveUse) const
+{
+  // The preconditioner does not store the forward operator
+  auto defaultPrec = dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+  if (defaultPrec!=nullptr) {
+    defaultPrec->uninitialize();
+  }
+  if (fwdOpSrc!=nullptr) {
+    *fwdOpSrc = Teuchos::null;
+  }
+  if (supportSolveUse!=nullptr) {
+    *supportSolveUse = Thyra::SUPPORT_SOLVE_UNSPECIFIED;
+  }
+}
+
+void MixedPrecisionPreconditionerFactory::
+setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& pl)
+{
+  pl->validateParametersAndSetDefaults(*getValidParameters(),0);
+  paramList = pl;
+}
+
+Teuchos::RCP<Teuchos::ParameterList> MixedPrecisionPreconditionerFactory::
+getNonconstParameterList ()
+{
+  return paramList;
+}
+
+Teuchos::RCP<Teuchos::ParameterList> MixedPrecisionPreconditionerFactory::
+unsetParameterList ()
+{
+  auto old = paramList;
+  paramList = Teuchos::null;
+  return old;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList> MixedPrecisionPreconditionerFactory::
+getParameterList () const
+{
+  if (paramList.is_null()) {
+    return getValidParameters();
+  }
+  return paramList;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList> MixedPrecisionPreconditionerFactory::
+getValidParameters () const
+{
+  static Teuchos::RCP<Teuchos::ParameterList> validPL;
+  if (validPL.is_null()) {
+    validPL = Teuchos::rcp(new Teuchos::ParameterList("Albany Mixed Precision"));
+    validPL->set<std::string>("Prec Type", "RILUK", "Type of the Ifpack2 preconditioner built on the float matrix");
+    validPL->sublist("Ifpack2 Settings", false, "Parameters passed to the Ifpack2 preconditioner").disableRecursiveValidation();
+  }
+  return validPL;
+}
+
+std::string MixedPrecisionPreconditionerFactory::
+description () const
+{
+  return "Albany::MixedPrecisionPreconditionerFactory";
+}
+
+} // namespace Albany
@@ -0,0 +1,75 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MIXED_PRECISION_PRECONDITIONER_HPP
+#define ALBANY_MIXED_PRECISION_PRECONDITIONER_HPP
+
+#include "Albany_ThyraTypes.hpp"
+#include "Albany_TpetraTypes.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+/*
+ * A Stratimikos preconditioner factory that builds an Ifpack2 preconditioner
+ * on a single precision copy of the (double precision) Jacobian.
+ *
+ * The Jacobian is still assembled and stored in double, and the Krylov
+ * iterations (including the residual checks) are carried out in double.
+ * Only the preconditioner setup and application are done in float: each
+ * apply converts the input vector to float, applies the preconditioner,
+ * and converts the result back to double. Since the preconditioner is
+ * memory bandwidth bound, this roughly halves its cost and memory.
+ *
+ * The float copy of the matrix is kept across Newton steps, and only its
+ * values are refreshed if the graph of the Jacobian did not change.
+ *
+ * Select it with 'Preconditioner Type: Albany Mixed Precision'. The
+ * parameters mirror those of the Ifpack2 preconditioner:
+ *
+ *   Albany Mixed Precision:
+ *     Prec Type: RILUK
+ *     Ifpack2 Settings: {...}
+ *
+ * This requires Tpetra (and Ifpack2) to be instantiated on float.
+ */
+
+class MixedPrecisionPreconditionerFactory : public Thyra::PreconditionerFactoryBase<ST>
+{
+public:
+  MixedPrecisionPreconditionerFactory () = default;
+
+  // Thyra::PreconditionerFactoryBase overrides
+  bool isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const override;
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>> createPrec () const override;
+
+  void initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                       Thyra::PreconditionerBase<ST>* prec,
+                       const Thyra::ESupportSolveUse supportSolveUse) const override;
+
+  void uninitializePrec (Thyra::PreconditionerBase<ST>* prec,
+                         Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+                         Thyra::ESupportSolveUse* supportSolveUse) const override;
+
+  // Teuchos::ParameterListAcceptor overrides
+  void setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& paramList) override;
+  Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList () override;
+  Teuchos::RCP<Teuchos::ParameterList> unsetParameterList () override;
+  Teuchos::RCP<const Teuchos::ParameterList> getParameterList () const override;
+  Teuchos::RCP<const Teuchos::ParameterList> getValidParameters () const override;
+
+  std::string description () const override;
+
+private:
+  Teuchos::RCP<Teuchos::ParameterList> paramList;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_MIXED_PRECISION_PRECONDITIONER_HPP
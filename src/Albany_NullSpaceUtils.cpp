@@ -284,7 +284,8 @@ struct TraitsImpl : public TraitsImplBase {
 
 RigidBodyModes::RigidBodyModes(int numPDEs_)
   : numPDEs(numPDEs_), numElasticityDim(0), numScalar(0), nullSpaceDim(0),
-    mlUsed(false), mueLuUsed(false), froschUsed(false), setNonElastRBM(false)
+    mlUsed(false), mueLuUsed(false), froschUsed(false), setNonElastRBM(false),
+    numNodesPerColumn(0), contiguousColumns(false)
 {}
 
 void RigidBodyModes::
@@ -337,6 +338,44 @@ void RigidBodyModes::setParameters(
   setNonElastRBM = setNonElastRBM_;
 }
 
+void RigidBodyModes::
+setLayeredMeshInfo(const int numNodesPerColumn_, const bool contiguousColumns_)
+{
+  numNodesPerColumn = numNodesPerColumn_;
+  contiguousColumns = contiguousColumns_;
+}
+
+void RigidBodyModes::setMueLuLineDetection()
+{
+  if (numNodesPerColumn<=0) {
+    return;
+  }
+
+  // Only bother if lines are used, either by the smoother or by semicoarsening
+  const bool lineSmoothing =
+    plist->isType<std::string>("smoother: type") &&
+    plist->get<std::string>("smoother: type").find("LINESMOOTHING")!=std::string::npos;
+  const bool semiCoarsening = plist->isParameter("semicoarsen: number of levels");
+  if (!lineSmoothing && !semiCoarsening && !plist->isParameter("linedetection: orientation")) {
+    return;
+  }
+
+  // If the dofs of each column are consecutive, MueLu does not need to
+  // detect the lines from the coordinates.
+  if (!plist->isParameter("linedetection: orientation")) {
+    plist->set<std::string>("linedetection: orientation", contiguousColumns ? "vertical" : "coordinates");
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (
+    plist->get<std::string>("linedetection: orientation")=="vertical" && !contiguousColumns,
+    std::logic_error,
+    "Error! MueLu 'linedetection: orientation: vertical' requires the dofs of each mesh column\n"
+    "       to be consecutive. Use 'Columnwise Ordering: true' in the discretization, with\n"
+    "       interleaved ordering and no side set equations, or use 'coordinates' orientation.\n");
+  if (!plist->isParameter("linedetection: num layers")) {
+    plist->set("linedetection: num layers", numNodesPerColumn);
+  }
+}
+
 void RigidBodyModes::
 setCoordinates(const Teuchos::RCP<Thyra_MultiVector>& coordMV_)
 {
@@ -393,6 +432,7 @@ setCoordinates(const Teuchos::RCP<Thyra_MultiVector>& coordMV_)
       // use simplified input deck
       plist->set("Coordinates", t_coordMV);
       plist->set("number of equations", numPDEs);
+      setMueLuLineDetection();
     }
   } else { // FROSch here
     auto t_coordMV = getTpetraMultiVector(coordMV);
@@ -53,10 +53,22 @@ public:
   //! Pass only the coordinates.
   void setCoordinates(const Teuchos::RCP<Thyra_MultiVector> &coordMV);
 
+  //! Set the layered (extruded) structure of the mesh. If MueLu line
+  //! smoothing or semicoarsening is used, it is used to fill in the line
+  //! detection parameters not set by the user. If contiguousColumns is true,
+  //! the dofs of each vertical column are consecutive in the solution map.
+  void setLayeredMeshInfo(const int numNodesPerColumn, const bool contiguousColumns);
+
 private:
+  //! Fill in the MueLu line detection parameters from the layered mesh info.
+  void setMueLuLineDetection();
+
   int numPDEs, numElasticityDim, numScalar, nullSpaceDim;
   bool mlUsed, mueLuUsed, froschUsed, setNonElastRBM;
 
+  int numNodesPerColumn;
+  bool contiguousColumns;
+
   Teuchos::RCP<Teuchos::ParameterList> plist;
 
   Teuchos::RCP<Thyra_MultiVector> coordMV;
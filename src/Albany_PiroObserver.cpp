@@ -18,6 +18,7 @@ PiroObserver::
 PiroObserver(const Teuchos::RCP<Application> &app, 
               Teuchos::RCP<const Thyra_ModelEvaluator> model)
  : impl_(app) 
+ , app_(app)
  , model_(model) 
  , out(Teuchos::VerboseObjectBase::getDefaultOStream())
 {
@@ -41,6 +42,7 @@ observeSolution(const Thyra_Vector &solution)
 {
   this->observeSolutionImpl(solution, Teuchos::ScalarTraits<ST>::zero());
   stepper_counter_++;
+  app_->notifyStepCompleted();
 }
 
 void PiroObserver::
@@ -49,6 +51,7 @@ observeSolution(const Thyra_Vector &solution,
 {
   this->observeSolutionImpl(solution, stamp);
   stepper_counter_++; 
+  app_->notifyStepCompleted();
 }
 
 void PiroObserver::
@@ -58,6 +61,7 @@ observeSolution(const Thyra_Vector &solution,
 {
   this->observeSolutionImpl(solution, solution_dot, stamp);
   stepper_counter_++; 
+  app_->notifyStepCompleted();
 }
 
 void PiroObserver::
@@ -68,6 +72,7 @@ observeSolution(const Thyra_Vector &solution,
 {
   this->observeSolutionImpl(solution, solution_dot, solution_dotdot, stamp);
   stepper_counter_++; 
+  app_->notifyStepCompleted();
 }
 
 void PiroObserver::
@@ -76,6 +81,7 @@ observeSolution(const Thyra_MultiVector &solution,
 {
   this->observeSolutionImpl(solution, stamp);
   stepper_counter_++; 
+  app_->notifyStepCompleted();
 }
 
 void PiroObserver::
@@ -86,6 +86,8 @@ private:
 
   ObserverImpl impl_;
 
+  Teuchos::RCP<Albany::Application> app_;
+
   Teuchos::RCP<const Thyra_ModelEvaluator> model_; 
 
 protected: 
@@ -0,0 +1,304 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ReusePreconditioner.hpp"
+
+#include "Thyra_DefaultPreconditioner.hpp"
+#include "Thyra_LinearOpBase.hpp"
+#include "Teuchos_StandardParameterEntryValidators.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+namespace {
+
+// A linear op that forwards to another one, counting how many times it is applied
+class CountingLinearOp : public Thyra_LinearOp
+{
+public:
+  CountingLinearOp (const Teuchos::RCP<const Thyra_LinearOp>& op,
+                    const Teuchos::RCP<int>& counter)
+   : m_op (op)
+   , m_counter (counter)
+  {}
+
+  Teuchos::RCP<const Thyra_VectorSpace> range  () const override { return m_op->range(); }
+  Teuchos::RCP<const Thyra_VectorSpace> domain () const override { return m_op->domain(); }
+
+protected:
+  bool opSupportedImpl (Thyra::EOpTransp M_trans) const override {
+    return Thyra::opSupported(*m_op,M_trans);
+  }
+
+  void applyImpl (const Thyra::EOpTransp M_trans,
+                  const Thyra_MultiVector& X,
+                  const Teuchos::Ptr<Thyra_MultiVector>& Y,
+                  const ST alpha,
+                  const ST beta) const override {
+    ++(*m_counter);
+    Thyra::apply(*m_op,M_trans,X,Y,alpha,beta);
+  }
+
+private:
+  Teuchos::RCP<const Thyra_LinearOp>  m_op;
+  Teuchos::RCP<int>                   m_counter;
+};
+
+Teuchos::RCP<const Thyra_LinearOp>
+wrap (const Teuchos::RCP<const Thyra_LinearOp>& op, const Teuchos::RCP<int>& counter)
+{
+  if (op.is_null()) {
+    return op;
+  }
+  return Teuchos::rcp(new CountingLinearOp(op,counter));
+}
+
+} // anonymous namespace
+
+namespace Albany {
+
+ReusePreconditionerFactory::
+ReusePreconditionerFactory (const inner_builder_type& innerBuilder,
+                            const Teuchos::RCP<const int>& completed_steps)
+ : m_inner_builder (innerBuilder)
+ , m_completed_steps (completed_steps)
+ , m_num_applies (Teuchos::rcp(new int(0)))
+{
+  // Nothing to do here
+}
+
+ReusePreconditionerFactory::
+~ReusePreconditionerFactory ()
+{
+  if (m_print_stats && m_num_solves>0) {
+    printStatistics();
+  }
+}
+
+int ReusePreconditionerFactory::completedSteps () const
+{
+  return m_completed_steps.is_null() ? 0 : *m_completed_steps;
+}
+
+bool ReusePreconditionerFactory::
+isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (m_inner_factory.is_null(), std::logic_error,
+                              "Error! The parameter list of the reuse preconditioner was not set.\n");
+  return m_inner_factory->isCompatible(fwdOpSrc);
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>> ReusePreconditionerFactory::
+createPrec () const
+{
+  return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>());
+}
+
+ReusePreconditionerFactory::Action ReusePreconditionerFactory::
+chooseAction (const Thyra::PreconditionerBase<ST>* prec, std::string& reason) const
+{
+  if (m_inner_prec.is_null() || prec!=m_prec) {
+    reason = "first solve";
+    return Action::Rebuild;
+  }
+  if (m_rebuild_every_solves>0 && m_solves_since_rebuild>=m_rebuild_every_solves) {
+    reason = "solve count";
+    return Action::Rebuild;
+  }
+  if (m_rebuild_every_steps>0 && completedSteps()-m_step_at_rebuild>=m_rebuild_every_steps) {
+    reason = "step count";
+    return Action::Rebuild;
+  }
+  if (m_iter_growth>0 && m_baseline_applies>0 &&
+      *m_num_applies>m_iter_growth*m_baseline_applies) {
+    reason = "iteration growth";
+    return Action::Rebuild;
+  }
+  reason = "";
+  return m_refresh ? Action::Refresh : Action::Lag;
+}
+
+void ReusePreconditionerFactory::
+initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                Thyra::PreconditionerBase<ST>* prec,
+                const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (m_inner_factory.is_null(), std::logic_error,
+                              "Error! The parameter list of the reuse preconditioner was not set.\n");
+  auto defaultPrec = dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+  TEUCHOS_TEST_FOR_EXCEPTION (defaultPrec==nullptr, std::logic_error,
+                              "Error! The input preconditioner was not created by this factory.\n");
+
+  // Applications in the solve with the current preconditioner (none before the first solve)
+  const int last_applies = *m_num_applies;
+  if (m_num_solves>0) {
+    m_total_applies += last_applies;
+    if (m_baseline_applies<0) {
+      m_baseline_applies = last_applies;
+    }
+  }
+
+  std::string reason;
+  const Action action = chooseAction(prec,reason);
+  switch (action) {
+    case Action::Rebuild:
+      if (Teuchos::nonnull(m_inner_prec)) {
+        m_inner_factory->uninitializePrec(m_inner_prec.get());
+      }
+      m_inner_prec = m_inner_factory->createPrec();
+      m_inner_factory->initializePrec(fwdOpSrc,m_inner_prec.get(),supportSolveUse);
+      m_prec = prec;
+      m_solves_since_rebuild = 0;
+      m_step_at_rebuild = completedSteps();
+      m_baseline_applies = -1;
+      ++m_num_rebuilds;
+      break;
+    case Action::Refresh:
+      m_inner_factory->initializePrec(fwdOpSrc,m_inner_prec.get(),supportSolveUse);
+      ++m_num_refreshes;
+      break;
+    case Action::Lag:
+      ++m_num_lags;
+      break;
+  }
+
+  if (action!=Action::Lag) {
+    // The inner ops may have been replaced, so wrap them again
+    auto left  = wrap(m_inner_prec->getLeftPrecOp(),m_num_applies);
+    auto right = wrap(m_inner_prec->getRightPrecOp(),m_num_applies);
+    auto unspecified = wrap(m_inner_prec->getUnspecifiedPrecOp(),m_num_applies);
+    if (Teuchos::nonnull(unspecified)) {
+      defaultPrec->initializeUnspecified(unspecified);
+    } else if (Teuchos::nonnull(left) && Teuchos::nonnull(right)) {
+      defaultPrec->initializeLeftRight(left,right);
+    } else if (Teuchos::nonnull(left)) {
+      defaultPrec->initializeLeft(left);
+    } else {
+      TEUCHOS_TEST_FOR_EXCEPTION (right.is_null(), std::logic_error,
+                                  "Error! The inner preconditioner does not have any operator.\n");
+      defaultPrec->initializeRight(right);
+    }
+  }
+
+  if (m_print_solve_stats) {
+    auto out = Teuchos::VerboseObjectBase::getDefaultOStream();
+    *out << "Albany Reuse: solve " << m_num_solves;
+    if (m_num_solves>0) {
+      *out << ", previous solve applied the preconditioner " << last_applies << " times";
+    }
+    switch (action) {
+      case Action::Rebuild: *out << ", rebuild (" << reason << ")\n"; break;
+      case Action::Refresh: *out << ", refresh\n"; break;
+      case Action::Lag:     *out << ", lag\n"; break;
+    }
+  }
+
+  *m_num_applies = 0;
+  ++m_solves_since_rebuild;
+  ++m_num_solves;
+}
+
+void ReusePreconditionerFactory::
+uninitializePrec (Thyra::PreconditionerBase<ST>* /* prec */,
+                  Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+                  Thyra::ESupportSolveUse* supportSolveUse) const
+{
+  // Keep the preconditioner: it may be reused by the next initializePrec call
+  if (fwdOpSrc!=nullptr) {
+    *fwdOpSrc = Teuchos::null;
+  }
+  if (supportSolveUse!=nullptr) {
+    *supportSolveUse = Thyra::SUPPORT_SOLVE_UNSPECIFIED;
+  }
+}
+
+void ReusePreconditionerFactory::printStatistics () const
+{
+  auto out = Teuchos::VerboseObjectBase::getDefaultOStream();
+  *out << "Albany Reuse preconditioner statistics:\n"
+       << "  solves:    " << m_num_solves << "\n"
+       << "  rebuilds:  " << m_num_rebuilds << "\n"
+       << "  refreshes: " << m_num_refreshes << "\n"
+       << "  lags:      " << m_num_lags << "\n"
+       << "  average preconditioner applications per solve: "
+       << static_cast<double>(m_total_applies+*m_num_applies)/m_num_solves << "\n";
+}
+
+void ReusePreconditionerFactory::
+setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& pl)
+{
+  pl->validateParametersAndSetDefaults(*getValidParameters(),0);
+  paramList = pl;
+
+  m_refresh              = pl->get<std::string>("Reuse Type")=="Refresh";
+  m_rebuild_every_solves = pl->get<int>("Rebuild Every N Solves");
+  m_rebuild_every_steps  = pl->get<int>("Rebuild Every N Steps");
+  m_iter_growth          = pl->get<double>("Rebuild Iteration Growth");
+  m_print_stats          = pl->get<bool>("Print Statistics");
+  m_print_solve_stats    = pl->get<bool>("Print Per Solve Statistics");
+
+  // Build the inner factory from a list laid out like the Stratimikos one
+  auto innerParams = Teuchos::rcp(new Teuchos::ParameterList("Inner Preconditioner"));
+  innerParams->set("Preconditioner Type",pl->get<std::string>("Preconditioner Type"));
+  innerParams->set("Preconditioner Types",pl->sublist("Preconditioner Types"));
+  m_inner_factory = m_inner_builder(innerParams);
+  m_inner_prec = Teuchos::null;
+  m_prec = nullptr;
+}
+
+Teuchos::RCP<Teuchos::ParameterList> ReusePreconditionerFactory::
+getNonconstParameterList ()
+{
+  return paramList;
+}
+
+Teuchos::RCP<Teuchos::ParameterList> ReusePreconditionerFactory::
+unsetParameterList ()
+{
+  auto old = paramList;
+  paramList = Teuchos::null;
+  return old;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList> ReusePreconditionerFactory::
+getParameterList () const
+{
+  if (paramList.is_null()) {
+    return getValidParameters();
+  }
+  return paramList;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList> ReusePreconditionerFactory::
+getValidParameters () const
+{
+  static Teuchos::RCP<Teuchos::ParameterList> validPL;
+  if (validPL.is_null()) {
+    validPL = Teuchos::rcp(new Teuchos::ParameterList("Albany Reuse"));
+    validPL->set<std::string>("Preconditioner Type", "Ifpack2", "Type of the wrapped preconditioner");
+    validPL->sublist("Preconditioner Types", false, "Parameters of the wrapped preconditioner, as in Stratimikos").disableRecursiveValidation();
+    Teuchos::setStringToIntegralParameter<int>(
+        "Reuse Type", "Lag",
+        "What to do with the preconditioner when it is not rebuilt: 'Lag' keeps it as it is, "
+        "'Refresh' re-initializes it, reusing its structure if the wrapped preconditioner supports it",
+        Teuchos::tuple<std::string>("Lag","Refresh"), validPL.get());
+    validPL->set<int>("Rebuild Every N Solves", 0, "Rebuild after this many solves (0: never)");
+    validPL->set<int>("Rebuild Every N Steps", 1, "Rebuild after this many time steps (0: never)");
+    validPL->set<double>("Rebuild Iteration Growth", 0.0,
+        "Rebuild when a solve needs more than this factor times the preconditioner applications "
+        "of the first solve after the last rebuild (0: never)");
+    validPL->set<bool>("Print Statistics", true, "Print a summary of the reuse statistics at the end");
+    validPL->set<bool>("Print Per Solve Statistics", false, "Print the action taken at each solve");
+  }
+  return validPL;
+}
+
+std::string ReusePreconditionerFactory::
+description () const
+{
+  return "Albany::ReusePreconditionerFactory";
+}
+
+} // namespace Albany
@@ -0,0 +1,137 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_REUSE_PRECONDITIONER_HPP
+#define ALBANY_REUSE_PRECONDITIONER_HPP
+
+#include "Albany_ThyraTypes.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+#include <functional>
+
+namespace Albany {
+
+/*
+ * A Stratimikos preconditioner factory that wraps another preconditioner
+ * factory (Ifpack2, MueLu,...), and decides, every time the preconditioner
+ * is (re)initialized with a new Jacobian, whether to
+ *
+ *  - rebuild it from scratch (the inner preconditioner is recreated),
+ *  - refresh it: the inner preconditioner is re-initialized, keeping its
+ *    structure if the inner factory supports it (e.g., MueLu with a
+ *    'reuse: type' other than 'none' only recomputes the numeric values
+ *    of the hierarchy; Ifpack2 only recomputes the factorization),
+ *  - lag it: the preconditioner of a previous Jacobian is used as is.
+ *
+ * A rebuild happens on the first solve, every N solves (i.e., Newton
+ * iterations), every N time steps, or when the number of applications of
+ * the preconditioner in the last solve (a proxy for the linear iterations)
+ * grew past a given factor of the one of the first solve after the last
+ * rebuild. Otherwise, the preconditioner is refreshed or lagged, depending
+ * on 'Reuse Type'.
+ *
+ *   Preconditioner Type: Albany Reuse
+ *   Preconditioner Types:
+ *     Albany Reuse:
+ *       Preconditioner Type: MueLu
+ *       Preconditioner Types: {MueLu: {...}}
+ *       Reuse Type: Lag
+ *       Rebuild Every N Solves: 0
+ *       Rebuild Every N Steps: 1
+ *       Rebuild Iteration Growth: 2.0
+ *       Print Statistics: true
+ *       Print Per Solve Statistics: false
+ *
+ * Time steps are not visible from the linear solver: the factory reads the
+ * step count of its application, which the application's observer
+ * advances at the end of each step (see Application::notifyStepCompleted).
+ * Without a step count, 'Rebuild Every N Steps' has no effect.
+ */
+
+class ReusePreconditionerFactory : public Thyra::PreconditionerFactoryBase<ST>
+{
+public:
+  using prec_factory_type = Thyra::PreconditionerFactoryBase<ST>;
+
+  // Given the 'Preconditioner Type' and 'Preconditioner Types' parameters,
+  // build the inner preconditioner factory.
+  using inner_builder_type =
+    std::function<Teuchos::RCP<prec_factory_type>(const Teuchos::RCP<Teuchos::ParameterList>&)>;
+
+  ReusePreconditionerFactory (const inner_builder_type& innerBuilder,
+                              const Teuchos::RCP<const int>& completed_steps = Teuchos::null);
+  ~ReusePreconditionerFactory ();
+
+  // Thyra::PreconditionerFactoryBase overrides
+  bool isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const override;
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>> createPrec () const override;
+
+  void initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                       Thyra::PreconditionerBase<ST>* prec,
+                       const Thyra::ESupportSolveUse supportSolveUse) const override;
+
+  void uninitializePrec (Thyra::PreconditionerBase<ST>* prec,
+                         Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+                         Thyra::ESupportSolveUse* supportSolveUse) const override;
+
+  // Teuchos::ParameterListAcceptor overrides
+  void setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& paramList) override;
+  Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList () override;
+  Teuchos::RCP<Teuchos::ParameterList> unsetParameterList () override;
+  Teuchos::RCP<const Teuchos::ParameterList> getParameterList () const override;
+  Teuchos::RCP<const Teuchos::ParameterList> getValidParameters () const override;
+
+  std::string description () const override;
+
+private:
+  enum class Action { Rebuild, Refresh, Lag };
+
+  Action chooseAction (const Thyra::PreconditionerBase<ST>* prec, std::string& reason) const;
+
+  void printStatistics () const;
+
+  // Number of time (or continuation) steps completed so far
+  int completedSteps () const;
+
+  inner_builder_type                    m_inner_builder;
+  Teuchos::RCP<const int>               m_completed_steps;
+  Teuchos::RCP<Teuchos::ParameterList>  paramList;
+
+  // Policy
+  bool    m_refresh             = false;
+  int     m_rebuild_every_solves = 0;
+  int     m_rebuild_every_steps  = 1;
+  double  m_iter_growth          = 0;
+  bool    m_print_stats          = true;
+  bool    m_print_solve_stats    = false;
+
+  // The inner factory and preconditioner, and the preconditioner they back
+  mutable Teuchos::RCP<prec_factory_type>             m_inner_factory;
+  mutable Teuchos::RCP<Thyra::PreconditionerBase<ST>> m_inner_prec;
+  mutable const Thyra::PreconditionerBase<ST>*        m_prec = nullptr;
+
+  // Applications of the preconditioner since the last initializePrec call
+  Teuchos::RCP<int>   m_num_applies;
+
+  // State since the last rebuild
+  mutable int   m_solves_since_rebuild  = 0;
+  mutable int   m_step_at_rebuild       = 0;
+  mutable int   m_baseline_applies      = -1;
+
+  // Statistics
+  mutable int   m_num_solves    = 0;
+  mutable int   m_num_rebuilds  = 0;
+  mutable int   m_num_refreshes = 0;
+  mutable int   m_num_lags      = 0;
+  mutable long  m_total_applies = 0;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_REUSE_PRECONDITIONER_HPP
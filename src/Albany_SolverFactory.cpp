@@ -11,6 +11,7 @@
 #include "Albany_Utils.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_Macros.hpp"
+#include "Albany_ReusePreconditioner.hpp"
 
 #ifdef ALBANY_ATO
 #include "ATO_Solver.hpp"
@@ -36,6 +37,7 @@
 #ifdef ALBANY_IFPACK2
 #include "Teuchos_AbstractFactoryStd.hpp"
 #include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#include "Albany_MixedPrecisionPreconditioner.hpp"
 #endif /* ALBANY_IFPACK2 */
 
 #ifdef ALBANY_MUELU
@@ -50,6 +52,7 @@
 #include "Teko_StratimikosFactory.hpp"
 #endif
 
+#include "Teuchos_AbstractFactory.hpp"
 #include "Thyra_DefaultModelEvaluatorWithSolveFactory.hpp"
 #include "Thyra_DetachedVectorView.hpp"
 
@@ -71,6 +74,11 @@ enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder)
   typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
   linearSolverBuilder.setPreconditioningStrategyFactory(
       Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+
+  // Ifpack2 preconditioner built on a float copy of the Jacobian
+  typedef Albany::MixedPrecisionPreconditionerFactory MixedImpl;
+  linearSolverBuilder.setPreconditioningStrategyFactory(
+      Teuchos::abstractFactoryStd<Base, MixedImpl>(), "Albany Mixed Precision");
 #endif
 }
 
@@ -90,6 +98,50 @@ enableFROSch(Stratimikos::DefaultLinearSolverBuilder&    linearSolverBuilder)
     Stratimikos::enableFROSch<LO,Tpetra_GO, KokkosNode>(linearSolverBuilder);
 #endif
 }
+
+// Builds the preconditioner factory wrapped by Albany::ReusePreconditionerFactory
+Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>
+createReusedPrecFactory(const Teuchos::RCP<Teuchos::ParameterList>& params)
+{
+  Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
+  enableIfpack2(linearSolverBuilder);
+  enableMueLu(linearSolverBuilder);
+  enableFROSch(linearSolverBuilder);
+  linearSolverBuilder.setParameterList(params);
+  return linearSolverBuilder.createPreconditioningStrategy("");
+}
+
+class ReusePrecAbstractFactory
+    : public Teuchos::AbstractFactory<Thyra::PreconditionerFactoryBase<ST>>
+{
+ public:
+  ReusePrecAbstractFactory(Teuchos::RCP<const int> const& completedSteps)
+      : completedSteps_(completedSteps)
+  {
+  }
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>
+  create() const override
+  {
+    return Teuchos::rcp(new Albany::ReusePreconditionerFactory(
+        &createReusedPrecFactory, completedSteps_));
+  }
+
+ private:
+  Teuchos::RCP<const int> completedSteps_;
+};
+
+void
+enableReusePrec(
+    Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder,
+    Teuchos::RCP<const int> const&           completedSteps)
+{
+  // Wraps any of the above, lagging/refreshing it across solves. Steps are
+  // counted by the application whose observer advances completedSteps.
+  linearSolverBuilder.setPreconditioningStrategyFactory(
+      Teuchos::rcp(new ReusePrecAbstractFactory(completedSteps)),
+      "Albany Reuse");
+}
 }  // namespace
 
 namespace Albany
@@ -374,6 +426,7 @@ SolverFactory::createAndGetAlbanyApp(
     enableIfpack2(linearSolverBuilder);
     enableMueLu(linearSolverBuilder);
     enableFROSch(linearSolverBuilder);
+    enableReusePrec(linearSolverBuilder, albanyApp->getCompletedSteps());
 #ifdef ALBANY_TEKO
     Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
 #endif
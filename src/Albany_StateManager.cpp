@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 #include "Albany_StateManager.hpp"
+#include <algorithm>
 #include "Albany_Utils.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -675,6 +676,8 @@ Albany::StateManager::importStateData(Albany::StateArrays& states_from)
 {
   ALBANY_ASSERT(stateVarsAreAllocated == true);
 
+  ++stateVersion;
+
   // Get states from STK mesh
   Albany::StateArrays&   sa                   = getStateArrays();
   Albany::StateArrayVec& esa                  = sa.elemStateArrays;
@@ -840,6 +843,7 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
 {
   ALBANY_ASSERT(stateVarsAreAllocated == true);
   disc->setStateArrays(sa);
+  ++stateVersion;
   return;
 }
 
@@ -857,6 +861,14 @@ Albany::StateManager::updateStates()
   int                    numElemWorksets = esa.size();
   int                    numNodeWorksets = nsa.size();
 
+  // Save the old states before they are overwritten for the first time
+  // after a snapshot.
+  if (snapshotOpen == true && snapshotSaved == false) {
+    copyOldStates(true);
+    snapshotSaved = true;
+  }
+  ++stateVersion;
+
   // For each workset, loop over registered states
 
   for (unsigned int i = 0; i < stateInfo->size(); i++) {
@@ -904,6 +916,84 @@ Albany::StateManager::updateStates()
   }
 }
 
+void
+Albany::StateManager::snapshotStates()
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+  snapshotOpen  = true;
+  snapshotSaved = false;
+}
+
+void
+Albany::StateManager::rollbackStates()
+{
+  ALBANY_ASSERT(snapshotOpen == true, "No state snapshot to roll back to");
+  if (snapshotSaved == false) return;
+  copyOldStates(false);
+  ++stateVersion;
+}
+
+void
+Albany::StateManager::commitStates()
+{
+  snapshotOpen  = false;
+  snapshotSaved = false;
+}
+
+void
+Albany::StateManager::copyOldStates(bool const toSnapshot)
+{
+  Albany::StateArrays&   sa  = disc->getStateArrays();
+  Albany::StateArrayVec& esa = sa.elemStateArrays;
+  Albany::StateArrayVec& nsa = sa.nodeStateArrays;
+
+  int block = 0;
+
+  auto const copy = [&](Albany::MDArray& old_state) {
+    if (toSnapshot == true && block == snapshotData.size()) {
+      snapshotData.emplace_back();
+    }
+    auto&      buffer = snapshotData[block++];
+    auto const size   = old_state.size();
+    double*    data   = old_state.contiguous_data();
+    if (toSnapshot == true) {
+      buffer.assign(data, data + size);
+    } else {
+      TEUCHOS_TEST_FOR_EXCEPT(buffer.size() != size);
+      std::copy(buffer.begin(), buffer.end(), data);
+    }
+  };
+
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    if ((*stateInfo)[i]->saveOldState == false) continue;
+
+    const std::string stateName_old = (*stateInfo)[i]->name + "_old";
+
+    switch ((*stateInfo)[i]->entity) {
+      case Albany::StateStruct::WorksetValue:
+      case Albany::StateStruct::ElemData:
+      case Albany::StateStruct::QuadPoint:
+      case Albany::StateStruct::ElemNode:
+        for (int ws = 0; ws < esa.size(); ws++) copy(esa[ws][stateName_old]);
+        break;
+
+      case Albany::StateStruct::NodalDataToElemNode:
+      case Albany::StateStruct::NodalData:
+        for (int ws = 0; ws < nsa.size(); ws++) copy(nsa[ws][stateName_old]);
+        break;
+
+      default:
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            true,
+            std::logic_error,
+            "Error: Cannot match state entity : " << (*stateInfo)[i]->entity
+                                                  << " in state manager. "
+                                                  << std::endl);
+        break;
+    }
+  }
+}
+
 #if defined(ALBANY_EPETRA)
 Teuchos::RCP<Albany::EigendataStruct>
 Albany::StateManager::getEigenData()
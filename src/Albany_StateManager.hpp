@@ -201,6 +201,36 @@ class StateManager
   void
   updateStates();
 
+  /// Open a snapshot of the history (old) states. Nothing is copied here:
+  /// the old states are saved the first time updateStates() is about to
+  /// overwrite them, which is the only place they change. States without
+  /// an old counterpart are recomputed at every evaluation and are not
+  /// part of the snapshot.
+  void
+  snapshotStates();
+
+  /// Restore the old states to the open snapshot. Does nothing if they
+  /// have not been updated since. The snapshot remains open.
+  void
+  rollbackStates();
+
+  /// Close the snapshot. The saved data are kept for reuse.
+  void
+  commitStates();
+
+  bool
+  hasStateSnapshot() const
+  {
+    return snapshotOpen;
+  }
+
+  /// Incremented every time the old states change.
+  int
+  getStateVersion() const
+  {
+    return stateVersion;
+  }
+
   /// Method to get a StateInfoStruct of info needed by STK to output States as
   /// Fields
   Teuchos::RCP<Albany::StateInfoStruct>
@@ -290,10 +320,20 @@ class StateManager
       const Teuchos::RCP<Albany::AbstractDiscretization>& disc,
       const Teuchos::RCP<StateInfoStruct>&                stateInfoPtr);
 
+  /// Copy the old states to or from the snapshot buffers
+  void
+  copyOldStates(bool toSnapshot);
+
   /// boolean to enforce that allocate gets called once, and after registration
   /// and befor gets
   bool stateVarsAreAllocated;
 
+  /// Snapshot of the old states, one buffer per state and workset
+  bool                             snapshotOpen{false};
+  bool                             snapshotSaved{false};
+  int                              stateVersion{0};
+  std::vector<std::vector<double>> snapshotData;
+
   /// Container to hold the states that have been registered, by element block,
   /// to be allocated later
   std::map<std::string, RegisteredStates> statesToStore;
@@ -15,6 +15,7 @@
 #include "Teuchos_ParameterList.hpp"
 
 #include <vector>
+#include "Albany_TimeTable.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Dirichlet.hpp"
 #include "Sacado_ParameterAccessor.hpp"
@@ -49,10 +50,8 @@ class KfieldBC_Base : public PHAL::DirichletBase<EvalT, Traits>
   std::string KI_name, KII_name;
 
  protected:
-  const int             offset;
-  std::vector<RealType> timeValues;
-  std::vector<RealType> KIValues;
-  std::vector<RealType> KIIValues;
+  const int         offset;
+  Albany::TimeTable timeTable;  // Columns: KI, KII
 };
 
 // **************************************************************
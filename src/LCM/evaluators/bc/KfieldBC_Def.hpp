@@ -39,9 +39,11 @@ KfieldBC_Base<EvalT, Traits>::KfieldBC_Base(Teuchos::ParameterList& p)
   this->registerSacadoParameter(KI_name, paramLib);
   this->registerSacadoParameter(KII_name, paramLib);
 
-  timeValues = p.get<Teuchos::Array<RealType>>("Time Values").toVector();
-  KIValues   = p.get<Teuchos::Array<RealType>>("KI Values").toVector();
-  KIIValues  = p.get<Teuchos::Array<RealType>>("KII Values").toVector();
+  auto const timeValues =
+      p.get<Teuchos::Array<RealType>>("Time Values").toVector();
+  auto const KIValues = p.get<Teuchos::Array<RealType>>("KI Values").toVector();
+  auto const KIIValues =
+      p.get<Teuchos::Array<RealType>>("KII Values").toVector();
 
   TEUCHOS_TEST_FOR_EXCEPTION(
       !(timeValues.size() == KIValues.size()),
@@ -52,6 +54,18 @@ KfieldBC_Base<EvalT, Traits>::KfieldBC_Base(Teuchos::ParameterList& p)
       !(timeValues.size() == KIIValues.size()),
       Teuchos::Exceptions::InvalidParameter,
       "Dimension of \"Time Values\" and \"KII Values\" do not match");
+
+  std::vector<RealType> values(2 * timeValues.size());
+  for (std::size_t i = 0; i < timeValues.size(); ++i) {
+    values[2 * i]     = KIValues[i];
+    values[2 * i + 1] = KIIValues[i];
+  }
+  timeTable = Albany::TimeTable(
+      timeValues,
+      values,
+      2,
+      Albany::TimeTable::interpolationFromString(
+          p.get<std::string>("Time Interpolation", "Linear")));
 }
 
 // **********************************************************************
@@ -75,11 +89,6 @@ KfieldBC_Base<EvalT, Traits>::computeBCs(
     ScalarT& Yval,
     RealType time)
 {
-  TEUCHOS_TEST_FOR_EXCEPTION(
-      time > timeValues.back(),
-      Teuchos::Exceptions::InvalidParameter,
-      "Time is growing unbounded!");
-
   RealType X, Y, R, theta;
   ScalarT  coeff_1, coeff_2;
   RealType tau = 6.283185307179586;
@@ -90,26 +99,11 @@ KfieldBC_Base<EvalT, Traits>::computeBCs(
   R     = std::sqrt(X * X + Y * Y);
   theta = std::atan2(Y, X);
 
-  ScalarT      KIFunctionVal, KIIFunctionVal;
-  RealType     KIslope, KIIslope;
-  unsigned int Index(0);
-
-  while (timeValues[Index] < time) Index++;
+  RealType KFunctionVals[2];
+  timeTable.evaluate(time, KFunctionVals);
 
-  if (Index == 0) {
-    KIFunctionVal  = KIValues[Index];
-    KIIFunctionVal = KIIValues[Index];
-  } else {
-    KIslope = (KIValues[Index] - KIValues[Index - 1]) /
-              (timeValues[Index] - timeValues[Index - 1]);
-    KIFunctionVal =
-        KIValues[Index - 1] + KIslope * (time - timeValues[Index - 1]);
-
-    KIIslope = (KIIValues[Index] - KIIValues[Index - 1]) /
-               (timeValues[Index] - timeValues[Index - 1]);
-    KIIFunctionVal =
-        KIIValues[Index - 1] + KIIslope * (time - timeValues[Index - 1]);
-  }
+  ScalarT const KIFunctionVal  = KFunctionVals[0];
+  ScalarT const KIIFunctionVal = KFunctionVals[1];
 
   coeff_1 = (KI * KIFunctionVal / mu) * std::sqrt(R / tau);
   coeff_2 = (KII * KIIFunctionVal / mu) * std::sqrt(R / tau);
@@ -16,8 +16,9 @@ RigidContactBC_Base<EvalT, Traits>::RigidContactBC_Base(
     Teuchos::ParameterList& p)
     : PHAL::Neumann<EvalT, Traits>(p)
 {
-  timeValues = p.get<Teuchos::Array<RealType>>("Time Values").toVector();
-  BCValues   = p.get<Teuchos::TwoDArray<RealType>>("BC Values");
+  auto const timeValues =
+      p.get<Teuchos::Array<RealType>>("Time Values").toVector();
+  auto const BCValues = p.get<Teuchos::TwoDArray<RealType>>("BC Values");
 
   if (this->bc_type == PHAL::NeumannBase<EvalT, Traits>::COORD)
 
@@ -30,6 +31,14 @@ RigidContactBC_Base<EvalT, Traits>::RigidContactBC_Base(
       !(timeValues.size() == BCValues.getNumRows()),
       Teuchos::Exceptions::InvalidParameter,
       "Dimension of \"Time Values\" and \"BC Values\" do not match");
+
+  // One row of BCValues per time
+  timeTable = Albany::TimeTable(
+      timeValues,
+      BCValues.getDataArray().toVector(),
+      BCValues.getNumCols(),
+      Albany::TimeTable::interpolationFromString(
+          p.get<std::string>("Time Interpolation", "Linear")));
 }
 
 //**********************************************************************
@@ -37,24 +46,7 @@ template <typename EvalT, typename Traits>
 void
 RigidContactBC_Base<EvalT, Traits>::computeVal(RealType time)
 {
-  TEUCHOS_TEST_FOR_EXCEPTION(
-      time > timeValues.back(),
-      Teuchos::Exceptions::InvalidParameter,
-      "Time is growing unbounded!");
-  ScalarT      Val;
-  RealType     slope;
-  unsigned int Index(0);
-
-  while (timeValues[Index] < time) Index++;
-
-  if (Index == 0)
-    this->const_val = BCValues(0, Index);
-  else {
-    slope = (BCValues(0, Index) - BCValues(0, Index - 1)) /
-            (timeValues[Index] - timeValues[Index - 1]);
-    this->const_val =
-        BCValues(0, Index - 1) + slope * (time - timeValues[Index - 1]);
-  }
+  this->const_val = timeTable.evaluate(time);
 
   return;
 }
@@ -63,27 +55,8 @@ template <typename EvalT, typename Traits>
 void
 RigidContactBC_Base<EvalT, Traits>::computeCoordVal(RealType time)
 {
-  TEUCHOS_TEST_FOR_EXCEPTION(
-      time > timeValues.back(),
-      Teuchos::Exceptions::InvalidParameter,
-      "Time is growing unbounded!");
-  ScalarT      Val;
-  RealType     slope;
-  unsigned int Index(0);
-
-  while (timeValues[Index] < time) Index++;
-
-  if (Index == 0)
-    for (int dim = 0; dim < this->cellDims; dim++)
-      this->dudx[dim] = BCValues(dim, Index);
-  else {
-    for (size_t dim = 0; dim < this->cellDims; dim++) {
-      slope = (BCValues(dim, Index) - BCValues(dim, Index - 1)) /
-              (timeValues[Index] - timeValues[Index - 1]);
-      this->dudx[dim] =
-          BCValues(dim, Index - 1) + slope * (time - timeValues[Index - 1]);
-    }
-  }
+  for (int dim = 0; dim < this->cellDims; dim++)
+    this->dudx[dim] = timeTable.evaluate(time, dim);
 
   return;
 }
@@ -0,0 +1,54 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_SchwarzInterpolation_hpp)
+#define LCM_SchwarzInterpolation_hpp
+
+#include <string>
+#include <vector>
+
+#include "Albany_Application.hpp"
+
+namespace LCM {
+
+///
+/// Locate a point inside the elements of coupled_block_name ("NONE" for
+/// any block) that this rank holds for the coupled application. On
+/// success coupled_nodes and weights are as below and true is returned;
+/// false if no element here contains the point.
+///
+bool
+locateSchwarzPoint(
+    Albany::Application const& coupled_app,
+    std::string const&         coupled_block_name,
+    double const* const        coord,
+    std::vector<LO>&           coupled_nodes,
+    std::vector<double>&       weights);
+
+///
+/// Locate a node of the Schwarz node set of this application inside
+/// the coupled application. On return coupled_nodes holds the local
+/// ids, in the coupled overlap node space, of the nodes of the coupled
+/// element that contains the point, and weights holds the coupled
+/// basis functions evaluated there. The Schwarz boundary value is
+///
+///   u(ns_node) = sum_i weights[i] * u_coupled(coupled_nodes[i]),
+///
+/// so the same weights are the sensitivity of the Schwarz BC rows with
+/// respect to the coupled solution.
+///
+void
+findSchwarzInterpolation(
+    Albany::Application const& this_app,
+    Albany::Application const& coupled_app,
+    int const                  coupled_app_index,
+    size_t const               ns_node,
+    std::vector<LO>&           coupled_nodes,
+    std::vector<double>&       weights);
+
+}  // namespace LCM
+
+#endif  // LCM_SchwarzInterpolation_hpp
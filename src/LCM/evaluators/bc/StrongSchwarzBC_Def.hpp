@@ -601,6 +601,39 @@ fillSolution(StrongSchwarzBC& sbc, typename Traits::EvalData dirichlet_workset)
 
   auto const ns_number_nodes = ns_nodes.size();
 
+  // The coupled application lives on other ranks and its boundary values
+  // were sent to this one.
+  auto const coupled_app_index = sbc.getCoupledAppIndex();
+
+  if (sbc.app_->hasSchwarzBoundaryValues(coupled_app_index) == true) {
+    auto const& values = sbc.app_->getSchwarzBoundaryValues(coupled_app_index);
+
+    ALBANY_ASSERT(
+        values.empty() == false && values[0].size() == 3 * ns_number_nodes,
+        "Received Schwarz boundary values do not match the node set.");
+
+    bool const set_velo = has_velo == true && values.size() > 1;
+
+    bool const set_acce = has_acce == true && values.size() > 2;
+
+    std::set<int> const& fixed_dofs = dirichlet_workset.fixed_dofs_;
+
+    for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
+      for (auto i = 0; i < 3; ++i) {
+        auto const dof = ns_nodes[ns_node][i];
+
+        if (fixed_dofs.find(dof) != fixed_dofs.end()) continue;
+
+        auto const k = 3 * ns_node + i;
+
+        disp_view[dof] = values[0][k];
+        if (set_velo == true) { velo_view[dof] = values[1][k]; }
+        if (set_acce == true) { acce_view[dof] = values[2][k]; }
+      }
+    }
+    return;
+  }
+
 #if defined(ALBANY_DTK)
 
   Teuchos::Array<Teuchos::RCP<
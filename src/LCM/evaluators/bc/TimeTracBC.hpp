@@ -7,6 +7,7 @@
 #ifndef TIMETRACBC_HPP
 #define TIMETRACBC_HPP
 
+#include "Albany_TimeTable.hpp"
 #include "PHAL_Neumann.hpp"
 
 #include "Teuchos_TwoDArray.hpp"
@@ -32,8 +33,7 @@ class TimeTracBC_Base : public PHAL::Neumann<EvalT, Traits>
   computeCoordVal(RealType time);
 
  protected:
-  std::vector<RealType>        timeValues;
-  Teuchos::TwoDArray<RealType> BCValues;
+  Albany::TimeTable timeTable;
 };
 
 template <typename EvalT, typename Traits>
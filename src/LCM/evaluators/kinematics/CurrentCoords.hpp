@@ -52,6 +52,18 @@ class CurrentCoords : public PHX::EvaluatorWithBaseImpl<Traits>,
   unsigned int worksetSize;
   unsigned int numNodes;
   unsigned int numDims;
+
+ public:  // Kokkos
+  template <int N>
+  struct current_coords_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(current_coords_Tag<N> const& tag, int const& cell) const;
 };
 }  // namespace LCM
 
@@ -50,16 +50,52 @@ CurrentCoords<EvalT, Traits>::postRegistrationSetup(
   this->utils.setFieldData(currentCoords, fm);
 }
 
+//**********************************************************************
+template <typename EvalT, typename Traits>
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+CurrentCoords<EvalT, Traits>::operator()(
+    current_coords_Tag<N> const& tag,
+    int const&                   cell) const
+{
+  for (int node = 0; node < numNodes; ++node)
+    for (int dim = 0; dim < N; ++dim)
+      currentCoords(cell, node, dim) =
+          refCoords(cell, node, dim) + displacement(cell, node, dim);
+}
+
 //**********************************************************************
 template <typename EvalT, typename Traits>
 void
 CurrentCoords<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  for (int cell = 0; cell < workset.numCells; ++cell)
-    for (int node = 0; node < numNodes; ++node)
-      for (int dim = 0; dim < numDims; ++dim)
-        currentCoords(cell, node, dim) =
-            refCoords(cell, node, dim) + displacement(cell, node, dim);
+  switch (numDims) {
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::invalid_argument,
+          "Error(LCM CurrentCoords): invalid number of spatial dimensions: "
+              << numDims << '\n');
+      break;
+    case 1:
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<ExecutionSpace, current_coords_Tag<1>>(
+              0, workset.numCells),
+          *this);
+      break;
+    case 2:
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<ExecutionSpace, current_coords_Tag<2>>(
+              0, workset.numCells),
+          *this);
+      break;
+    case 3:
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<ExecutionSpace, current_coords_Tag<3>>(
+              0, workset.numCells),
+          *this);
+      break;
+  }
 }
 
 //**********************************************************************
@@ -58,6 +58,32 @@ class DefGrad : public PHX::EvaluatorWithBaseImpl<Traits>,
 
   //! stabilization parameter for the weighted average
   ScalarT alpha;
+
+  //! number of cells in the current workset
+  int numCells;
+
+  template <int N>
+  void
+  evaluateFieldsDim(typename Traits::EvalData d);
+
+ public:  // Kokkos
+  template <int N>
+  struct def_grad_Tag
+  {
+  };
+  template <int N>
+  struct weighted_average_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(def_grad_Tag<N> const& tag, int const& cell) const;
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(weighted_average_Tag<N> const& tag, int const& cell) const;
 };
 }  // namespace LCM
 #endif
@@ -29,7 +29,8 @@ DefGrad<EvalT, Traits>::DefGrad(const Teuchos::ParameterList& p)
       J(p.get<std::string>("DetDefGrad Name"),
         p.get<Teuchos::RCP<PHX::DataLayout>>("QP Scalar Data Layout")),
       weightedAverage(false),
-      alpha(0.05)
+      alpha(0.05),
+      numCells(0)
 {
   if (p.isType<bool>("Weighted Volume Average J"))
     weightedAverage = p.get<bool>("Weighted Volume Average J");
@@ -68,56 +69,94 @@ DefGrad<EvalT, Traits>::postRegistrationSetup(
 }
 //**********************************************************************
 template <typename EvalT, typename Traits>
-void
-DefGrad<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+DefGrad<EvalT, Traits>::operator()(def_grad_Tag<N> const& tag, int const& cell)
+    const
 {
-  // bool print = false;
-  // if (typeid(ScalarT) == typeid(RealType)) print = true;
+  // Since Intrepid2 will later perform calculations on the entire workset size
+  // and not just the used portion, we must fill the excess with reasonable
+  // values. Leaving this out leads to inversion of 0 tensors.
+  if (cell >= numCells) {
+    for (int qp = 0; qp < numQPs; ++qp) {
+      for (int i = 0; i < N; ++i) { defgrad(cell, qp, i, i) = 1.0; }
+    }
+    return;
+  }
 
   // Compute DefGrad tensor from displacement gradient
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int qp = 0; qp < numQPs; ++qp) {
-      for (int i = 0; i < numDims; ++i) {
-        for (int j = 0; j < numDims; ++j) {
-          defgrad(cell, qp, i, j) = GradU(cell, qp, i, j);
-        }
-        defgrad(cell, qp, i, i) += 1.0;
+  for (int qp = 0; qp < numQPs; ++qp) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        defgrad(cell, qp, i, j) = GradU(cell, qp, i, j);
       }
+      defgrad(cell, qp, i, i) += 1.0;
     }
   }
-  // Since Intrepid2 will later perform calculations on the entire workset size
-  // and not just the used portion, we must fill the excess with reasonable
-  // values. Leaving this out leads to inversion of 0 tensors.
-  for (int cell = workset.numCells; cell < worksetSize; ++cell) {
-    for (int qp = 0; qp < numQPs; ++qp) {
-      for (int i = 0; i < numDims; ++i) { defgrad(cell, qp, i, i) = 1.0; }
+}
+
+template <typename EvalT, typename Traits>
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+DefGrad<EvalT, Traits>::operator()(
+    weighted_average_Tag<N> const& tag,
+    int const&                     cell) const
+{
+  ScalarT Jbar(0.0), vol(0.0);
+  for (int qp = 0; qp < numQPs; ++qp) {
+    Jbar += weights(cell, qp) * J(cell, qp);
+    vol += weights(cell, qp);
+  }
+  Jbar /= vol;
+
+  for (int qp = 0; qp < numQPs; ++qp) {
+    ScalarT const wJbar =
+        std::exp((1 - alpha) * std::log(Jbar) + alpha * std::log(J(cell, qp)));
+    ScalarT const factor = std::cbrt(wJbar / J(cell, qp));
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) { defgrad(cell, qp, i, j) *= factor; }
     }
+    J(cell, qp) = wJbar;
   }
+}
+
+//**********************************************************************
+template <typename EvalT, typename Traits>
+template <int N>
+void
+DefGrad<EvalT, Traits>::evaluateFieldsDim(typename Traits::EvalData workset)
+{
+  numCells = workset.numCells;
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace, def_grad_Tag<N>>(0, worksetSize),
+      *this);
 
   Intrepid2::RealSpaceTools<PHX::Device>::det(J.get_view(), defgrad.get_view());
 
   if (weightedAverage) {
-    ScalarT Jbar, wJbar, vol;
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      Jbar = 0.0;
-      vol  = 0.0;
-      for (int qp = 0; qp < numQPs; ++qp) {
-        Jbar += weights(cell, qp) * J(cell, qp);
-        vol += weights(cell, qp);
-      }
-      Jbar /= vol;
-
-      for (int qp = 0; qp < numQPs; ++qp) {
-        for (int i = 0; i < numDims; ++i) {
-          for (int j = 0; j < numDims; ++j) {
-            wJbar = std::exp(
-                (1 - alpha) * std::log(Jbar) + alpha * std::log(J(cell, qp)));
-            defgrad(cell, qp, i, j) *= std::cbrt(wJbar / J(cell, qp));
-          }
-        }
-        J(cell, qp) = wJbar;
-      }
-    }
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace, weighted_average_Tag<N>>(
+            0, workset.numCells),
+        *this);
+  }
+}
+
+template <typename EvalT, typename Traits>
+void
+DefGrad<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  switch (numDims) {
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::invalid_argument,
+          "Error(LCM DefGrad): invalid number of spatial dimensions: "
+              << numDims << '\n');
+      break;
+    case 1: evaluateFieldsDim<1>(workset); break;
+    case 2: evaluateFieldsDim<2>(workset); break;
+    case 3: evaluateFieldsDim<3>(workset); break;
   }
 }
 
@@ -117,6 +117,7 @@ class FirstPK : public PHX::EvaluatorWithBaseImpl<Traits>,
   struct small_strain_Tag
   {
   };
+  template <int N>
   struct no_small_strain_Tag
   {
   };
@@ -129,8 +130,9 @@ class FirstPK : public PHX::EvaluatorWithBaseImpl<Traits>,
       have_pore_pressure_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace, small_strain_Tag>
       small_strain_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace, no_small_strain_Tag>
-      no_small_strain_Policy;
+  template <int N>
+  using no_small_strain_Policy =
+      Kokkos::RangePolicy<ExecutionSpace, no_small_strain_Tag<N>>;
 
   KOKKOS_INLINE_FUNCTION
   void
@@ -141,9 +143,9 @@ class FirstPK : public PHX::EvaluatorWithBaseImpl<Traits>,
   KOKKOS_INLINE_FUNCTION
   void
   operator()(const small_strain_Tag& tag, const int& i) const;
-  KOKKOS_INLINE_FUNCTION
-  void
-  operator()(const no_small_strain_Tag& tag, const int& i) const;
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(const no_small_strain_Tag<N>& tag, const int& i) const;
 };
 }  // namespace LCM
 
@@ -120,22 +120,24 @@ FirstPK<EvalT, Traits>::operator()(
 }
 
 template <typename EvalT, typename Traits>
+template <int N>
 KOKKOS_INLINE_FUNCTION void
 FirstPK<EvalT, Traits>::operator()(
-    const no_small_strain_Tag& tag,
-    const int&                 cell) const
+    const no_small_strain_Tag<N>& tag,
+    const int&                    cell) const
 {
   ScalarT sig[3][3], F[3][3], P[3][3];
   for (int pt = 0; pt < num_pts_; ++pt) {
-    for (int i = 0; i < num_dims_; ++i)
-      for (int j = 0; j < num_dims_; ++j) {
+    for (int i = 0; i < N; ++i)
+      for (int j = 0; j < N; ++j) {
         F[i][j]   = def_grad_(cell, pt, i, j);
         sig[i][j] = first_pk_stress_(cell, pt, i, j);
       }
 
     // Replacement for piola(P, F, sig) for GPU, I think.
     // todo Can we go back to the MiniTensor function?
-    switch (num_dims_) {
+    // The dimension is a template parameter, so only one branch survives.
+    switch (N) {
       default:
         Kokkos::abort(
             "Error(LCM FirstPK): piola function is defined only for rank-2 or "
@@ -183,9 +185,8 @@ FirstPK<EvalT, Traits>::operator()(
         break;
     }
 
-    for (int i = 0; i < num_dims_; ++i)
-      for (int j = 0; j < num_dims_; ++j)
-        first_pk_stress_(cell, pt, i, j) = P[i][j];
+    for (int i = 0; i < N; ++i)
+      for (int j = 0; j < N; ++j) first_pk_stress_(cell, pt, i, j) = P[i][j];
   }
 }
 
@@ -206,7 +207,23 @@ FirstPK<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
   if (!small_strain_) {
     // For large deformation, map Cauchy stress to 1st PK stress. In the
     // small-strain case, this transformation is Identity.
-    Kokkos::parallel_for(no_small_strain_Policy(0, workset.numCells), *this);
+    switch (num_dims_) {
+      default:
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            true,
+            std::invalid_argument,
+            "Error(LCM FirstPK): piola function is defined only for rank-2 "
+            "or 3.\n");
+        break;
+      case 2:
+        Kokkos::parallel_for(
+            no_small_strain_Policy<2>(0, workset.numCells), *this);
+        break;
+      case 3:
+        Kokkos::parallel_for(
+            no_small_strain_Policy<3>(0, workset.numCells), *this);
+        break;
+    }
   }
 #ifdef ALBANY_TIMER
   PHX::Device::fence();
@@ -94,8 +94,50 @@ class Kinematics : public PHX::EvaluatorWithBaseImpl<Traits>,
   AAdapt::rc::Field<2> def_grad_rc_;
   // For debugging.
   PHX::MDField<const ScalarT, Cell, Vertex, Dim> u_;
+
+  template <int N>
   bool
   check_det(typename Traits::EvalData d, int cell, int pt);
+
+  ///
+  /// Evaluate with the spatial dimension known at compile time
+  ///
+  template <int N>
+  void
+  evaluateFieldsDim(typename Traits::EvalData d);
+
+ public:  // Kokkos
+  template <int N>
+  struct def_grad_Tag
+  {
+  };
+  template <int N>
+  struct weighted_average_Tag
+  {
+  };
+  template <int N>
+  struct strain_Tag
+  {
+  };
+  template <int N>
+  struct strain_rc_Tag
+  {
+  };
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(def_grad_Tag<N> const& tag, int const& cell) const;
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(weighted_average_Tag<N> const& tag, int const& cell) const;
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(strain_Tag<N> const& tag, int const& cell) const;
+  template <int N>
+  KOKKOS_INLINE_FUNCTION void
+  operator()(strain_rc_Tag<N> const& tag, int const& cell) const;
 };
 }  // namespace LCM
 #endif
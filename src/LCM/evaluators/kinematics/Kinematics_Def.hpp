@@ -84,14 +84,16 @@ Kinematics<EvalT, Traits>::postRegistrationSetup(
 
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
+template <int N>
 bool
 Kinematics<EvalT, Traits>::check_det(
     typename Traits::EvalData workset,
     int                       cell,
     int                       pt)
 {
-  minitensor::Tensor<ScalarT> F(num_dims_);
-  F.fill(def_grad_, cell, pt, 0, 0);
+  minitensor::Tensor<ScalarT, N> F(N);
+  for (int i = 0; i < N; ++i)
+    for (int j = 0; j < N; ++j) F(i, j) = def_grad_(cell, pt, i, j);
   j_(cell, pt) = minitensor::det(F);
   bool neg_det = false;
   if (pt == 0 && j_(cell, pt) < 1e-16) {
@@ -106,98 +108,160 @@ Kinematics<EvalT, Traits>::check_det(
   return neg_det;
 }
 
+//----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
-void
-Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+Kinematics<EvalT, Traits>::operator()(
+    def_grad_Tag<N> const& tag,
+    int const&             cell) const
 {
-  minitensor::Tensor<ScalarT> F(num_dims_), strain(num_dims_), gradu(num_dims_);
-  minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
+  minitensor::Tensor<ScalarT, N> F(N);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) { F(i, j) = grad_u_(cell, pt, i, j); }
+      F(i, i) += 1.0;
+    }
+    j_(cell, pt) = minitensor::det(F);
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) { def_grad_(cell, pt, i, j) = F(i, j); }
+    }
+  }
+}
 
-  // Compute DefGrad tensor from displacement gradient
-  if (!def_grad_rc_) {
-    for (int cell(0); cell < workset.numCells; ++cell) {
-      for (int pt(0); pt < num_pts_; ++pt) {
-        gradu.fill(grad_u_, cell, pt, 0, 0);
-        F            = I + gradu;
-        j_(cell, pt) = minitensor::det(F);
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            def_grad_(cell, pt, i, j) = F(i, j);
-          }
-        }
+template <typename EvalT, typename Traits>
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+Kinematics<EvalT, Traits>::operator()(
+    weighted_average_Tag<N> const& tag,
+    int const&                     cell) const
+{
+  ScalarT jbar(0.0), volume(0.0);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    jbar += weights_(cell, pt) * j_(cell, pt);
+    volume += weights_(cell, pt);
+  }
+  jbar /= volume;
+
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    ScalarT const weighted_jbar = (1 - alpha_) * jbar + alpha_ * j_(cell, pt);
+    ScalarT const p = std::pow((weighted_jbar / j_(cell, pt)), 1. / 3.);
+    j_(cell, pt)    = weighted_jbar;
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) { def_grad_(cell, pt, i, j) *= p; }
+    }
+  }
+}
+
+template <typename EvalT, typename Traits>
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+Kinematics<EvalT, Traits>::operator()(
+    strain_Tag<N> const& tag,
+    int const&           cell) const
+{
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        strain_(cell, pt, i, j) =
+            0.5 * (grad_u_(cell, pt, i, j) + grad_u_(cell, pt, j, i));
       }
     }
+  }
+}
+
+template <typename EvalT, typename Traits>
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+Kinematics<EvalT, Traits>::operator()(
+    strain_rc_Tag<N> const& tag,
+    int const&              cell) const
+{
+  minitensor::Tensor<ScalarT, N> gradu(N);
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    // dU/dx[0] = dx[n]/dx[0] - dx[0]/dx[0] = F[n,0] - I.
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) gradu(i, j) = def_grad_(cell, pt, i, j);
+      gradu(i, i) -= 1.0;
+    }
+    // strain = 1/2 (dU/dx[0] + dU/dx[0]^T).
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        strain_(cell, pt, i, j) = 0.5 * (gradu(i, j) + gradu(j, i));
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+template <int N>
+void
+Kinematics<EvalT, Traits>::evaluateFieldsDim(typename Traits::EvalData workset)
+{
+  // Compute DefGrad tensor from displacement gradient
+  if (!def_grad_rc_) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace, def_grad_Tag<N>>(
+            0, workset.numCells),
+        *this);
   } else {
-    bool first = true;
+    minitensor::Tensor<ScalarT, N> F(N);
+    bool                           first = true;
     for (int cell = 0; cell < workset.numCells; ++cell) {
       for (int pt = 0; pt < num_pts_; ++pt) {
-        gradu.fill(grad_u_, cell, pt, 0, 0);
-        F = I + gradu;
-        for (int i = 0; i < num_dims_; ++i)
-          for (int j = 0; j < num_dims_; ++j)
-            def_grad_(cell, pt, i, j) = F(i, j);
-        if (first && check_det(workset, cell, pt)) first = false;
+        for (int i = 0; i < N; ++i) {
+          for (int j = 0; j < N; ++j)
+            def_grad_(cell, pt, i, j) = grad_u_(cell, pt, i, j);
+          def_grad_(cell, pt, i, i) += 1.0;
+        }
+        if (first && check_det<N>(workset, cell, pt)) first = false;
         // F[n,0] = F[n,n-1] F[n-1,0].
         def_grad_rc_.multiplyInto<ScalarT>(def_grad_, cell, pt);
-        F.fill(def_grad_, cell, pt, 0, 0);
+        for (int i = 0; i < N; ++i)
+          for (int j = 0; j < N; ++j) F(i, j) = def_grad_(cell, pt, i, j);
         j_(cell, pt) = minitensor::det(F);
       }
     }
   }
 
   if (weighted_average_) {
-    ScalarT jbar, weighted_jbar, volume;
-    for (int cell(0); cell < workset.numCells; ++cell) {
-      jbar   = 0.0;
-      volume = 0.0;
-      for (int pt(0); pt < num_pts_; ++pt) {
-        jbar += weights_(cell, pt) * j_(cell, pt);
-        volume += weights_(cell, pt);
-      }
-      jbar /= volume;
-
-      for (int pt(0); pt < num_pts_; ++pt) {
-        weighted_jbar = (1 - alpha_) * jbar + alpha_ * j_(cell, pt);
-        F.fill(def_grad_, cell, pt, 0, 0);
-        const ScalarT p = std::pow((weighted_jbar / j_(cell, pt)), 1. / 3.);
-        F *= p;
-        j_(cell, pt) = weighted_jbar;
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            def_grad_(cell, pt, i, j) = F(i, j);
-          }
-        }
-      }
-    }
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace, weighted_average_Tag<N>>(
+            0, workset.numCells),
+        *this);
   }
 
-  if (needs_strain_) {
-    if (!def_grad_rc_) {
-      for (int cell(0); cell < workset.numCells; ++cell) {
-        for (int pt(0); pt < num_pts_; ++pt) {
-          gradu.fill(grad_u_, cell, pt, 0, 0);
-          strain = 0.5 * (gradu + minitensor::transpose(gradu));
-          for (int i(0); i < num_dims_; ++i) {
-            for (int j(0); j < num_dims_; ++j) {
-              strain_(cell, pt, i, j) = strain(i, j);
-            }
-          }
-        }
-      }
-    } else {
-      for (int cell = 0; cell < workset.numCells; ++cell) {
-        for (int pt = 0; pt < num_pts_; ++pt) {
-          F.fill(def_grad_, cell, pt, 0, 0);
-          gradu = F - I;
-          // dU/dx[0] = dx[n]/dx[0] - dx[0]/dx[0] = F[n,0] - I.
-          // strain = 1/2 (dU/dx[0] + dU/dx[0]^T).
-          strain = 0.5 * (gradu + minitensor::transpose(gradu));
-          for (int i = 0; i < num_dims_; ++i)
-            for (int j = 0; j < num_dims_; ++j)
-              strain_(cell, pt, i, j) = strain(i, j);
-        }
-      }
-    }
+  if (needs_strain_ && !def_grad_rc_) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace, strain_Tag<N>>(
+            0, workset.numCells),
+        *this);
+  } else if (needs_strain_) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace, strain_rc_Tag<N>>(
+            0, workset.numCells),
+        *this);
+  }
+}
+
+template <typename EvalT, typename Traits>
+void
+Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  // Dispatch on the spatial dimension so that the point operations use
+  // statically sized tensors.
+  switch (num_dims_) {
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::invalid_argument,
+          "Error(LCM Kinematics): invalid number of spatial dimensions: "
+              << num_dims_ << '\n');
+      break;
+    case 1: evaluateFieldsDim<1>(workset); break;
+    case 2: evaluateFieldsDim<2>(workset); break;
+    case 3: evaluateFieldsDim<3>(workset); break;
   }
 }
 //----------------------------------------------------------------------------
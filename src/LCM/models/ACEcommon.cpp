@@ -6,6 +6,9 @@
 
 #include "ACEcommon.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 std::vector<RealType>
 LCM::vectorFromFile(std::string const& filename)
 {
@@ -50,3 +53,96 @@ LCM::interpolateVectors(
 
   return y;
 }
+
+LCM::TabulatedFunction::TabulatedFunction(
+    std::vector<RealType> const& xv,
+    std::vector<RealType> const& yv)
+    : xv_(xv), yv_(yv)
+{
+  auto const n = xv_.size();
+  ALBANY_ASSERT(n == yv_.size(), "Vectors must have same size.\n");
+
+  // Same slopes, computed in the same way, as interpolateVectors.
+  slope_.resize(n, 0.0);
+  for (size_t i = 1; i < n; ++i) {
+    RealType const dy = yv_[i] - yv_[i - 1];
+    RealType const dx = xv_[i] - xv_[i - 1];
+    slope_[i]         = dy / dx;
+  }
+
+  is_sorted_ = std::is_sorted(xv_.begin(), xv_.end());
+  if (is_sorted_ == false || n < 3) return;
+
+  // Detect equally spaced abscissas to allow direct indexing. The
+  // located index is always corrected against the actual abscissas,
+  // so a loose tolerance only costs an extra step, never accuracy.
+  x0_               = xv_[0];
+  RealType const dx = (xv_[n - 1] - x0_) / static_cast<RealType>(n - 1);
+  if (dx <= 0.0) return;
+
+  RealType const tol = 1.0e-8 * dx;
+  for (size_t i = 0; i < n; ++i) {
+    RealType const xi = x0_ + static_cast<RealType>(i) * dx;
+    if (std::abs(xv_[i] - xi) > tol) return;
+  }
+  inv_dx_     = 1.0 / dx;
+  is_uniform_ = true;
+}
+
+std::size_t
+LCM::TabulatedFunction::search(RealType const x) const
+{
+  auto const n = xv_.size();
+
+  // Unsorted tables are scanned exactly as interpolateVectors does.
+  if (is_sorted_ == false) {
+    size_t i{0};
+    while (xv_[i] < x) {
+      if (i + 1 == n) break;
+      ++i;
+    }
+    return i;
+  }
+
+  auto const it = std::lower_bound(xv_.begin(), xv_.end(), x);
+  auto const i  = static_cast<size_t>(it - xv_.begin());
+  return std::min(i, n - 1);
+}
+
+std::size_t
+LCM::TabulatedFunction::locate(RealType const x, std::size_t& hint) const
+{
+  auto const n = xv_.size();
+
+  // This also takes care of NaN, for which the linear scan stops at once.
+  if (!(xv_[0] < x)) {
+    hint = 0;
+    return hint;
+  }
+  if (is_sorted_ == true && xv_[n - 1] < x) {
+    hint = n - 1;
+    return hint;
+  }
+
+  if (is_uniform_ == true) {
+    auto const r = std::ceil((x - x0_) * inv_dx_);
+    auto       i = static_cast<size_t>(std::min(r, RealType(n - 1)));
+    while (i > 0 && !(xv_[i - 1] < x)) --i;
+    while (i + 1 < n && xv_[i] < x) ++i;
+    hint = i;
+    return hint;
+  }
+
+  // Cached bracket, then its right neighbor for monotonically advancing
+  // arguments, then a binary search.
+  if (is_sorted_ == true && 0 < hint && hint < n) {
+    if (xv_[hint - 1] < x && !(xv_[hint] < x)) return hint;
+    if (hint + 1 < n && xv_[hint] < x && !(xv_[hint + 1] < x)) {
+      ++hint;
+      return hint;
+    }
+  }
+
+  hint = search(x);
+  return hint;
+}
@@ -20,6 +20,111 @@ interpolateVectors(
     std::vector<RealType> const& yv,
     RealType const               x);
 
+//
+// Piecewise linear function given by a table of abscissas and ordinates,
+// preprocessed once so that lookups avoid the linear scan done by
+// interpolateVectors. Values reproduce interpolateVectors exactly,
+// including its treatment of both ends of the table.
+//
+class TabulatedFunction
+{
+ public:
+  TabulatedFunction() = default;
+
+  TabulatedFunction(
+      std::vector<RealType> const& xv,
+      std::vector<RealType> const& yv);
+
+  bool
+  empty() const
+  {
+    return xv_.empty();
+  }
+
+  std::size_t
+  size() const
+  {
+    return xv_.size();
+  }
+
+  bool
+  isUniform() const
+  {
+    return is_uniform_;
+  }
+
+  // Index of the first abscissa not less than x, or the last index if
+  // there is none. This is where the linear scan of interpolateVectors
+  // stops. The hint is a bracket cached by the caller and is updated.
+  std::size_t
+  locate(RealType const x, std::size_t& hint) const;
+
+  std::size_t
+  locate(RealType const x) const
+  {
+    std::size_t hint{0};
+    return locate(x, hint);
+  }
+
+  // Value at x. For AD types, the derivatives of x are propagated
+  // through the slope of the bracketing interval.
+  template <typename T>
+  T
+  value(T const& x, std::size_t& hint) const;
+
+  template <typename T>
+  T
+  value(T const& x) const
+  {
+    std::size_t hint{0};
+    return value(x, hint);
+  }
+
+  // Values at a batch of points, e.g. all the integration points of a
+  // workset, sharing a single cached bracket.
+  template <typename ArrayX, typename ArrayY>
+  void
+  values(ArrayX const& x, ArrayY& y, std::size_t const num_points) const;
+
+ private:
+  std::size_t
+  search(RealType const x) const;
+
+  std::vector<RealType> xv_;
+  std::vector<RealType> yv_;
+  std::vector<RealType> slope_;
+
+  bool     is_sorted_{false};
+  bool     is_uniform_{false};
+  RealType x0_{0.0};
+  RealType inv_dx_{0.0};
+};
+
+template <typename T>
+T
+TabulatedFunction::value(T const& x, std::size_t& hint) const
+{
+  auto const n = xv_.size();
+  ALBANY_ASSERT(n > 0, "Cannot evaluate an empty table.\n");
+
+  auto const i = locate(Sacado::ScalarValue<T>::eval(x), hint);
+
+  if (i == 0) return T(yv_[0]);
+  if (i + 1 == n) return T(yv_[i]);
+  return T(yv_[i - 1] + slope_[i] * (x - xv_[i - 1]));
+}
+
+template <typename ArrayX, typename ArrayY>
+void
+TabulatedFunction::values(
+    ArrayX const&     x,
+    ArrayY&           y,
+    std::size_t const num_points) const
+{
+  std::size_t hint{0};
+  for (std::size_t i = 0; i < num_points; ++i) { y[i] = value(x[i], hint); }
+}
+
 namespace {
 
 static RealType const SQ23{std::sqrt(2.0 / 3.0)};
@@ -83,6 +83,21 @@ ACEiceMiniKernel<EvalT, Traits>::ACEiceMiniKernel(
       "in "
       "ACE Freezing Curve Width File must match.");
 
+  if (sea_level_.size() > 0) {
+    sea_level_table_ = TabulatedFunction(time_, sea_level_);
+  }
+  if (salinity_.size() > 0) {
+    salinity_table_ = TabulatedFunction(z_above_mean_sea_level_, salinity_);
+  }
+  if (porosity_from_file_.size() > 0) {
+    porosity_table_ =
+        TabulatedFunction(z_above_mean_sea_level_, porosity_from_file_);
+  }
+  if (freezing_curve_width_.size() > 0) {
+    freezing_curve_width_table_ =
+        TabulatedFunction(z_above_mean_sea_level_, freezing_curve_width_);
+  }
+
   // retrieve appropriate field name strings
   std::string const cauchy_string       = field_name_map_["Cauchy_Stress"];
   std::string const Fp_string           = field_name_map_["Fp"];
@@ -308,6 +323,33 @@ ACEiceMiniKernel<EvalT, Traits>::init(
 
   auto const num_cells = workset.numCells;
   for (auto cell = 0; cell < num_cells; ++cell) { failed_(cell, 0) = 0.0; }
+
+  // The tables depend only on time and height, so evaluate them here
+  // for the whole workset rather than at every point in the kernel.
+  current_sea_level_ = sea_level_table_.empty() == false ?
+                           sea_level_table_.value(current_time_) :
+                           0.0;
+
+  auto const coords     = this->model_.getCoordVecField();
+  auto const num_points = static_cast<std::size_t>(num_cells * num_pts_);
+  height_qp_.resize(num_points);
+  for (auto cell = 0; cell < num_cells; ++cell) {
+    for (auto pt = 0; pt < num_pts_; ++pt) {
+      height_qp_[cell * num_pts_ + pt] =
+          Sacado::Value<ScalarT>::eval(coords(cell, pt, 2));
+    }
+  }
+
+  auto const evaluate = [&](TabulatedFunction const& table,
+                            std::vector<RealType>&   values) {
+    if (table.empty() == true) return;
+    values.resize(num_points);
+    table.values(height_qp_, values, num_points);
+  };
+
+  evaluate(salinity_table_, salinity_qp_);
+  evaluate(porosity_table_, porosity_qp_);
+  evaluate(freezing_curve_width_table_, freezing_curve_width_qp_);
 }
 
 template <typename EvalT, typename Traits>
@@ -320,9 +362,8 @@ ACEiceMiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
   Tensor       F(num_dims_);
   Tensor       sigma(num_dims_);
 
-  auto const coords       = this->model_.getCoordVecField();
-  auto const height       = Sacado::Value<ScalarT>::eval(coords(cell, pt, 2));
-  auto const current_time = current_time_;
+  auto const qp     = cell * num_pts_ + pt;
+  auto const height = height_qp_[qp];
 
   ScalarT const E     = elastic_modulus_(cell, pt);
   ScalarT const nu    = poissons_ratio_(cell, pt);
@@ -347,10 +388,7 @@ ACEiceMiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
   auto const critical_exposure_time =
       is_erodible == true ? element_size / erosion_rate : 0.0;
 
-  auto const sea_level =
-      sea_level_.size() > 0 ?
-          interpolateVectors(time_, sea_level_, current_time) :
-          0.0;
+  auto const sea_level = current_sea_level_;
   bool const is_exposed_to_water = (height <= sea_level);
   bool const is_at_boundary =
       have_boundary_indicator_ == true ?
@@ -376,8 +414,7 @@ ACEiceMiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
   //       to be done once, at the beginning of the simulation.
   auto porosity = porosity0_;
   if (porosity_from_file_.size() > 0) {
-    porosity = interpolateVectors(
-        z_above_mean_sea_level_, porosity_from_file_, height);
+    porosity = porosity_qp_[qp];
   }
   porosity_(cell, pt) = porosity;
 
@@ -387,7 +424,7 @@ ACEiceMiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
   // Calculate melting temperature
   auto sal = salinity_base_;  // should come from chemical part of model
   if (salinity_.size() > 0) {
-    sal = interpolateVectors(z_above_mean_sea_level_, salinity_, height);
+    sal = salinity_qp_[qp];
   }
   auto sal15          = std::sqrt(sal * sal * sal);
   auto pressure_fixed = 1.0;
@@ -414,8 +451,7 @@ ACEiceMiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
   // b = shift to left or right (+ is left, - is right)
   ScalarT W = freeze_curve_width_;  // constant value
   if (freezing_curve_width_.size() > 0) {
-    W = interpolateVectors(
-        z_above_mean_sea_level_, freezing_curve_width_, height);
+    W = freezing_curve_width_qp_[qp];
   }
 
   ScalarT const Tdiff = Tcurr - Tmelt;
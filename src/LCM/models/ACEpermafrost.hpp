@@ -7,6 +7,7 @@
 #if !defined(LCM_ACEpermafrost_hpp)
 #define LCM_ACEpermafrost_hpp
 
+#include "ACEcommon.hpp"
 #include "ParallelConstitutiveModel.hpp"
 
 namespace LCM {
@@ -133,6 +134,21 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
   std::vector<RealType> sea_level_;
   RealType              current_time_{0.0};
 
+  // Tables above preprocessed at construction for fast lookup
+  TabulatedFunction sea_level_table_;
+  TabulatedFunction salinity_table_;
+  TabulatedFunction air_saturation_table_;
+  TabulatedFunction porosity_table_;
+  TabulatedFunction freezing_curve_width_table_;
+
+  // Table values for the current workset, evaluated once in init()
+  RealType              current_sea_level_{0.0};
+  std::vector<RealType> height_qp_;
+  std::vector<RealType> salinity_qp_;
+  std::vector<RealType> air_saturation_qp_;
+  std::vector<RealType> porosity_qp_;
+  std::vector<RealType> freezing_curve_width_qp_;
+
   std::string block_name_{""};
 
   void
@@ -8,5 +8,18 @@
 
 #include "AnisotropicViscoplasticModel.hpp"
 #include "AnisotropicViscoplasticModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::AnisotropicViscoplasticModel<EvalT, Traits>::AnisotropicViscoplasticModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          AnisotropicViscoplasticKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::AnisotropicViscoplasticKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::AnisotropicViscoplasticModel)
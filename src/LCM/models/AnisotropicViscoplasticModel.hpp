@@ -8,7 +8,7 @@
 #define LCM_AnisotropicViscoplasticModel_hpp
 
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -16,72 +16,95 @@
 
 namespace LCM {
 
-//! \brief Anisotropic Viscoplastic Constitutive Model
 template <typename EvalT, typename Traits>
-class AnisotropicViscoplasticModel
-    : public LCM::ConstitutiveModel<EvalT, Traits>
+struct AnisotropicViscoplasticKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
-  // optional temperature support
-  using ConstitutiveModel<EvalT, Traits>::have_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::expansion_coeff_;
-  using ConstitutiveModel<EvalT, Traits>::ref_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::heat_capacity_;
-  using ConstitutiveModel<EvalT, Traits>::density_;
-  using ConstitutiveModel<EvalT, Traits>::temperature_;
-
   ///
   /// Constructor
   ///
-  AnisotropicViscoplasticModel(
+  AnisotropicViscoplasticKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Denstructor
+  /// No copy constructor
   ///
-  virtual ~AnisotropicViscoplasticModel(){};
+  AnisotropicViscoplasticKernel(AnisotropicViscoplasticKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
-  ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
-
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
-
- private:
+  /// No copy assignment
   ///
-  /// Private to prohibit copying
-  ///
-  AnisotropicViscoplasticModel(const AnisotropicViscoplasticModel&);
+  AnisotropicViscoplasticKernel&
+  operator=(AnisotropicViscoplasticKernel const&) = delete;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  AnisotropicViscoplasticModel&
-  operator=(const AnisotropicViscoplasticModel&);
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+
+  // optional temperature support
+  using BaseKernel::density_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::have_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::temperature_;
+
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField delta_time_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField flow_coeff_;
+  ConstScalarField flow_exp_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField recovery_modulus_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField Fp_;
+  ScalarField source_;
+  ScalarField stress_;
+
+  // State variables
+  Albany::MDArray Fp_old_;
+  Albany::MDArray eqps_old_;
+
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+};
+
+//! \brief Anisotropic Viscoplastic Constitutive Model
+template <typename EvalT, typename Traits>
+class AnisotropicViscoplasticModel
+    : public LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          AnisotropicViscoplasticKernel<EvalT, Traits>>
+{
+ public:
+  AnisotropicViscoplasticModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
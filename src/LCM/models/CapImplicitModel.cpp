@@ -8,5 +8,18 @@
 
 #include "CapImplicitModel.hpp"
 #include "CapImplicitModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::CapImplicitModel<EvalT, Traits>::CapImplicitModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          CapImplicitKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CapImplicitKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CapImplicitModel)
@@ -8,7 +8,7 @@
 
 #include <MiniTensor.h>
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -17,72 +17,95 @@
 #include "Sacado.hpp"
 
 namespace LCM {
-/// \brief CapImplicit stress response
-///
-/// This evaluator computes stress based on a cap plasticity model.
-///
 
 template <typename EvalT, typename Traits>
-class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct CapImplicitKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  typedef typename Sacado::mpl::apply<FadType, ScalarT>::type  DFadType;
-  typedef typename Sacado::mpl::apply<FadType, DFadType>::type D2FadType;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
-  // optional material tangent computation
-  using ConstitutiveModel<EvalT, Traits>::compute_tangent_;
-
   ///
   /// Constructor
   ///
-  CapImplicitModel(
+  CapImplicitKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Destructor
+  /// No copy constructor
   ///
-  virtual ~CapImplicitModel(){};
+  CapImplicitKernel(CapImplicitKernel const&) = delete;
 
   ///
-  /// Implementation of physics
-  ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
-
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
-
- private:
+  /// No copy assignment
   ///
-  /// Private to prohibit copying
-  ///
-  CapImplicitModel(const CapImplicitModel&);
+  CapImplicitKernel&
+  operator=(CapImplicitKernel const&) = delete;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  CapImplicitModel&
-  operator=(const CapImplicitModel&);
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using DFadType  = typename Sacado::mpl::apply<FadType, ScalarT>::type;
+  using D2FadType = typename Sacado::mpl::apply<FadType, DFadType>::type;
+
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+
+  // optional material tangent computation
+  using BaseKernel::compute_tangent_;
+
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField elastic_modulus_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField strain_;
+
+  // Evaluated MDFields
+  ScalarField back_stress_;
+  ScalarField cap_parameter_;
+  ScalarField eqps_;
+  ScalarField stress_;
+  ScalarField tangent_;
+  ScalarField vol_plastic_strain_;
+
+  // State variables
+  Albany::MDArray back_stress_old_;
+  Albany::MDArray cap_parameter_old_;
+  Albany::MDArray eqps_old_;
+  Albany::MDArray strain_old_;
+  Albany::MDArray stress_old_;
+  Albany::MDArray vol_plastic_strain_old_;
+
+  // cap model parameters
+  RealType A;
+  RealType B;
+  RealType C;
+  RealType theta;
+  RealType R;
+  RealType kappa0;
+  RealType W;
+  RealType D1;
+  RealType D2;
+  RealType calpha;
+  RealType psi;
+  RealType N;
+  RealType L;
+  RealType phi;
+  RealType Q;
+
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
 
   // all local functions used in computing cap model stress:
 
@@ -92,7 +115,7 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   compute_f(
       minitensor::Tensor<T>& sigma,
       minitensor::Tensor<T>& alpha,
-      T&                     kappa);
+      T&                     kappa) const;
 
   // unknow variable value list
   std::vector<ScalarT>
@@ -100,7 +123,7 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
       minitensor::Tensor<ScalarT>& sigmaVal,
       minitensor::Tensor<ScalarT>& alphaVal,
       ScalarT&                     kappaVal,
-      ScalarT&                     dgammaVal);
+      ScalarT&                     dgammaVal) const;
 
   // local iteration jacobian
   void
@@ -112,7 +135,7 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
       const minitensor::Tensor<ScalarT>&  alphaVal,
       const ScalarT&                      kappaVal,
       minitensor::Tensor4<ScalarT> const& Celastic,
-      bool                                kappa_flag);
+      bool                                kappa_flag) const;
 
   // plastic potential
   template <typename T>
@@ -120,37 +143,37 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   compute_g(
       minitensor::Tensor<T>& sigma,
       minitensor::Tensor<T>& alpha,
-      T&                     kappa);
+      T&                     kappa) const;
 
   // derivative
   minitensor::Tensor<ScalarT>
-  compute_dfdsigma(std::vector<ScalarT> const& XX);
+  compute_dfdsigma(std::vector<ScalarT> const& XX) const;
 
   ScalarT
-  compute_dfdkappa(std::vector<ScalarT> const& XX);
+  compute_dfdkappa(std::vector<ScalarT> const& XX) const;
 
   minitensor::Tensor<ScalarT>
-  compute_dgdsigma(std::vector<ScalarT> const& XX);
+  compute_dgdsigma(std::vector<ScalarT> const& XX) const;
 
   minitensor::Tensor<DFadType>
-  compute_dgdsigma(std::vector<DFadType> const& XX);
+  compute_dgdsigma(std::vector<DFadType> const& XX) const;
 
   // hardening functions
   template <typename T>
   T
-  compute_Galpha(T J2_alpha);
+  compute_Galpha(T J2_alpha) const;
 
   template <typename T>
   minitensor::Tensor<T>
-  compute_halpha(minitensor::Tensor<T> const& dgdsigma, T const J2_alpha);
+  compute_halpha(minitensor::Tensor<T> const& dgdsigma, T const J2_alpha) const;
 
   template <typename T>
   T
-  compute_dedkappa(T const kappa);
+  compute_dedkappa(T const kappa) const;
 
   template <typename T>
   T
-  compute_hkappa(T const I1_dgdsigma, T const dedkappa);
+  compute_hkappa(T const I1_dgdsigma, T const dedkappa) const;
 
   // elasto-plastic tangent modulus
   minitensor::Tensor4<ScalarT>
@@ -159,34 +182,30 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
       minitensor::Tensor<ScalarT>&  sigma,
       minitensor::Tensor<ScalarT>&  alpha,
       ScalarT&                      kappa,
-      ScalarT&                      dgamma);
+      ScalarT&                      dgamma) const;
   minitensor::Tensor4<ScalarT>
   compute_Cepp(
       minitensor::Tensor4<ScalarT>& Celastic,
       minitensor::Tensor<ScalarT>&  sigma,
       minitensor::Tensor<ScalarT>&  alpha,
       ScalarT&                      kappa,
-      ScalarT&                      dgamma);
-
-  // local temp variables
-  RealType A;
-  RealType B;
-  RealType C;
-  RealType theta;
-  RealType R;
-  RealType kappa0;
-  RealType W;
-  RealType D1;
-  RealType D2;
-  RealType calpha;
-  RealType psi;
-  RealType N;
-  RealType L;
-  RealType phi;
-  RealType Q;
+      ScalarT&                      dgamma) const;
+};
 
-  std::string strainName, stressName;
-  std::string backStressName, capParameterName, eqpsName, volPlasticStrainName;
+/// \brief CapImplicit stress response
+///
+/// This evaluator computes stress based on a cap plasticity model.
+///
+template <typename EvalT, typename Traits>
+class CapImplicitModel : public LCM::ParallelConstitutiveModel<
+                             EvalT,
+                             Traits,
+                             CapImplicitKernel<EvalT, Traits>>
+{
+ public:
+  CapImplicitModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
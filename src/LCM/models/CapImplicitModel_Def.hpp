@@ -15,10 +15,11 @@ namespace LCM {
 
 //**********************************************************************
 template <typename EvalT, typename Traits>
-CapImplicitModel<EvalT, Traits>::CapImplicitModel(
+CapImplicitKernel<EvalT, Traits>::CapImplicitKernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
-    const Teuchos::RCP<Albany::Layouts>& dl)
-    : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
       A(p->get<RealType>("A")),
       B(p->get<RealType>("B")),
       C(p->get<RealType>("C")),
@@ -36,345 +37,301 @@ CapImplicitModel<EvalT, Traits>::CapImplicitModel(
       Q(p->get<RealType>("Q"))
 {
   // define the dependent fields
-  this->dep_field_map_.insert(std::make_pair("Strain", dl->qp_tensor));
-  this->dep_field_map_.insert(std::make_pair("Poissons Ratio", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Elastic Modulus", dl->qp_scalar));
+  setDependentField("Strain", dl->qp_tensor);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
 
   // retrieve appropriate field name strings
-  std::string cauchy_string           = (*field_name_map_)["Cauchy_Stress"];
-  std::string strain_string           = (*field_name_map_)["Strain"];
-  std::string backStress_string       = (*field_name_map_)["Back_Stress"];
-  std::string capParameter_string     = (*field_name_map_)["Cap_Parameter"];
-  std::string eqps_string             = (*field_name_map_)["eqps"];
-  std::string volPlasticStrain_string = (*field_name_map_)["volPlastic_Strain"];
+  std::string cauchy_string           = field_name_map_["Cauchy_Stress"];
+  std::string strain_string           = field_name_map_["Strain"];
+  std::string backStress_string       = field_name_map_["Back_Stress"];
+  std::string capParameter_string     = field_name_map_["Cap_Parameter"];
+  std::string eqps_string             = field_name_map_["eqps"];
+  std::string volPlasticStrain_string = field_name_map_["volPlastic_Strain"];
 
   // optional material tangent computation
-  std::string tangent_string = (*field_name_map_)["Material Tangent"];
+  std::string tangent_string = field_name_map_["Material Tangent"];
 
   // define the evaluated fields
-  this->eval_field_map_.insert(std::make_pair(cauchy_string, dl->qp_tensor));
-  this->eval_field_map_.insert(
-      std::make_pair(backStress_string, dl->qp_tensor));
-  this->eval_field_map_.insert(
-      std::make_pair(capParameter_string, dl->qp_scalar));
-  this->eval_field_map_.insert(std::make_pair(eqps_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair(volPlasticStrain_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair("Material Tangent", dl->qp_tensor4));
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(backStress_string, dl->qp_tensor);
+  setEvaluatedField(capParameter_string, dl->qp_scalar);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(volPlasticStrain_string, dl->qp_scalar);
+  setEvaluatedField("Material Tangent", dl->qp_tensor4);
 
-  if (compute_tangent_) {
-    this->eval_field_map_.insert(
-        std::make_pair(tangent_string, dl->qp_tensor4));
-  }
+  if (compute_tangent_) { setEvaluatedField(tangent_string, dl->qp_tensor4); }
 
   // define the state variables
   //
   // strain
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(strain_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(strain_string, dl->qp_tensor, "scalar", 0.0, true, true);
   //
   // stress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(cauchy_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, true, true);
   //
   // backStress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(backStress_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(
+      backStress_string, dl->qp_tensor, "scalar", 0.0, true, true);
   //
   // capParameter
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(capParameter_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(kappa0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(
+      capParameter_string, dl->qp_scalar, "scalar", kappa0, true, true);
   //
   // eqps
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(eqps_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // volPlasticStrain
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(volPlasticStrain_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(
+      volPlasticStrain_string, dl->qp_scalar, "scalar", 0.0, true, true);
 }
 
 //**********************************************************************
 template <typename EvalT, typename Traits>
 void
-CapImplicitModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+CapImplicitKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<ScalarT const>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
 {
   // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
-  std::string cauchy_string           = (*field_name_map_)["Cauchy_Stress"];
-  std::string strain_string           = (*field_name_map_)["Strain"];
-  std::string backStress_string       = (*field_name_map_)["Back_Stress"];
-  std::string capParameter_string     = (*field_name_map_)["Cap_Parameter"];
-  std::string eqps_string             = (*field_name_map_)["eqps"];
-  std::string volPlasticStrain_string = (*field_name_map_)["volPlastic_Strain"];
-  std::string tangent_string          = (*field_name_map_)["Material Tangent"];
+  std::string cauchy_string           = field_name_map_["Cauchy_Stress"];
+  std::string strain_string           = field_name_map_["Strain"];
+  std::string backStress_string       = field_name_map_["Back_Stress"];
+  std::string capParameter_string     = field_name_map_["Cap_Parameter"];
+  std::string eqps_string             = field_name_map_["eqps"];
+  std::string volPlasticStrain_string = field_name_map_["volPlastic_Strain"];
+  std::string tangent_string          = field_name_map_["Material Tangent"];
 
   // extract evaluated MDFields
-  auto stress           = *eval_fields[cauchy_string];
-  auto backStress       = *eval_fields[backStress_string];
-  auto capParameter     = *eval_fields[capParameter_string];
-  auto eqps             = *eval_fields[eqps_string];
-  auto volPlasticStrain = *eval_fields[volPlasticStrain_string];
-  PHX::MDField<ScalarT> tangent;
-  if (compute_tangent_) tangent = *eval_fields[tangent_string];
+  stress_             = *eval_fields[cauchy_string];
+  back_stress_        = *eval_fields[backStress_string];
+  cap_parameter_      = *eval_fields[capParameter_string];
+  eqps_               = *eval_fields[eqps_string];
+  vol_plastic_strain_ = *eval_fields[volPlasticStrain_string];
+  if (compute_tangent_) tangent_ = *eval_fields[tangent_string];
 
   // get State Variables
-  Albany::MDArray strainold = (*workset.stateArrayPtr)[strain_string + "_old"];
-  Albany::MDArray stressold = (*workset.stateArrayPtr)[cauchy_string + "_old"];
-  Albany::MDArray backStressold =
-      (*workset.stateArrayPtr)[backStress_string + "_old"];
-  Albany::MDArray capParameterold =
-      (*workset.stateArrayPtr)[capParameter_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray volPlasticStrainold =
+  strain_old_        = (*workset.stateArrayPtr)[strain_string + "_old"];
+  stress_old_        = (*workset.stateArrayPtr)[cauchy_string + "_old"];
+  back_stress_old_   = (*workset.stateArrayPtr)[backStress_string + "_old"];
+  cap_parameter_old_ = (*workset.stateArrayPtr)[capParameter_string + "_old"];
+  eqps_old_          = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  vol_plastic_strain_old_ =
       (*workset.stateArrayPtr)[volPlasticStrain_string + "_old"];
+}
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int qp = 0; qp < num_pts_; ++qp) {
-      // local parameters
-      ScalarT lame = elastic_modulus(cell, qp) * poissons_ratio(cell, qp) /
-                     (1.0 + poissons_ratio(cell, qp)) /
-                     (1.0 - 2.0 * poissons_ratio(cell, qp));
-      ScalarT mu =
-          elastic_modulus(cell, qp) / 2.0 / (1.0 + poissons_ratio(cell, qp));
-      ScalarT bulkModulus = lame + (2. / 3.) * mu;
-
-      // elastic matrix
-      minitensor::Tensor4<ScalarT> Celastic =
-          lame * minitensor::identity_3<ScalarT>(3) +
-          mu * (minitensor::identity_1<ScalarT>(3) +
-                minitensor::identity_2<ScalarT>(3));
-
-      // elastic compliance tangent matrix
-      minitensor::Tensor4<ScalarT> compliance =
-          (1. / bulkModulus / 9.) * minitensor::identity_3<ScalarT>(3) +
-          (1. / mu / 2.) * (0.5 * (minitensor::identity_1<ScalarT>(3) +
-                                   minitensor::identity_2<ScalarT>(3)) -
-                            (1. / 3.) * minitensor::identity_3<ScalarT>(3));
-
-      // previous state
-      minitensor::Tensor<ScalarT> sigmaN(3, minitensor::Filler::ZEROS),
-          alphaN(3, minitensor::Filler::ZEROS),
-          strainN(3, minitensor::Filler::ZEROS);
-
-      // incremental strain tensor
-      minitensor::Tensor<ScalarT> depsilon(3);
-      for (int i = 0; i < num_dims_; ++i) {
-        for (int j = 0; j < num_dims_; ++j) {
-          depsilon(i, j) = strain(cell, qp, i, j) - strainold(cell, qp, i, j);
-          strainN(i, j)  = strainold(cell, qp, i, j);
-        }
-      }
-
-      // trial state
-      minitensor::Tensor<ScalarT> sigmaVal =
-          minitensor::dotdot(Celastic, depsilon);
-      minitensor::Tensor<ScalarT> alphaVal(3, minitensor::Filler::ZEROS);
-
-      for (int i = 0; i < num_dims_; ++i) {
-        for (int j = 0; j < num_dims_; ++j) {
-          sigmaVal(i, j) = sigmaVal(i, j) + stressold(cell, qp, i, j);
-          alphaVal(i, j) = backStressold(cell, qp, i, j);
-          sigmaN(i, j)   = stressold(cell, qp, i, j);
-          alphaN(i, j)   = backStressold(cell, qp, i, j);
-        }
-      }
+//**********************************************************************
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+CapImplicitKernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
+  // local parameters
+  ScalarT lame = elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt) /
+                 (1.0 + poissons_ratio_(cell, pt)) /
+                 (1.0 - 2.0 * poissons_ratio_(cell, pt));
+  ScalarT mu =
+      elastic_modulus_(cell, pt) / 2.0 / (1.0 + poissons_ratio_(cell, pt));
+  ScalarT bulkModulus = lame + (2. / 3.) * mu;
+
+  // elastic matrix
+  minitensor::Tensor4<ScalarT> Celastic =
+      lame * minitensor::identity_3<ScalarT>(3) +
+      mu * (minitensor::identity_1<ScalarT>(3) +
+            minitensor::identity_2<ScalarT>(3));
+
+  // elastic compliance tangent matrix
+  minitensor::Tensor4<ScalarT> compliance =
+      (1. / bulkModulus / 9.) * minitensor::identity_3<ScalarT>(3) +
+      (1. / mu / 2.) * (0.5 * (minitensor::identity_1<ScalarT>(3) +
+                               minitensor::identity_2<ScalarT>(3)) -
+                        (1. / 3.) * minitensor::identity_3<ScalarT>(3));
+
+  // previous state
+  minitensor::Tensor<ScalarT> sigmaN(3, minitensor::Filler::ZEROS),
+      alphaN(3, minitensor::Filler::ZEROS),
+      strainN(3, minitensor::Filler::ZEROS);
+
+  // incremental strain tensor
+  minitensor::Tensor<ScalarT> depsilon(3);
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      depsilon(i, j) = strain_(cell, pt, i, j) - strain_old_(cell, pt, i, j);
+      strainN(i, j)  = strain_old_(cell, pt, i, j);
+    }
+  }
 
-      ScalarT kappaVal  = capParameterold(cell, qp);
-      ScalarT dgammaVal = 0.0;
+  // trial state
+  minitensor::Tensor<ScalarT> sigmaVal =
+      minitensor::dotdot(Celastic, depsilon);
+  minitensor::Tensor<ScalarT> alphaVal(3, minitensor::Filler::ZEROS);
+
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      sigmaVal(i, j) = sigmaVal(i, j) + stress_old_(cell, pt, i, j);
+      alphaVal(i, j) = back_stress_old_(cell, pt, i, j);
+      sigmaN(i, j)   = stress_old_(cell, pt, i, j);
+      alphaN(i, j)   = back_stress_old_(cell, pt, i, j);
+    }
+  }
 
-      // used in defining generalized hardening modulus
-      ScalarT Htan(0.0);
+  ScalarT kappaVal  = cap_parameter_old_(cell, pt);
+  ScalarT dgammaVal = 0.0;
 
-      // define plastic strain increment, its two invariants: dev, and vol
-      minitensor::Tensor<ScalarT> deps_plastic(3, minitensor::Filler::ZEROS);
-      ScalarT                     deqps(0.0), devolps(0.0);
+  // used in defining generalized hardening modulus
+  ScalarT Htan(0.0);
 
-      // define temporary trial stress, used in computing plastic strain
-      minitensor::Tensor<ScalarT> sigmaTr = sigmaVal;
+  // define plastic strain increment, its two invariants: dev, and vol
+  minitensor::Tensor<ScalarT> deps_plastic(3, minitensor::Filler::ZEROS);
+  ScalarT                     deqps(0.0), devolps(0.0);
 
-      std::vector<ScalarT> XXVal(13);
+  // define temporary trial stress, used in computing plastic strain
+  minitensor::Tensor<ScalarT> sigmaTr = sigmaVal;
 
-      // check yielding
-      ScalarT f = compute_f(sigmaVal, alphaVal, kappaVal);
-      XXVal     = initialize(sigmaVal, alphaVal, kappaVal, dgammaVal);
+  std::vector<ScalarT> XXVal(13);
 
-      // local Newton loop
-      if (f > 1.e-11) {  // plastic yielding
+  // check yielding
+  ScalarT f = compute_f(sigmaVal, alphaVal, kappaVal);
+  XXVal     = initialize(sigmaVal, alphaVal, kappaVal, dgammaVal);
 
-        ScalarT normR, normR0, conv;
-        bool    kappa_flag = false;
-        bool    converged  = false;
-        int     iter       = 0;
+  // local Newton loop
+  if (f > 1.e-11) {  // plastic yielding
 
-        std::vector<ScalarT>                R(13);
-        std::vector<ScalarT>                dRdX(13 * 13);
-        LocalNonlinearSolver<EvalT, Traits> solver;
+    ScalarT normR, normR0, conv;
+    bool    kappa_flag = false;
+    bool    converged  = false;
+    int     iter       = 0;
 
-        while (!converged) {
-          // assemble residual vector and local Jacobian
-          compute_ResidJacobian(
-              XXVal,
-              R,
-              dRdX,
-              sigmaVal,
-              alphaVal,
-              kappaVal,
-              Celastic,
-              kappa_flag);
+    std::vector<ScalarT>                R(13);
+    std::vector<ScalarT>                dRdX(13 * 13);
+    LocalNonlinearSolver<EvalT, Traits> solver;
 
-          normR = 0.0;
-          for (int i = 0; i < 13; i++) normR += R[i] * R[i];
+    while (!converged) {
+      // assemble residual vector and local Jacobian
+      compute_ResidJacobian(
+          XXVal,
+          R,
+          dRdX,
+          sigmaVal,
+          alphaVal,
+          kappaVal,
+          Celastic,
+          kappa_flag);
 
-          normR = std::sqrt(normR);
+      normR = 0.0;
+      for (int i = 0; i < 13; i++) normR += R[i] * R[i];
 
-          if (iter == 0) normR0 = normR;
-          if (normR0 != 0)
-            conv = normR / normR0;
-          else
-            conv = normR0;
+      normR = std::sqrt(normR);
 
-          if (conv < 1.e-11 || normR < 1.e-11) break;
+      if (iter == 0) normR0 = normR;
+      if (normR0 != 0)
+        conv = normR / normR0;
+      else
+        conv = normR0;
 
-          if (iter > 20) break;
+      if (conv < 1.e-11 || normR < 1.e-11) break;
 
-          // TEUCHOS_TEST_FOR_EXCEPTION( iter > 20, std::runtime_error,
-          // std::endl << "Error in return mapping, iter = "
-          //<< iter << "\nres = " << normR << "\nrelres = " << conv <<
-          // std::endl;
+      if (iter > 20) break;
 
-          std::vector<ScalarT> XXValK = XXVal;
-          solver.solve(dRdX, XXValK, R);
+      // TEUCHOS_TEST_FOR_EXCEPTION( iter > 20, std::runtime_error,
+      // std::endl << "Error in return mapping, iter = "
+      //<< iter << "\nres = " << normR << "\nrelres = " << conv <<
+      // std::endl;
 
-          // put restrictions on kappa: only allows monotonic decreasing (cap
-          // hardening)
-          if (XXValK[11] > XXVal[11]) {
-            kappa_flag = true;
-          } else {
-            XXVal      = XXValK;
-            kappa_flag = false;
-          }
+      std::vector<ScalarT> XXValK = XXVal;
+      solver.solve(dRdX, XXValK, R);
 
-          // debugging
-          // XXVal = XXValK;
-
-          iter++;
-        }  // end local NR
-
-        // compute sensitivity information, and pack back to X.
-        solver.computeFadInfo(dRdX, XXVal, R);
-
-      }  // end of plasticity
-
-      // update
-      sigmaVal(0, 0) = XXVal[0];
-      sigmaVal(0, 1) = XXVal[5];
-      sigmaVal(0, 2) = XXVal[4];
-      sigmaVal(1, 0) = XXVal[5];
-      sigmaVal(1, 1) = XXVal[1];
-      sigmaVal(1, 2) = XXVal[3];
-      sigmaVal(2, 0) = XXVal[4];
-      sigmaVal(2, 1) = XXVal[3];
-      sigmaVal(2, 2) = XXVal[2];
-
-      alphaVal(0, 0) = XXVal[6];
-      alphaVal(0, 1) = XXVal[10];
-      alphaVal(0, 2) = XXVal[9];
-      alphaVal(1, 0) = XXVal[10];
-      alphaVal(1, 1) = XXVal[7];
-      alphaVal(1, 2) = XXVal[8];
-      alphaVal(2, 0) = XXVal[9];
-      alphaVal(2, 1) = XXVal[8];
-      alphaVal(2, 2) = -XXVal[6] - XXVal[7];
-
-      kappaVal = XXVal[11];
-
-      dgammaVal = XXVal[12];
-
-      // compute plastic strain increment deps_plastic = compliance ( sigma_tr -
-      // sigma_(n+1));
-      minitensor::Tensor<ScalarT> dsigma = sigmaTr - sigmaVal;
-      deps_plastic = minitensor::dotdot(compliance, dsigma);
-
-      // compute its two invariants: devolps (volumetric) and deqps (deviatoric)
-      devolps = minitensor::trace(deps_plastic);
-      minitensor::Tensor<ScalarT> dev_plastic =
-          deps_plastic -
-          (1.0 / 3.0) * devolps * minitensor::identity<ScalarT>(3);
-      // deqps = std::sqrt(2./3.) * minitensor::norm(dev_plastic);
-      // use altenative definition, just differ by constants
-      deqps = std::sqrt(2) * minitensor::norm(dev_plastic);
-
-      // stress and back stress
-      for (int i = 0; i < num_dims_; ++i) {
-        for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, qp, i, j)     = sigmaVal(i, j);
-          backStress(cell, qp, i, j) = alphaVal(i, j);
-        }
+      // put restrictions on kappa: only allows monotonic decreasing (cap
+      // hardening)
+      if (XXValK[11] > XXVal[11]) {
+        kappa_flag = true;
+      } else {
+        XXVal      = XXValK;
+        kappa_flag = false;
       }
 
-      capParameter(cell, qp)     = kappaVal;
-      eqps(cell, qp)             = eqpsold(cell, qp) + deqps;
-      volPlasticStrain(cell, qp) = volPlasticStrainold(cell, qp) + devolps;
-
-      if (compute_tangent_) {
-        minitensor::Tensor4<ScalarT> Cep =
-            compute_Cep(Celastic, sigmaVal, alphaVal, kappaVal, dgammaVal);
-
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            for (int k(0); k < num_dims_; ++k) {
-              for (int l(0); l < num_dims_; ++l) {
-                tangent(cell, qp, i, j, k, l) = Cep(i, j, k, l);
-              }
-            }
+      // debugging
+      // XXVal = XXValK;
+
+      iter++;
+    }  // end local NR
+
+    // compute sensitivity information, and pack back to X.
+    solver.computeFadInfo(dRdX, XXVal, R);
+
+  }  // end of plasticity
+
+  // update
+  sigmaVal(0, 0) = XXVal[0];
+  sigmaVal(0, 1) = XXVal[5];
+  sigmaVal(0, 2) = XXVal[4];
+  sigmaVal(1, 0) = XXVal[5];
+  sigmaVal(1, 1) = XXVal[1];
+  sigmaVal(1, 2) = XXVal[3];
+  sigmaVal(2, 0) = XXVal[4];
+  sigmaVal(2, 1) = XXVal[3];
+  sigmaVal(2, 2) = XXVal[2];
+
+  alphaVal(0, 0) = XXVal[6];
+  alphaVal(0, 1) = XXVal[10];
+  alphaVal(0, 2) = XXVal[9];
+  alphaVal(1, 0) = XXVal[10];
+  alphaVal(1, 1) = XXVal[7];
+  alphaVal(1, 2) = XXVal[8];
+  alphaVal(2, 0) = XXVal[9];
+  alphaVal(2, 1) = XXVal[8];
+  alphaVal(2, 2) = -XXVal[6] - XXVal[7];
+
+  kappaVal = XXVal[11];
+
+  dgammaVal = XXVal[12];
+
+  // compute plastic strain increment deps_plastic = compliance ( sigma_tr -
+  // sigma_(n+1));
+  minitensor::Tensor<ScalarT> dsigma = sigmaTr - sigmaVal;
+  deps_plastic = minitensor::dotdot(compliance, dsigma);
+
+  // compute its two invariants: devolps (volumetric) and deqps (deviatoric)
+  devolps = minitensor::trace(deps_plastic);
+  minitensor::Tensor<ScalarT> dev_plastic =
+      deps_plastic -
+      (1.0 / 3.0) * devolps * minitensor::identity<ScalarT>(3);
+  // deqps = std::sqrt(2./3.) * minitensor::norm(dev_plastic);
+  // use altenative definition, just differ by constants
+  deqps = std::sqrt(2) * minitensor::norm(dev_plastic);
+
+  // stress and back stress
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      stress_(cell, pt, i, j)      = sigmaVal(i, j);
+      back_stress_(cell, pt, i, j) = alphaVal(i, j);
+    }
+  }
+
+  cap_parameter_(cell, pt)      = kappaVal;
+  eqps_(cell, pt)               = eqps_old_(cell, pt) + deqps;
+  vol_plastic_strain_(cell, pt) = vol_plastic_strain_old_(cell, pt) + devolps;
+
+  if (compute_tangent_) {
+    minitensor::Tensor4<ScalarT> Cep =
+        compute_Cep(Celastic, sigmaVal, alphaVal, kappaVal, dgammaVal);
+
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        for (int k(0); k < num_dims_; ++k) {
+          for (int l(0); l < num_dims_; ++l) {
+            tangent_(cell, pt, i, j, k, l) = Cep(i, j, k, l);
           }
         }
       }
-
-    }  // loop over qps
-
-  }  // loop over cell
-
-}  // end of evaluateFields
+    }
+  }
+}
 
 //**************************** all local functions *****************************
 
@@ -382,10 +339,10 @@ CapImplicitModel<EvalT, Traits>::computeState(
 template <typename EvalT, typename Traits>
 template <typename T>
 T
-CapImplicitModel<EvalT, Traits>::compute_f(
+CapImplicitKernel<EvalT, Traits>::compute_f(
     minitensor::Tensor<T>& sigma,
     minitensor::Tensor<T>& alpha,
-    T&                     kappa)
+    T&                     kappa) const
 {
   minitensor::Tensor<T> xi = sigma - alpha;
 
@@ -420,13 +377,13 @@ CapImplicitModel<EvalT, Traits>::compute_f(
 
 //------------------------ unknow variable value list ------------------------//
 template <typename EvalT, typename Traits>
-std::vector<typename CapImplicitModel<EvalT, Traits>::ScalarT>
+std::vector<typename CapImplicitKernel<EvalT, Traits>::ScalarT>
 // std::vector<typename EvalT::ScalarT>
-CapImplicitModel<EvalT, Traits>::initialize(
+CapImplicitKernel<EvalT, Traits>::initialize(
     minitensor::Tensor<ScalarT>& sigmaVal,
     minitensor::Tensor<ScalarT>& alphaVal,
     ScalarT&                     kappaVal,
-    ScalarT&                     dgammaVal)
+    ScalarT&                     dgammaVal) const
 {
   std::vector<ScalarT> XX(13);
 
@@ -450,7 +407,7 @@ CapImplicitModel<EvalT, Traits>::initialize(
 //----------------------- local iteration jacobian ---------------------------//
 template <typename EvalT, typename Traits>
 void
-CapImplicitModel<EvalT, Traits>::compute_ResidJacobian(
+CapImplicitKernel<EvalT, Traits>::compute_ResidJacobian(
     std::vector<ScalarT> const&         XXVal,
     std::vector<ScalarT>&               R,
     std::vector<ScalarT>&               dRdX,
@@ -458,7 +415,7 @@ CapImplicitModel<EvalT, Traits>::compute_ResidJacobian(
     const minitensor::Tensor<ScalarT>&  alphaVal,
     const ScalarT&                      kappaVal,
     minitensor::Tensor4<ScalarT> const& Celastic,
-    bool                                kappa_flag)
+    bool                                kappa_flag) const
 {
   std::vector<DFadType> Rfad(13);
   std::vector<DFadType> XX(13);
@@ -601,10 +558,10 @@ CapImplicitModel<EvalT, Traits>::compute_ResidJacobian(
 template <typename EvalT, typename Traits>
 template <typename T>
 T
-CapImplicitModel<EvalT, Traits>::compute_g(
+CapImplicitKernel<EvalT, Traits>::compute_g(
     minitensor::Tensor<T>& sigma,
     minitensor::Tensor<T>& alpha,
-    T&                     kappa)
+    T&                     kappa) const
 {
   minitensor::Tensor<T> xi = sigma - alpha;
 
@@ -641,10 +598,10 @@ CapImplicitModel<EvalT, Traits>::compute_g(
 
 //----------------------------- derivative -----------------------------------//
 template <typename EvalT, typename Traits>
-minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::ScalarT>
+minitensor::Tensor<typename CapImplicitKernel<EvalT, Traits>::ScalarT>
 // minitensor::Tensor<typename EvalT::DFadType>
-CapImplicitModel<EvalT, Traits>::compute_dfdsigma(
-    std::vector<ScalarT> const& XX)
+CapImplicitKernel<EvalT, Traits>::compute_dfdsigma(
+    std::vector<ScalarT> const& XX) const
 {
   std::vector<DFadType> XXFad(13);
   std::vector<ScalarT>  XXtmp(13);
@@ -698,10 +655,10 @@ CapImplicitModel<EvalT, Traits>::compute_dfdsigma(
 }
 
 template <typename EvalT, typename Traits>
-typename CapImplicitModel<EvalT, Traits>::ScalarT
+typename CapImplicitKernel<EvalT, Traits>::ScalarT
 // minitensor::Tensor<typename EvalT::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_dfdkappa(
-    std::vector<ScalarT> const& XX)
+CapImplicitKernel<EvalT, Traits>::compute_dfdkappa(
+    std::vector<ScalarT> const& XX) const
 {
   std::vector<DFadType> XXFad(13);
   std::vector<ScalarT>  XXtmp(13);
@@ -747,10 +704,10 @@ CapImplicitModel<EvalT, Traits>::compute_dfdkappa(
 }
 
 template <typename EvalT, typename Traits>
-minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::ScalarT>
+minitensor::Tensor<typename CapImplicitKernel<EvalT, Traits>::ScalarT>
 // minitensor::Tensor<typename EvalT::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_dgdsigma(
-    std::vector<ScalarT> const& XX)
+CapImplicitKernel<EvalT, Traits>::compute_dgdsigma(
+    std::vector<ScalarT> const& XX) const
 {
   std::vector<DFadType> XXFad(13);
   std::vector<ScalarT>  XXtmp(13);
@@ -804,10 +761,10 @@ CapImplicitModel<EvalT, Traits>::compute_dgdsigma(
 }
 
 template <typename EvalT, typename Traits>
-minitensor::Tensor<typename CapImplicitModel<EvalT, Traits>::DFadType>
+minitensor::Tensor<typename CapImplicitKernel<EvalT, Traits>::DFadType>
 // minitensor::Tensor<typename EvalT::DFadType>
-CapImplicitModel<EvalT, Traits>::compute_dgdsigma(
-    std::vector<DFadType> const& XX)
+CapImplicitKernel<EvalT, Traits>::compute_dgdsigma(
+    std::vector<DFadType> const& XX) const
 {
   std::vector<D2FadType> D2XX(13);
   std::vector<DFadType>  XXFadtmp(13);
@@ -866,7 +823,7 @@ CapImplicitModel<EvalT, Traits>::compute_dgdsigma(
 template <typename EvalT, typename Traits>
 template <typename T>
 T
-CapImplicitModel<EvalT, Traits>::compute_Galpha(T J2_alpha)
+CapImplicitKernel<EvalT, Traits>::compute_Galpha(T J2_alpha) const
 {
   if (N != 0)
     return 1.0 - pow(J2_alpha, 0.5) / N;
@@ -877,9 +834,9 @@ CapImplicitModel<EvalT, Traits>::compute_Galpha(T J2_alpha)
 template <typename EvalT, typename Traits>
 template <typename T>
 minitensor::Tensor<T>
-CapImplicitModel<EvalT, Traits>::compute_halpha(
+CapImplicitKernel<EvalT, Traits>::compute_halpha(
     minitensor::Tensor<T> const& dgdsigma,
-    T const                      J2_alpha)
+    T const                      J2_alpha) const
 {
   T Galpha = compute_Galpha(J2_alpha);
 
@@ -900,7 +857,7 @@ CapImplicitModel<EvalT, Traits>::compute_halpha(
 template <typename EvalT, typename Traits>
 template <typename T>
 T
-CapImplicitModel<EvalT, Traits>::compute_dedkappa(T const kappa)
+CapImplicitKernel<EvalT, Traits>::compute_dedkappa(T const kappa) const
 {
   //******** use analytical expression
   T Ff_kappa0 = A - C * std::exp(L * kappa0) - phi * kappa0;
@@ -922,9 +879,9 @@ CapImplicitModel<EvalT, Traits>::compute_dedkappa(T const kappa)
 template <typename EvalT, typename Traits>
 template <typename T>
 T
-CapImplicitModel<EvalT, Traits>::compute_hkappa(
+CapImplicitKernel<EvalT, Traits>::compute_hkappa(
     T const I1_dgdsigma,
-    T const dedkappa)
+    T const dedkappa) const
 {
   if (dedkappa != 0)
     return I1_dgdsigma / dedkappa;
@@ -934,13 +891,13 @@ CapImplicitModel<EvalT, Traits>::compute_hkappa(
 
 //------------------------ elasto-plastic tangent modulus --------------------//
 template <typename EvalT, typename Traits>
-minitensor::Tensor4<typename CapImplicitModel<EvalT, Traits>::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_Cep(
+minitensor::Tensor4<typename CapImplicitKernel<EvalT, Traits>::ScalarT>
+CapImplicitKernel<EvalT, Traits>::compute_Cep(
     minitensor::Tensor4<ScalarT>& Celastic,
     minitensor::Tensor<ScalarT>&  sigma,
     minitensor::Tensor<ScalarT>&  alpha,
     ScalarT&                      kappa,
-    ScalarT&                      dgamma)
+    ScalarT&                      dgamma) const
 {
   if (dgamma == 0) return Celastic;
 
@@ -994,13 +951,13 @@ CapImplicitModel<EvalT, Traits>::compute_Cep(
 
 //-------------------- elasto-plastic perfect tangent modulus ----------------//
 template <typename EvalT, typename Traits>
-minitensor::Tensor4<typename CapImplicitModel<EvalT, Traits>::ScalarT>
-CapImplicitModel<EvalT, Traits>::compute_Cepp(
+minitensor::Tensor4<typename CapImplicitKernel<EvalT, Traits>::ScalarT>
+CapImplicitKernel<EvalT, Traits>::compute_Cepp(
     minitensor::Tensor4<ScalarT>& Celastic,
     minitensor::Tensor<ScalarT>&  sigma,
     minitensor::Tensor<ScalarT>&  alpha,
     ScalarT&                      kappa,
-    ScalarT&                      dgamma)
+    ScalarT&                      dgamma) const
 {
   if (dgamma == 0) return Celastic;
 
@@ -41,6 +41,7 @@
 #include "OrtizPandolfiModel.hpp"
 #include "ParallelNeohookeanModel.hpp"
 #include "RIHMRModel.hpp"
+#include "SerialGursonModel.hpp"
 #include "StVenantKirchhoffModel.hpp"
 #include "TvergaardHutchinsonModel.hpp"
 #include "ViscoElasticModel.hpp"
@@ -297,6 +298,8 @@ ConstitutiveModelInterface<EvalT, Traits>::initializeModel(
     model = rcp(new AnisotropicHyperelasticDamageModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Gurson") {
     model = rcp(new GursonModel<EvalT, Traits>(p, dl));
+  } else if (model_name == "Serial Gurson") {
+    model = rcp(new SerialGursonModel<EvalT, Traits>(p, dl));
   } else if (model_name == "GursonHMR") {
     model = rcp(new GursonHMRModel<EvalT, Traits>(p, dl));
   } else if (model_name == "Mooney Rivlin") {
@@ -8,5 +8,18 @@
 
 #include "CreepModel.hpp"
 #include "CreepModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::CreepModel<EvalT, Traits>::CreepModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          CreepKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CreepKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::CreepModel)
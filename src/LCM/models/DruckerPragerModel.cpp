@@ -8,5 +8,18 @@
 
 #include "DruckerPragerModel.hpp"
 #include "DruckerPragerModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::DruckerPragerModel<EvalT, Traits>::DruckerPragerModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          DruckerPragerKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::DruckerPragerKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::DruckerPragerModel)
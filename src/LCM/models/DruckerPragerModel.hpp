@@ -9,7 +9,7 @@
 
 #include <MiniTensor.h>
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -19,68 +19,58 @@
 
 namespace LCM {
 
-///
-/// \brief Constitutive Model Base Class
-///
-///
-
 template <typename EvalT, typename Traits>
-class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct DruckerPragerKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  typedef typename Sacado::mpl::apply<FadType, ScalarT>::type DFadType;
-
-  using Base::field_name_map_;
-  using Base::num_dims_;
-  using Base::num_pts_;
-
   ///
   /// Constructor
   ///
-  DruckerPragerModel(
+  DruckerPragerKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Destructor
+  /// No copy constructor
   ///
-  virtual ~DruckerPragerModel(){};
+  DruckerPragerKernel(DruckerPragerKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
-  ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
-
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
-
- private:
+  /// No copy assignment
   ///
-  /// Private to prohibit copying
-  ///
-  DruckerPragerModel(const DruckerPragerModel&);
+  DruckerPragerKernel&
+  operator=(DruckerPragerKernel const&) = delete;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  DruckerPragerModel&
-  operator=(const DruckerPragerModel&);
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using DFadType = typename Sacado::mpl::apply<FadType, ScalarT>::type;
+
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField elastic_modulus_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField strain_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField friction_;
+  ScalarField stress_;
+
+  // State variables
+  Albany::MDArray eqps_old_;
+  Albany::MDArray friction_old_;
+  Albany::MDArray strain_old_;
+  Albany::MDArray stress_old_;
 
   ///
   /// Parameters for hardening law
@@ -92,6 +82,16 @@ class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   RealType Cf_, Cg_;
 
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+
   ///
   /// Compute residual and local jacobian
   ///
@@ -104,7 +104,22 @@ class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
       const ScalarT         qtr,
       const ScalarT         eqN,
       const ScalarT         mu,
-      const ScalarT         kappa);
+      const ScalarT         kappa) const;
+};
+
+///
+/// \brief Drucker-Prager Constitutive Model
+///
+template <typename EvalT, typename Traits>
+class DruckerPragerModel : public LCM::ParallelConstitutiveModel<
+                               EvalT,
+                               Traits,
+                               DruckerPragerKernel<EvalT, Traits>>
+{
+ public:
+  DruckerPragerModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
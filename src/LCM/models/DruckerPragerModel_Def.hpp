@@ -16,10 +16,11 @@ namespace LCM {
 
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
-DruckerPragerModel<EvalT, Traits>::DruckerPragerModel(
+DruckerPragerKernel<EvalT, Traits>::DruckerPragerKernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
-    const Teuchos::RCP<Albany::Layouts>& dl)
-    : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
       a0_(p->get<RealType>("Initial Friction Parameter a0", 0.0)),
       a1_(p->get<RealType>("Hardening Parameter a1", 0.0)),
       a2_(p->get<RealType>("Hardening Parameter a2", 1.0)),
@@ -29,92 +30,70 @@ DruckerPragerModel<EvalT, Traits>::DruckerPragerModel(
       Cg_(p->get<RealType>("Plastic Potential Parameter Cg", 0.0))
 {
   // define the dependent fields
-  this->dep_field_map_.insert(std::make_pair("Strain", dl->qp_tensor));
-  this->dep_field_map_.insert(std::make_pair("Poissons Ratio", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Elastic Modulus", dl->qp_scalar));
+  setDependentField("Strain", dl->qp_tensor);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
 
   // retrieve appropriate field name strings
-  std::string cauchy_string   = (*field_name_map_)["Cauchy_Stress"];
-  std::string strain_string   = (*field_name_map_)["Strain"];
-  std::string eqps_string     = (*field_name_map_)["eqps"];
-  std::string friction_string = (*field_name_map_)["Friction_Parameter"];
+  std::string cauchy_string   = field_name_map_["Cauchy_Stress"];
+  std::string strain_string   = field_name_map_["Strain"];
+  std::string eqps_string     = field_name_map_["eqps"];
+  std::string friction_string = field_name_map_["Friction_Parameter"];
 
   // define the evaluated fields
-  this->eval_field_map_.insert(std::make_pair(cauchy_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(eqps_string, dl->qp_scalar));
-  this->eval_field_map_.insert(std::make_pair(friction_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair("Material Tangent", dl->qp_tensor4));
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(friction_string, dl->qp_scalar);
+  setEvaluatedField("Material Tangent", dl->qp_tensor4);
 
   // define the state variables
   // strain
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(strain_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(strain_string, dl->qp_tensor, "scalar", 0.0, true, true);
   //
   // stress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(cauchy_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, true, true);
   //
   // eqps
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(eqps_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // alpha (friction parameter)
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(friction_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(a0_);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(friction_string, dl->qp_scalar, "scalar", a0_, true, true);
 }
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-DruckerPragerModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+DruckerPragerKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<ScalarT const>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
 {
   // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
-  std::string cauchy_string   = (*field_name_map_)["Cauchy_Stress"];
-  std::string strain_string   = (*field_name_map_)["Strain"];
-  std::string eqps_string     = (*field_name_map_)["eqps"];
-  std::string friction_string = (*field_name_map_)["Friction_Parameter"];
+  std::string cauchy_string   = field_name_map_["Cauchy_Stress"];
+  std::string strain_string   = field_name_map_["Strain"];
+  std::string eqps_string     = field_name_map_["eqps"];
+  std::string friction_string = field_name_map_["Friction_Parameter"];
 
   // extract evaluated MDFields
-  auto stress   = *eval_fields[cauchy_string];
-  auto eqps     = *eval_fields[eqps_string];
-  auto friction = *eval_fields[friction_string];
-  auto tangent  = *eval_fields["Material Tangent"];
+  stress_   = *eval_fields[cauchy_string];
+  eqps_     = *eval_fields[eqps_string];
+  friction_ = *eval_fields[friction_string];
 
   // get State Variables
-  Albany::MDArray strainold = (*workset.stateArrayPtr)[strain_string + "_old"];
-  Albany::MDArray stressold = (*workset.stateArrayPtr)[cauchy_string + "_old"];
-  Albany::MDArray eqpsold   = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray frictionold =
-      (*workset.stateArrayPtr)[friction_string + "_old"];
-
+  strain_old_   = (*workset.stateArrayPtr)[strain_string + "_old"];
+  stress_old_   = (*workset.stateArrayPtr)[cauchy_string + "_old"];
+  eqps_old_     = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  friction_old_ = (*workset.stateArrayPtr)[friction_string + "_old"];
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+DruckerPragerKernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
   minitensor::Tensor<ScalarT>  id(minitensor::eye<ScalarT>(num_dims_));
   minitensor::Tensor4<ScalarT> id1(minitensor::identity_1<ScalarT>(num_dims_));
   minitensor::Tensor4<ScalarT> id2(minitensor::identity_2<ScalarT>(num_dims_));
@@ -138,134 +117,120 @@ DruckerPragerModel<EvalT, Traits>::computeState(
   std::vector<ScalarT> R(4);
   std::vector<ScalarT> dRdX(16);
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int pt(0); pt < num_pts_; ++pt) {
-      lambda =
-          (elastic_modulus(cell, pt) * poissons_ratio(cell, pt)) /
-          ((1 + poissons_ratio(cell, pt)) * (1 - 2 * poissons_ratio(cell, pt)));
-      mu    = elastic_modulus(cell, pt) / (2 * (1 + poissons_ratio(cell, pt)));
-      kappa = lambda + 2.0 * mu / 3.0;
-
-      // 4-th order elasticity tensor
-      Celastic = lambda * id3 + mu * (id1 + id2);
-
-      // previous state (the fill doesn't work for state virable)
-      // sigmaN.fill( &stressold(cell,pt,0,0) );
-      // epsilonN.fill( &strainold(cell,pt,0,0) );
-
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          sigmaN(i, j)   = stressold(cell, pt, i, j);
-          epsilonN(i, j) = strainold(cell, pt, i, j);
-          // epsilon(i,j) = strain(cell,pt,i,j);
-        }
-      }
-
-      epsilon.fill(strain, cell, pt, 0, 0);
-      depsilon = epsilon - epsilonN;
-
-      alphaN = frictionold(cell, pt);
-      eqN    = eqpsold(cell, pt);
-
-      // trial state
-      sigma = sigmaN + minitensor::dotdot(Celastic, depsilon);
-      ptr   = minitensor::trace(sigma) / 3.0;
-      s     = sigma - ptr * id;
-      snorm = minitensor::dotdot(s, s);
-      if (snorm > 0) snorm = std::sqrt(snorm);
-      qtr = sqrt(3.0 / 2.0) * snorm;
-
-      // unit deviatoric tensor
-      if (snorm > 0) {
-        nhat = s / snorm;
-      } else {
-        nhat = id;
-      }
-
-      // check yielding
-      Phi = qtr + alphaN * ptr - Cf_;
+  lambda = (elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt)) /
+           ((1 + poissons_ratio_(cell, pt)) *
+            (1 - 2 * poissons_ratio_(cell, pt)));
+  mu    = elastic_modulus_(cell, pt) / (2 * (1 + poissons_ratio_(cell, pt)));
+  kappa = lambda + 2.0 * mu / 3.0;
+
+  // 4-th order elasticity tensor
+  Celastic = lambda * id3 + mu * (id1 + id2);
+
+  // previous state (the fill doesn't work for state virable)
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      sigmaN(i, j)   = stress_old_(cell, pt, i, j);
+      epsilonN(i, j) = strain_old_(cell, pt, i, j);
+    }
+  }
 
-      alpha = alphaN;
-      p     = ptr;
-      q     = qtr;
-      deq   = 0.0;
-      if (Phi > 1.0e-12) {  // plastic yielding
+  epsilon.fill(strain_, cell, pt, 0, 0);
+  depsilon = epsilon - epsilonN;
+
+  alphaN = friction_old_(cell, pt);
+  eqN    = eqps_old_(cell, pt);
+
+  // trial state
+  sigma = sigmaN + minitensor::dotdot(Celastic, depsilon);
+  ptr   = minitensor::trace(sigma) / 3.0;
+  s     = sigma - ptr * id;
+  snorm = minitensor::dotdot(s, s);
+  if (snorm > 0) snorm = std::sqrt(snorm);
+  qtr = sqrt(3.0 / 2.0) * snorm;
+
+  // unit deviatoric tensor
+  if (snorm > 0) {
+    nhat = s / snorm;
+  } else {
+    nhat = id;
+  }
 
-        // initialize local unknown vector
-        X[0] = ptr;
-        X[1] = qtr;
-        X[2] = alpha;
-        X[3] = deq;
+  // check yielding
+  Phi = qtr + alphaN * ptr - Cf_;
 
-        LocalNonlinearSolver<EvalT, Traits> solver;
-        int                                 iter = 0;
-        ScalarT norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
+  alpha = alphaN;
+  p     = ptr;
+  q     = qtr;
+  deq   = 0.0;
+  if (Phi > 1.0e-12) {  // plastic yielding
 
-        // local N-R loop
-        while (true) {
-          ResidualJacobian(X, R, dRdX, ptr, qtr, eqN, mu, kappa);
+    // initialize local unknown vector
+    X[0] = ptr;
+    X[1] = qtr;
+    X[2] = alpha;
+    X[3] = deq;
 
-          norm_residual = 0.0;
-          for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
-          norm_residual = std::sqrt(norm_residual);
+    LocalNonlinearSolver<EvalT, Traits> solver;
+    int                                 iter = 0;
+    ScalarT norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
 
-          if (iter == 0) norm_residual0 = norm_residual;
+    // local N-R loop
+    while (true) {
+      ResidualJacobian(X, R, dRdX, ptr, qtr, eqN, mu, kappa);
 
-          if (norm_residual0 != 0)
-            relative_residual = norm_residual / norm_residual0;
-          else
-            relative_residual = norm_residual0;
+      norm_residual = 0.0;
+      for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
+      norm_residual = std::sqrt(norm_residual);
 
-          // std::cout << iter << " "
-          //<< Sacado::ScalarValue<ScalarT>::eval(norm_residual)
-          //<< " " << Sacado::ScalarValue<ScalarT>::eval(relative_residual)
-          //<< std::endl;
+      if (iter == 0) norm_residual0 = norm_residual;
 
-          if (relative_residual < 1.0e-11 || norm_residual < 1.0e-11) break;
+      if (norm_residual0 != 0)
+        relative_residual = norm_residual / norm_residual0;
+      else
+        relative_residual = norm_residual0;
 
-          if (iter > 20) break;
+      if (relative_residual < 1.0e-11 || norm_residual < 1.0e-11) break;
 
-          // call local nonlinear solver
-          solver.solve(dRdX, X, R);
+      if (iter > 20) break;
 
-          iter++;
+      // call local nonlinear solver
+      solver.solve(dRdX, X, R);
 
-        }  // end of local N-R loop
+      iter++;
 
-        // compute sensitivity information w.r.t. system parameters
-        // and pack the sensitivity back to X
-        solver.computeFadInfo(dRdX, X, R);
+    }  // end of local N-R loop
 
-        // update
-        p     = X[0];
-        q     = X[1];
-        alpha = X[2];
-        deq   = X[3];
+    // compute sensitivity information w.r.t. system parameters
+    // and pack the sensitivity back to X
+    solver.computeFadInfo(dRdX, X, R);
 
-      }  // end plastic yielding
+    // update
+    p     = X[0];
+    q     = X[1];
+    alpha = X[2];
+    deq   = X[3];
 
-      eq = eqN + deq;
+  }  // end plastic yielding
 
-      s     = sqrt(2.0 / 3.0) * q * nhat;
-      sigma = s + p * id;
+  eq = eqN + deq;
 
-      eqps(cell, pt)     = eq;
-      friction(cell, pt) = alpha;
+  s     = sqrt(2.0 / 3.0) * q * nhat;
+  sigma = s + p * id;
 
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
-        }
-      }
+  eqps_(cell, pt)     = eq;
+  friction_(cell, pt) = alpha;
 
-    }  // end loop over pt
-  }    //  end loop over cell
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      stress_(cell, pt, i, j) = sigma(i, j);
+    }
+  }
 }
 //----------------------------------------------------------------------------
 // all local functions for compute state
 template <typename EvalT, typename Traits>
 void
-DruckerPragerModel<EvalT, Traits>::ResidualJacobian(
+DruckerPragerKernel<EvalT, Traits>::ResidualJacobian(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& R,
     std::vector<ScalarT>& dRdX,
@@ -273,7 +238,7 @@ DruckerPragerModel<EvalT, Traits>::ResidualJacobian(
     const ScalarT         qtr,
     const ScalarT         eqN,
     const ScalarT         mu,
-    const ScalarT         kappa)
+    const ScalarT         kappa) const
 {
   std::vector<DFadType> Rfad(4);
   std::vector<DFadType> Xfad(4);
@@ -7,98 +7,102 @@
 #if !defined(LCM_ElastoViscoplasticModel_hpp)
 #define LCM_ElastoViscoplasticModel_hpp
 
-#include "ConstitutiveModel.hpp"
+#include <vector>
+
+#include "Albany_Layouts.hpp"
 #include "ElastoViscoplasticCore.hpp"
+#include "ParallelConstitutiveModel.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Phalanx_config.hpp"
 
 namespace LCM {
 
-//! \brief Elasto Viscoplastic Constitutive Model
 template <typename EvalT, typename Traits>
-class ElastoViscoplasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct ElastoViscoplasticKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  typedef typename Sacado::Fad::DFad<ScalarT> Fad;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
-  // optional temperature support
-  using ConstitutiveModel<EvalT, Traits>::have_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::expansion_coeff_;
-  using ConstitutiveModel<EvalT, Traits>::ref_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::heat_capacity_;
-  using ConstitutiveModel<EvalT, Traits>::density_;
-  using ConstitutiveModel<EvalT, Traits>::temperature_;
-  using ConstitutiveModel<EvalT, Traits>::have_total_concentration_;
-  using ConstitutiveModel<EvalT, Traits>::have_total_bubble_density_;
-  using ConstitutiveModel<EvalT, Traits>::have_bubble_volume_fraction_;
-  using ConstitutiveModel<EvalT, Traits>::total_concentration_;
-  using ConstitutiveModel<EvalT, Traits>::total_bubble_density_;
-  using ConstitutiveModel<EvalT, Traits>::bubble_volume_fraction_;
-
   ///
   /// Constructor
   ///
-  ElastoViscoplasticModel(
+  ElastoViscoplasticKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Denstructor
+  /// No copy constructor
   ///
-  virtual ~ElastoViscoplasticModel(){};
+  ElastoViscoplasticKernel(ElastoViscoplasticKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
+  /// No copy assignment
   ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
-
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
+  ElastoViscoplasticKernel&
+  operator=(ElastoViscoplasticKernel const&) = delete;
 
- private:
-  ///
-  /// Private to prohibit copying
-  ///
-  ElastoViscoplasticModel(const ElastoViscoplasticModel&);
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using Fad              = typename Sacado::Fad::DFad<ScalarT>;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  ElastoViscoplasticModel&
-  operator=(const ElastoViscoplasticModel&);
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
 
-  ///
-  /// compute stresses
-  ///
-  // template<typename ArgT>
-  // void
-  // computeStress(minitensor::Tensor<ScalarT> const & F,
-  //     minitensor::Tensor<ArgT> const & Fp,
-  //     minitensor::Tensor<ArgT> & T,
-  //     minitensor::Tensor<ArgT> & S,
-  //     std::vector<ArgT> & shear) const;
+  // optional temperature support
+  using BaseKernel::density_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::have_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::temperature_;
+
+  // optional hydrogen and helium support
+  using BaseKernel::bubble_volume_fraction_;
+  using BaseKernel::have_bubble_volume_fraction_;
+  using BaseKernel::have_total_bubble_density_;
+  using BaseKernel::have_total_concentration_;
+  using BaseKernel::total_bubble_density_;
+  using BaseKernel::total_concentration_;
+
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField delta_time_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField flow_coeff_;
+  ConstScalarField flow_exp_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField recovery_modulus_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eps_ss_;
+  ScalarField eqps_;
+  ScalarField Fp_;
+  ScalarField kappa_;
+  ScalarField source_;
+  ScalarField stress_;
+  ScalarField void_volume_fraction_;
+
+  // State variables
+  Albany::MDArray eps_ss_old_;
+  Albany::MDArray eqps_old_;
+  Albany::MDArray Fp_old_;
+  Albany::MDArray kappa_old_;
+  Albany::MDArray void_volume_fraction_old_;
 
   ///
   /// Initial Void Volume
-  /// xs
+  ///
   RealType f0_;
 
   ///
@@ -132,32 +136,45 @@ class ElastoViscoplasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
   RealType alpha1_, alpha2_, Ra_;
 
   ///
-  /// Flow Rule Scale Factor
+  /// Helium void nucleation fraction per point, cell-major. A point
+  /// without bubbles keeps the value of the previous point.
   ///
-  RealType f_scale_;
-
-  ///
-  /// Solution options
-  ///
-  bool                 apply_slip_predictor_;
-  minitensor::StepType step_type_;
-
-  RealType implicit_nonlinear_solver_relative_tolerance_;
-  RealType implicit_nonlinear_solver_absolute_tolerance_;
-  int      implicit_nonlinear_solver_max_iterations_;
-  int      implicit_nonlinear_solver_min_iterations_;
+  std::vector<ScalarT> He_void_vol_frac_nuc_;
 
   ///
   /// flag to print convergence
   ///
   bool print_;
 
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+
   ///
   /// Compute effective void volume fraction
   ///
   template <typename T>
   T
-  compute_fstar(T f, RealType fc, RealType ff, RealType q1);
+  compute_fstar(T f, RealType fc, RealType ff, RealType q1) const;
+};
+
+//! \brief Elasto Viscoplastic Constitutive Model
+template <typename EvalT, typename Traits>
+class ElastoViscoplasticModel : public LCM::ParallelConstitutiveModel<
+                                    EvalT,
+                                    Traits,
+                                    ElastoViscoplasticKernel<EvalT, Traits>>
+{
+ public:
+  ElastoViscoplasticModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
@@ -8,5 +8,18 @@
 
 #include "GursonHMRModel.hpp"
 #include "GursonHMRModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::GursonHMRModel<EvalT, Traits>::GursonHMRModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          GursonHMRKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::GursonHMRKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::GursonHMRModel)
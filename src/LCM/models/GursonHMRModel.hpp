@@ -9,7 +9,7 @@
 
 #include <MiniTensor.h>
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -17,64 +17,66 @@
 
 namespace LCM {
 
-//! \brief Gurson Finite Deformation Model
 template <typename EvalT, typename Traits>
-class GursonHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct GursonHMRKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  using DFadType    = typename Sacado::mpl::apply<FadType, ScalarT>::type;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
   ///
   /// Constructor
   ///
-  GursonHMRModel(
+  GursonHMRKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Destructor
+  /// No copy constructor
   ///
-  virtual ~GursonHMRModel(){};
+  GursonHMRKernel(GursonHMRKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
+  /// No copy assignment
   ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+  GursonHMRKernel&
+  operator=(GursonHMRKernel const&) = delete;
 
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using DFadType = typename Sacado::mpl::apply<FadType, ScalarT>::type;
 
- private:
-  ///
-  /// Private to prohibit copying
-  ///
-  GursonHMRModel(const GursonHMRModel&);
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  GursonHMRModel&
-  operator=(const GursonHMRModel&);
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField recovery_modulus_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField ess_;
+  ScalarField Fp_;
+  ScalarField iso_hardening_;
+  ScalarField stress_;
+  ScalarField void_volume_;
+
+  // State variables
+  Albany::MDArray eqps_old_;
+  Albany::MDArray ess_old_;
+  Albany::MDArray Fp_old_;
+  Albany::MDArray iso_hardening_old_;
+  Albany::MDArray void_volume_old_;
 
   ///
   /// Saturation hardening constants
@@ -106,6 +108,16 @@ class GursonHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   RealType q1_, q2_, q3_;
 
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+
   ///
   /// Compute Yield Function
   ///
@@ -116,7 +128,7 @@ class GursonHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
       ScalarT const&                     fvoid,
       ScalarT const&                     Y,
       ScalarT const&                     isoH,
-      ScalarT const&                     jacobian);
+      ScalarT const&                     jacobian) const;
 
   ///
   /// Compute Residual and Local Jacobian
@@ -135,7 +147,20 @@ class GursonHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
       const ScalarT&               H,
       const ScalarT&               Y,
       const ScalarT&               Rd,
-      const ScalarT&               jacobian);
+      const ScalarT&               jacobian) const;
+};
+
+//! \brief Gurson Finite Deformation Model
+template <typename EvalT, typename Traits>
+class GursonHMRModel : public LCM::ParallelConstitutiveModel<
+                           EvalT,
+                           Traits,
+                           GursonHMRKernel<EvalT, Traits>>
+{
+ public:
+  GursonHMRModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
@@ -14,10 +14,11 @@ namespace LCM {
 
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
-GursonHMRModel<EvalT, Traits>::GursonHMRModel(
+GursonHMRKernel<EvalT, Traits>::GursonHMRKernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
-    const Teuchos::RCP<Albany::Layouts>& dl)
-    : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
       sat_mod_(p->get<RealType>("Saturation Modulus", 0.0)),
       sat_exp_(p->get<RealType>("Saturation Exponent", 0.0)),
       f0_(p->get<RealType>("Initial Void Volume", 0.0)),
@@ -32,131 +33,97 @@ GursonHMRModel<EvalT, Traits>::GursonHMRModel(
       q3_(p->get<RealType>("Yield Parameter q3", 1.0))
 {
   // define the dependent fields
-  this->dep_field_map_.insert(std::make_pair("F", dl->qp_tensor));
-  this->dep_field_map_.insert(std::make_pair("J", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Poissons Ratio", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Elastic Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Yield Strength", dl->qp_scalar));
-  this->dep_field_map_.insert(
-      std::make_pair("Hardening Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(
-      std::make_pair("Recovery Modulus", dl->qp_scalar));
+  setDependentField("F", dl->qp_tensor);
+  setDependentField("J", dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+  setDependentField("Yield Strength", dl->qp_scalar);
+  setDependentField("Hardening Modulus", dl->qp_scalar);
+  setDependentField("Recovery Modulus", dl->qp_scalar);
 
   // retrieve appropriate field name strings
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string Fp_string           = (*field_name_map_)["Fp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string ess_string          = (*field_name_map_)["ess"];
-  std::string isoHardening_string = (*field_name_map_)["isotropic_hardening"];
-  std::string void_string         = (*field_name_map_)["Void_Volume"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string           = field_name_map_["Fp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string ess_string          = field_name_map_["ess"];
+  std::string isoHardening_string = field_name_map_["isotropic_hardening"];
+  std::string void_string         = field_name_map_["Void_Volume"];
 
   // define the evaluated fields
-  this->eval_field_map_.insert(std::make_pair(cauchy_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(Fp_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(eqps_string, dl->qp_scalar));
-  this->eval_field_map_.insert(std::make_pair(ess_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair(isoHardening_string, dl->qp_scalar));
-  this->eval_field_map_.insert(std::make_pair(void_string, dl->qp_scalar));
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(Fp_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(ess_string, dl->qp_scalar);
+  setEvaluatedField(isoHardening_string, dl->qp_scalar);
+  setEvaluatedField(void_string, dl->qp_scalar);
 
   // define the state variables
   //
   // stress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(cauchy_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(false);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, false, true);
   //
   // Fp
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(Fp_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("identity");
-  this->state_var_init_values_.push_back(1.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(false);
+  addStateVariable(Fp_string, dl->qp_tensor, "identity", 1.0, true, false);
   //
   // eqps
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(eqps_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // ess
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(ess_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(ess_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // isoHardening
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(isoHardening_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(
+      isoHardening_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // void volume
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(void_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(f0_);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(void_string, dl->qp_scalar, "scalar", f0_, true, true);
 }
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-GursonHMRModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+GursonHMRKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<ScalarT const>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto recovery_modulus  = *dep_fields["Recovery Modulus"];
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  recovery_modulus_  = *dep_fields["Recovery Modulus"];
 
   // retrieve appropriate field name strings
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string Fp_string           = (*field_name_map_)["Fp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string ess_string          = (*field_name_map_)["ess"];
-  std::string isoHardening_string = (*field_name_map_)["isoHardening"];
-  std::string void_string         = (*field_name_map_)["Void_Volume"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string           = field_name_map_["Fp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string ess_string          = field_name_map_["ess"];
+  std::string isoHardening_string = field_name_map_["isotropic_hardening"];
+  std::string void_string         = field_name_map_["Void_Volume"];
 
   // extract evaluated MDFields
-  auto stress       = *eval_fields[cauchy_string];
-  auto Fp           = *eval_fields[Fp_string];
-  auto eqps         = *eval_fields[eqps_string];
-  auto ess          = *eval_fields[ess_string];
-  auto isoHardening = *eval_fields[isoHardening_string];
-  auto void_volume  = *eval_fields[void_string];
+  stress_        = *eval_fields[cauchy_string];
+  Fp_            = *eval_fields[Fp_string];
+  eqps_          = *eval_fields[eqps_string];
+  ess_           = *eval_fields[ess_string];
+  iso_hardening_ = *eval_fields[isoHardening_string];
+  void_volume_   = *eval_fields[void_string];
 
   // get State Variables
-  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray ess_old  = (*workset.stateArrayPtr)[ess_string + "_old"];
-  Albany::MDArray isoHardening_old =
+  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
+  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  ess_old_  = (*workset.stateArrayPtr)[ess_string + "_old"];
+  iso_hardening_old_ =
       (*workset.stateArrayPtr)[isoHardening_string + "_old"];
-  Albany::MDArray void_volume_old =
-      (*workset.stateArrayPtr)[void_string + "_old"];
-
+  void_volume_old_ = (*workset.stateArrayPtr)[void_string + "_old"];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+GursonHMRKernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
   minitensor::Tensor<ScalarT> F(num_dims_), be(num_dims_), logbe(num_dims_);
   minitensor::Tensor<ScalarT> s(num_dims_), sigma(num_dims_), N(num_dims_);
   minitensor::Tensor<ScalarT> A(num_dims_), expA(num_dims_), Fpnew(num_dims_);
@@ -176,187 +143,179 @@ GursonHMRModel<EvalT, Traits>::computeState(
   ScalarT norm_residual0(0.0), norm_residual(0.0), relative_residual(0.0);
   LocalNonlinearSolver<EvalT, Traits> solver;
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3.0 * (1.0 - 2.0 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      H  = hardening_modulus(cell, pt);
-      Y  = yield_strength(cell, pt);
-      Rd = recovery_modulus(cell, pt);
-
-      // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
-      // Fpn.fill( &Fpold(cell,pt,int(0),int(0)) );
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          Fpn(i, j) = static_cast<ScalarT>(Fp_old(cell, pt, i, j));
-        }
-      }
+  kappa = elastic_modulus_(cell, pt) /
+          (3.0 * (1.0 - 2.0 * poissons_ratio_(cell, pt)));
+  mu = elastic_modulus_(cell, pt) / (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+  H  = hardening_modulus_(cell, pt);
+  Y  = yield_strength_(cell, pt);
+  Rd = recovery_modulus_(cell, pt);
+
+  // fill local tensors
+  F.fill(def_grad_, cell, pt, 0, 0);
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      Fpn(i, j) = static_cast<ScalarT>(Fp_old_(cell, pt, i, j));
+    }
+  }
 
-      // compute trial state
-      Fpinv      = minitensor::inverse(Fpn);
-      Cpinv      = Fpinv * minitensor::transpose(Fpinv);
-      be         = F * Cpinv * minitensor::transpose(F);
-      logbe      = minitensor::log_sym<ScalarT>(be);
-      trlogbeby3 = minitensor::trace(logbe) / 3.0;
-      detbe      = minitensor::det<ScalarT>(be);
-      s          = mu * (logbe - trlogbeby3 * I);
-      p          = 0.5 * kappa * std::log(detbe);
-      fvoid      = void_volume_old(cell, pt);
-      eq         = eqps_old(cell, pt);
-      es         = ess_old(cell, pt);
-      isoH       = isoHardening_old(cell, pt);
-
-      // check yield condition
-      Phi = YieldFunction(s, p, fvoid, Y, isoH, J(cell, pt));
-
-      dgam = 0.0;
-      if (Phi > 0.0) {  // plastic yielding
-
-        // initialize local unknown vector
-        X[0] = dgam;
-        X[1] = p;
-        X[2] = fvoid;
-        X[3] = es;
-
-        int iter          = 0;
-        norm_residual0    = 0.0;
-        norm_residual     = 0.0;
-        relative_residual = 0.0;
-
-        // local N-R loop
-        while (true) {
-          ResidualJacobian(
-              X, R, dRdX, p, fvoid, es, s, mu, kappa, H, Y, Rd, J(cell, pt));
-
-          norm_residual = 0.0;
-          for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
-
-          norm_residual = std::sqrt(norm_residual);
-
-          if (iter == 0) norm_residual0 = norm_residual;
-
-          if (norm_residual0 != 0)
-            relative_residual = norm_residual / norm_residual0;
-          else
-            relative_residual = norm_residual0;
-
-          // std::cout << iter << " "
-          //<< norm_residual << " " << relative_residual << std::endl;
-
-          if (relative_residual < 1.0e-11 || norm_residual < 1.0e-11) break;
-
-          if (iter > 20) break;
-
-          // call local nonlinear solver
-          solver.solve(dRdX, X, R);
-
-          iter++;
-        }  // end of local N-R loop
-
-        // compute sensitivity information w.r.t. system parameters
-        // and pack the sensitivity back to X
-        solver.computeFadInfo(dRdX, X, R);
-
-        // update
-        dgam  = X[0];
-        p     = X[1];
-        fvoid = X[2];
-        es    = X[3];
-
-        isoH = 2.0 * mu * es;
-
-        // accounts for void coalescence
-        //          fvoid_star = fvoid;
-        //          if ((fvoid > fc_) && (fvoid < ff_)) {
-        //            if ((ff_ - fc_) != 0.0) {
-        //              fvoid_star = fc_ + (fvoid - fc_) * (1.0 / q1_ - fc_) /
-        //              (ff_ - fc_);
-        //            }
-        //          }
-        //          else if (fvoid >= ff_) {
-        //            fvoid_star = 1.0 / q1_;
-        //            if (fvoid_star > 1.0)
-        //              fvoid_star = 1.0;
-        //          }
-
-        // deviatoric stress tensor
-        s = (1.0 / (1.0 + 2.0 * mu * dgam)) * s;
-
-        // hardening
-        Ybar = Y + isoH;
-
-        // Kirchhoff_yield_stress = Cauchy_yield_stress * J
-        // Ybar = Ybar * J(cell, pt);
-
-        // dPhi w.r.t. dKirchhoff_stress
-        ScalarT tmp = 1.5 * q2_ * p / Ybar;
-        ScalarT deq = dgam / Ybar / (1.0 - fvoid) *
-                      (minitensor::dotdot(s, s) +
-                       q1_ * q2_ * p * Ybar * fvoid * std::sinh(tmp));
-        eq = eq + deq;
-
-        dPhi = s + 1.0 / 3.0 * q1_ * q2_ * Ybar * fvoid * std::sinh(tmp) * I;
-
-        expA = minitensor::exp(dgam * dPhi);
-
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = 0.0;
-            for (int k(0); k < num_dims_; ++k) {
-              Fp(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
-            }
-          }
+  // compute trial state
+  Fpinv      = minitensor::inverse(Fpn);
+  Cpinv      = Fpinv * minitensor::transpose(Fpinv);
+  be         = F * Cpinv * minitensor::transpose(F);
+  logbe      = minitensor::log_sym<ScalarT>(be);
+  trlogbeby3 = minitensor::trace(logbe) / 3.0;
+  detbe      = minitensor::det<ScalarT>(be);
+  s          = mu * (logbe - trlogbeby3 * I);
+  p          = 0.5 * kappa * std::log(detbe);
+  fvoid      = void_volume_old_(cell, pt);
+  eq         = eqps_old_(cell, pt);
+  es         = ess_old_(cell, pt);
+  isoH       = iso_hardening_old_(cell, pt);
+
+  // check yield condition
+  Phi = YieldFunction(s, p, fvoid, Y, isoH, J_(cell, pt));
+
+  dgam = 0.0;
+  if (Phi > 0.0) {  // plastic yielding
+
+    // initialize local unknown vector
+    X[0] = dgam;
+    X[1] = p;
+    X[2] = fvoid;
+    X[3] = es;
+
+    int iter          = 0;
+    norm_residual0    = 0.0;
+    norm_residual     = 0.0;
+    relative_residual = 0.0;
+
+    // local N-R loop
+    while (true) {
+      ResidualJacobian(
+          X, R, dRdX, p, fvoid, es, s, mu, kappa, H, Y, Rd, J_(cell, pt));
+
+      norm_residual = 0.0;
+      for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
+
+      norm_residual = std::sqrt(norm_residual);
+
+      if (iter == 0) norm_residual0 = norm_residual;
+
+      if (norm_residual0 != 0)
+        relative_residual = norm_residual / norm_residual0;
+      else
+        relative_residual = norm_residual0;
+
+      // std::cout << iter << " "
+      //<< norm_residual << " " << relative_residual << std::endl;
+
+      if (relative_residual < 1.0e-11 || norm_residual < 1.0e-11) break;
+
+      if (iter > 20) break;
+
+      // call local nonlinear solver
+      solver.solve(dRdX, X, R);
+
+      iter++;
+    }  // end of local N-R loop
+
+    // compute sensitivity information w.r.t. system parameters
+    // and pack the sensitivity back to X
+    solver.computeFadInfo(dRdX, X, R);
+
+    // update
+    dgam  = X[0];
+    p     = X[1];
+    fvoid = X[2];
+    es    = X[3];
+
+    isoH = 2.0 * mu * es;
+
+    // accounts for void coalescence
+    //          fvoid_star = fvoid;
+    //          if ((fvoid > fc_) && (fvoid < ff_)) {
+    //            if ((ff_ - fc_) != 0.0) {
+    //              fvoid_star = fc_ + (fvoid - fc_) * (1.0 / q1_ - fc_) /
+    //              (ff_ - fc_);
+    //            }
+    //          }
+    //          else if (fvoid >= ff_) {
+    //            fvoid_star = 1.0 / q1_;
+    //            if (fvoid_star > 1.0)
+    //              fvoid_star = 1.0;
+    //          }
+
+    // deviatoric stress tensor
+    s = (1.0 / (1.0 + 2.0 * mu * dgam)) * s;
+
+    // hardening
+    Ybar = Y + isoH;
+
+    // Kirchhoff_yield_stress = Cauchy_yield_stress * J
+    // Ybar = Ybar * J_(cell, pt);
+
+    // dPhi w.r.t. dKirchhoff_stress
+    ScalarT tmp = 1.5 * q2_ * p / Ybar;
+    ScalarT deq = dgam / Ybar / (1.0 - fvoid) *
+                  (minitensor::dotdot(s, s) +
+                   q1_ * q2_ * p * Ybar * fvoid * std::sinh(tmp));
+    eq = eq + deq;
+
+    dPhi = s + 1.0 / 3.0 * q1_ * q2_ * Ybar * fvoid * std::sinh(tmp) * I;
+
+    expA = minitensor::exp(dgam * dPhi);
+
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        Fp_(cell, pt, i, j) = 0.0;
+        for (int k(0); k < num_dims_; ++k) {
+          Fp_(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
         }
+      }
+    }
 
-        eqps(cell, pt)         = eq;
-        ess(cell, pt)          = es;
-        isoHardening(cell, pt) = isoH;
-        void_volume(cell, pt)  = fvoid;
-
-      }       // end of plastic loading
-      else {  // elasticity, set state variables to previous values
-
-        eqps(cell, pt)         = eqps_old(cell, pt);
-        ess(cell, pt)          = ess_old(cell, pt);
-        isoHardening(cell, pt) = isoHardening_old(cell, pt);
-        void_volume(cell, pt)  = void_volume_old(cell, pt);
+    eqps_(cell, pt)         = eq;
+    ess_(cell, pt)          = es;
+    iso_hardening_(cell, pt) = isoH;
+    void_volume_(cell, pt)  = fvoid;
 
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fp_old(cell, pt, i, j);
-          }
-        }
+  }       // end of plastic loading
+  else {  // elasticity, set state variables to previous values
 
-      }  // end of elasticity
+    eqps_(cell, pt)         = eqps_old_(cell, pt);
+    ess_(cell, pt)          = ess_old_(cell, pt);
+    iso_hardening_(cell, pt) = iso_hardening_old_(cell, pt);
+    void_volume_(cell, pt)  = void_volume_old_(cell, pt);
 
-      // compute Cauchy stress tensor
-      // note that p also has to be divided by J
-      // because the one computed from return mapping is the Kirchhoff pressure
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = s(i, j) / J(cell, pt);
-        }
-        stress(cell, pt, i, i) += p / J(cell, pt);
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) {
+        Fp_(cell, pt, i, j) = Fp_old_(cell, pt, i, j);
       }
-
-    }  // end of loop over Gauss points
-  }    // end of loop over cells
-
-}  // end of compute state
-
+    }
+
+  }  // end of elasticity
+
+  // compute Cauchy stress tensor
+  // note that p also has to be divided by J
+  // because the one computed from return mapping is the Kirchhoff pressure
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      stress_(cell, pt, i, j) = s(i, j) / J_(cell, pt);
+    }
+    stress_(cell, pt, i, i) += p / J_(cell, pt);
+  }
+}
 //------------------------------------------------------------------------------
 // all local functions for compute state
 template <typename EvalT, typename Traits>
 typename EvalT::ScalarT
-GursonHMRModel<EvalT, Traits>::YieldFunction(
+GursonHMRKernel<EvalT, Traits>::YieldFunction(
     minitensor::Tensor<ScalarT> const& s,
     ScalarT const&                     p,
     ScalarT const&                     fvoid,
     ScalarT const&                     Y,
     ScalarT const&                     isoH,
-    ScalarT const&                     jacobian)
+    ScalarT const&                     jacobian) const
 {
   // yield strength
   ScalarT Ybar = Y + isoH;
@@ -398,7 +357,7 @@ GursonHMRModel<EvalT, Traits>::YieldFunction(
 
 template <typename EvalT, typename Traits>
 void
-GursonHMRModel<EvalT, Traits>::ResidualJacobian(
+GursonHMRKernel<EvalT, Traits>::ResidualJacobian(
     std::vector<ScalarT>&        X,
     std::vector<ScalarT>&        R,
     std::vector<ScalarT>&        dRdX,
@@ -411,7 +370,7 @@ GursonHMRModel<EvalT, Traits>::ResidualJacobian(
     const ScalarT&               H,
     const ScalarT&               Y,
     const ScalarT&               Rd,
-    const ScalarT&               jacobian)
+    const ScalarT&               jacobian) const
 {
   ScalarT               sq32 = std::sqrt(3.0 / 2.0);
   ScalarT               sq23 = std::sqrt(2.0 / 3.0);
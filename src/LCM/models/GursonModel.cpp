@@ -8,5 +8,18 @@
 
 #include "GursonModel.hpp"
 #include "GursonModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::GursonModel<EvalT, Traits>::GursonModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          GursonKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::GursonKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::GursonModel)
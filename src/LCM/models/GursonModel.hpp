@@ -9,7 +9,7 @@
 
 #include <MiniTensor.h>
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -17,64 +17,61 @@
 
 namespace LCM {
 
-//! \brief Gurson Finite Deformation Model
 template <typename EvalT, typename Traits>
-class GursonModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct GursonKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  typedef typename Sacado::mpl::apply<FadType, ScalarT>::type DFadType;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
   ///
   /// Constructor
   ///
-  GursonModel(
+  GursonKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Destructor
+  /// No copy constructor
   ///
-  virtual ~GursonModel(){};
+  GursonKernel(GursonKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
+  /// No copy assignment
   ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+  GursonKernel&
+  operator=(GursonKernel const&) = delete;
 
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using DFadType = typename Sacado::mpl::apply<FadType, ScalarT>::type;
 
- private:
-  ///
-  /// Private to prohibit copying
-  ///
-  GursonModel(const GursonModel&);
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  GursonModel&
-  operator=(const GursonModel&);
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField Fp_;
+  ScalarField stress_;
+  ScalarField void_volume_;
+
+  // State variables
+  Albany::MDArray eqps_old_;
+  Albany::MDArray Fp_old_;
+  Albany::MDArray void_volume_old_;
 
   ///
   /// Saturation hardening constants
@@ -106,6 +103,16 @@ class GursonModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   RealType q1_, q2_, q3_;
 
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+
   ///
   /// Compute Yield Function
   ///
@@ -118,7 +125,7 @@ class GursonModel : public LCM::ConstitutiveModel<EvalT, Traits>
       ScalarT const&                     K,
       ScalarT const&                     Y,
       ScalarT const&                     jacobian,
-      ScalarT const&                     E);
+      ScalarT const&                     E) const;
 
   ///
   /// Compute Residual and Local Jacobian
@@ -136,7 +143,20 @@ class GursonModel : public LCM::ConstitutiveModel<EvalT, Traits>
       const ScalarT&               kappa,
       const ScalarT&               K,
       const ScalarT&               Y,
-      const ScalarT&               jacobian);
+      const ScalarT&               jacobian) const;
+};
+
+//! \brief Gurson Finite Deformation Model
+template <typename EvalT, typename Traits>
+class GursonModel : public LCM::ParallelConstitutiveModel<
+                        EvalT,
+                        Traits,
+                        GursonKernel<EvalT, Traits>>
+{
+ public:
+  GursonModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
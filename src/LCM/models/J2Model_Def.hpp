@@ -14,133 +14,131 @@ namespace LCM {
 
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
-J2Model<EvalT, Traits>::J2Model(
+J2Kernel<EvalT, Traits>::J2Kernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
-    const Teuchos::RCP<Albany::Layouts>& dl)
-    : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
       sat_mod_(p->get<RealType>("Saturation Modulus", 0.0)),
       sat_exp_(p->get<RealType>("Saturation Exponent", 0.0))
 {
   // retrive appropriate field name strings
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string Fp_string           = (*field_name_map_)["Fp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string yieldSurface_string = (*field_name_map_)["Yield_Surface"];
-  std::string source_string       = (*field_name_map_)["Mechanical_Source"];
-  std::string F_string            = (*field_name_map_)["F"];
-  std::string J_string            = (*field_name_map_)["J"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string           = field_name_map_["Fp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string source_string       = field_name_map_["Mechanical_Source"];
+  std::string F_string            = field_name_map_["F"];
+  std::string J_string            = field_name_map_["J"];
 
   // define the dependent fields
-  this->dep_field_map_.insert(std::make_pair(F_string, dl->qp_tensor));
-  this->dep_field_map_.insert(std::make_pair(J_string, dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Poissons Ratio", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Elastic Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Yield Strength", dl->qp_scalar));
-  this->dep_field_map_.insert(
-      std::make_pair("Hardening Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Delta Time", dl->workset_scalar));
+  setDependentField(F_string, dl->qp_tensor);
+  setDependentField(J_string, dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+  setDependentField("Yield Strength", dl->qp_scalar);
+  setDependentField("Hardening Modulus", dl->qp_scalar);
+  setDependentField("Delta Time", dl->workset_scalar);
 
   // define the evaluated fields
-  this->eval_field_map_.insert(std::make_pair(cauchy_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(Fp_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(eqps_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair(yieldSurface_string, dl->qp_scalar));
-  if (have_temperature_) {
-    this->eval_field_map_.insert(std::make_pair(source_string, dl->qp_scalar));
-  }
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(Fp_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(yieldSurface_string, dl->qp_scalar);
+  if (have_temperature_) { setEvaluatedField(source_string, dl->qp_scalar); }
 
   // define the state variables
   //
   // stress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(cauchy_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(false);
-  this->state_var_output_flags_.push_back(
+  addStateVariable(
+      cauchy_string,
+      dl->qp_tensor,
+      "scalar",
+      0.0,
+      false,
       p->get<bool>("Output Cauchy Stress", false));
   //
   // Fp
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(Fp_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("identity");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(p->get<bool>("Output Fp", false));
+  addStateVariable(
+      Fp_string,
+      dl->qp_tensor,
+      "identity",
+      0.0,
+      true,
+      p->get<bool>("Output Fp", false));
   //
   // eqps
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(eqps_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(p->get<bool>("Output eqps", false));
+  addStateVariable(
+      eqps_string,
+      dl->qp_scalar,
+      "scalar",
+      0.0,
+      true,
+      p->get<bool>("Output eqps", false));
   //
   // yield surface
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(yieldSurface_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(false);
-  this->state_var_output_flags_.push_back(
+  addStateVariable(
+      yieldSurface_string,
+      dl->qp_scalar,
+      "scalar",
+      0.0,
+      false,
       p->get<bool>("Output Yield Surface", false));
   //
   // mechanical source
   if (have_temperature_) {
-    this->num_state_variables_++;
-    this->state_var_names_.push_back(source_string);
-    this->state_var_layouts_.push_back(dl->qp_scalar);
-    this->state_var_init_types_.push_back("scalar");
-    this->state_var_init_values_.push_back(0.0);
-    this->state_var_old_state_flags_.push_back(false);
-    this->state_var_output_flags_.push_back(
+    addStateVariable(
+        source_string,
+        dl->qp_scalar,
+        "scalar",
+        0.0,
+        false,
         p->get<bool>("Output Mechanical Source", false));
   }
 }
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-J2Model<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+J2Kernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<ScalarT const>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
 {
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string Fp_string           = (*field_name_map_)["Fp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string yieldSurface_string = (*field_name_map_)["Yield_Surface"];
-  std::string source_string       = (*field_name_map_)["Mechanical_Source"];
-  std::string F_string            = (*field_name_map_)["F"];
-  std::string J_string            = (*field_name_map_)["J"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string Fp_string           = field_name_map_["Fp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string yieldSurface_string = field_name_map_["Yield_Surface"];
+  std::string source_string       = field_name_map_["Mechanical_Source"];
+  std::string F_string            = field_name_map_["F"];
+  std::string J_string            = field_name_map_["J"];
 
   // extract dependent MDFields
-  auto def_grad          = *dep_fields[F_string];
-  auto J                 = *dep_fields[J_string];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto delta_time        = *dep_fields["Delta Time"];
+  def_grad_          = *dep_fields[F_string];
+  J_                 = *dep_fields[J_string];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  delta_time_        = *dep_fields["Delta Time"];
 
   // extract evaluated MDFields
-  auto                  stress    = *eval_fields[cauchy_string];
-  auto                  Fp        = *eval_fields[Fp_string];
-  auto                  eqps      = *eval_fields[eqps_string];
-  auto                  yieldSurf = *eval_fields[yieldSurface_string];
-  PHX::MDField<ScalarT> source;
-  if (have_temperature_) { source = *eval_fields[source_string]; }
+  stress_     = *eval_fields[cauchy_string];
+  Fp_         = *eval_fields[Fp_string];
+  eqps_       = *eval_fields[eqps_string];
+  yield_surf_ = *eval_fields[yieldSurface_string];
+  if (have_temperature_) { source_ = *eval_fields[source_string]; }
 
   // get State Variables
-  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
-
+  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
+  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+J2Kernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
   ScalarT kappa, mu, mubar, K, Y;
-  ScalarT Jm23, trace, smag2, smag, f, p, dgam;
+  ScalarT Jm23, smag, f, p, dgam;
   ScalarT sq23(std::sqrt(2. / 3.));
 
   minitensor::Tensor<ScalarT> F(num_dims_), be(num_dims_), s(num_dims_),
@@ -151,169 +149,150 @@ J2Model<EvalT, Traits>::computeState(
   minitensor::Tensor<ScalarT> Fpn(num_dims_), Fpinv(num_dims_),
       Cpinv(num_dims_);
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      K    = hardening_modulus(cell, pt);
-      Y    = yield_strength(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2. / 3.);
-      // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
-
-      // Mechanical deformation gradient
-      auto Fm = minitensor::Tensor<ScalarT>(F);
-      if (have_temperature_) {
-        // Compute the mechanical deformation gradient Fm based on the
-        // multiplicative decomposition of the deformation gradient
-        //
-        //            F = Fm.Ft => Fm = F.inv(Ft)
-        //
-        // where Ft is the thermal part of F, given as
-        //
-        //     Ft = Le * I = exp(alpha * dtemp) * I
-        //
-        // Le = exp(alpha*dtemp) is the thermal stretch and alpha the
-        // coefficient of thermal expansion.
-        ScalarT dtemp           = temperature_(cell, pt) - ref_temperature_;
-        ScalarT thermal_stretch = std::exp(expansion_coeff_ * dtemp);
-        Fm /= thermal_stretch;
-      }
-
-      // Fpn.fill( &Fpold(cell,pt,int(0),int(0)) );
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          Fpn(i, j) = ScalarT(Fpold(cell, pt, i, j));
-        }
-      }
-
-      // compute trial state
-      Fpinv = minitensor::inverse(Fpn);
-
-      Cpinv = Fpinv * minitensor::transpose(Fpinv);
-      be    = Jm23 * Fm * Cpinv * minitensor::transpose(Fm);
-      s     = mu * minitensor::dev(be);
-
-      mubar = minitensor::trace(be) * mu / (num_dims_);
-
-      // check yield condition
-      smag = minitensor::norm(s);
-      f    = smag -
-          sq23 * (Y + K * eqpsold(cell, pt) +
-                  sat_mod_ * (1. - std::exp(-sat_exp_ * eqpsold(cell, pt))));
-
-      if (f > 1E-12) {
-        // return mapping algorithm
-
-        bool    converged = false;
-        ScalarT g         = f;
-        ScalarT H         = 0.0;
-        ScalarT dH        = 0.0;
-        ScalarT alpha     = 0.0;
-        ScalarT res       = 0.0;
-        int     count     = 0;
-        dgam              = 0.0;
-
-        int const num_max_iter = 30;
-
-        LocalNonlinearSolver<EvalT, Traits> solver;
-
-        std::vector<ScalarT> F(1);
-        std::vector<ScalarT> dFdX(1);
-        std::vector<ScalarT> X(1);
-
-        F[0] = f;
-        X[0] = 0.0;
-
-        dFdX[0] = (-2. * mubar) * (1. + H / (3. * mubar));
-        while (!converged && count <= num_max_iter) {
-          count++;
-          solver.solve(dFdX, X, F);
-          alpha   = eqpsold(cell, pt) + sq23 * X[0];
-          H       = K * alpha + sat_mod_ * (1. - exp(-sat_exp_ * alpha));
-          dH      = K + sat_exp_ * sat_mod_ * exp(-sat_exp_ * alpha);
-          F[0]    = smag - (2. * mubar * X[0] + sq23 * (Y + H));
-          dFdX[0] = -2. * mubar * (1. + dH / (3. * mubar));
-
-          res = std::abs(F[0]);
-          if (res < 1.e-11 || res / Y < 1.E-11 || res / f < 1.E-11)
-            converged = true;
-
-          TEUCHOS_TEST_FOR_EXCEPTION(
-              count == num_max_iter,
-              std::runtime_error,
-              std::endl
-                  << "Error in return mapping, count = " << count
-                  << "\nres = " << res << "\nrelres  = " << res / f
-                  << "\nrelres2 = " << res / Y << "\ng = " << F[0] << "\ndg = "
-                  << dFdX[0] << "\nalpha = " << alpha << std::endl);
-        }
-
-        solver.computeFadInfo(dFdX, X, F);
-        dgam = X[0];
-
-        // plastic direction
-        N = (1 / smag) * s;
-
-        // update s
-        s -= 2 * mubar * dgam * N;
-
-        // update eqps
-        eqps(cell, pt) = alpha;
-
-        // mechanical source
-        if (have_temperature_ && delta_time(0) > 0) {
-          source(cell, pt) =
-              (sq23 * dgam / delta_time(0) * (Y + H + temperature_(cell, pt))) /
-              (density_ * heat_capacity_);
-        }
-
-        // exponential map to get Fpnew
-        A     = dgam * N;
-        expA  = minitensor::exp(A);
-        Fpnew = expA * Fpn;
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fpnew(i, j);
-          }
-        }
-      } else {
-        eqps(cell, pt) = eqpsold(cell, pt);
-        if (have_temperature_) source(cell, pt) = 0.0;
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) { Fp(cell, pt, i, j) = Fpn(i, j); }
-        }
-      }
-
-      // update yield surface
-      yieldSurf(cell, pt) =
-          Y + K * eqps(cell, pt) +
-          sat_mod_ * (1. - std::exp(-sat_exp_ * eqps(cell, pt)));
-
-      // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
-
-      // compute stress
-      sigma = p * I + s / J(cell, pt);
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
-        }
-      }
+  kappa = elastic_modulus_(cell, pt) /
+          (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+  mu   = elastic_modulus_(cell, pt) / (2. * (1. + poissons_ratio_(cell, pt)));
+  K    = hardening_modulus_(cell, pt);
+  Y    = yield_strength_(cell, pt);
+  Jm23 = std::pow(J_(cell, pt), -2. / 3.);
+  // fill local tensors
+  F.fill(def_grad_, cell, pt, 0, 0);
+
+  // Mechanical deformation gradient
+  auto Fm = minitensor::Tensor<ScalarT>(F);
+  if (have_temperature_) {
+    // Compute the mechanical deformation gradient Fm based on the
+    // multiplicative decomposition of the deformation gradient
+    //
+    //            F = Fm.Ft => Fm = F.inv(Ft)
+    //
+    // where Ft is the thermal part of F, given as
+    //
+    //     Ft = Le * I = exp(alpha * dtemp) * I
+    //
+    // Le = exp(alpha*dtemp) is the thermal stretch and alpha the
+    // coefficient of thermal expansion.
+    ScalarT dtemp           = temperature_(cell, pt) - ref_temperature_;
+    ScalarT thermal_stretch = std::exp(expansion_coeff_ * dtemp);
+    Fm /= thermal_stretch;
+  }
+
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      Fpn(i, j) = ScalarT(Fp_old_(cell, pt, i, j));
+    }
+  }
+
+  // compute trial state
+  Fpinv = minitensor::inverse(Fpn);
+
+  Cpinv = Fpinv * minitensor::transpose(Fpinv);
+  be    = Jm23 * Fm * Cpinv * minitensor::transpose(Fm);
+  s     = mu * minitensor::dev(be);
+
+  mubar = minitensor::trace(be) * mu / (num_dims_);
+
+  // check yield condition
+  smag = minitensor::norm(s);
+  f    = smag -
+      sq23 * (Y + K * eqps_old_(cell, pt) +
+              sat_mod_ * (1. - std::exp(-sat_exp_ * eqps_old_(cell, pt))));
+
+  if (f > 1E-12) {
+    // return mapping algorithm
+
+    bool    converged = false;
+    ScalarT H         = 0.0;
+    ScalarT dH        = 0.0;
+    ScalarT alpha     = 0.0;
+    ScalarT res       = 0.0;
+    int     count     = 0;
+    dgam              = 0.0;
+
+    int const num_max_iter = 30;
+
+    LocalNonlinearSolver<EvalT, Traits> solver;
+
+    std::vector<ScalarT> F(1);
+    std::vector<ScalarT> dFdX(1);
+    std::vector<ScalarT> X(1);
+
+    F[0] = f;
+    X[0] = 0.0;
+
+    dFdX[0] = (-2. * mubar) * (1. + H / (3. * mubar));
+    while (!converged && count <= num_max_iter) {
+      count++;
+      solver.solve(dFdX, X, F);
+      alpha   = eqps_old_(cell, pt) + sq23 * X[0];
+      H       = K * alpha + sat_mod_ * (1. - exp(-sat_exp_ * alpha));
+      dH      = K + sat_exp_ * sat_mod_ * exp(-sat_exp_ * alpha);
+      F[0]    = smag - (2. * mubar * X[0] + sq23 * (Y + H));
+      dFdX[0] = -2. * mubar * (1. + dH / (3. * mubar));
+
+      res = std::abs(F[0]);
+      if (res < 1.e-11 || res / Y < 1.E-11 || res / f < 1.E-11)
+        converged = true;
+
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          count == num_max_iter,
+          std::runtime_error,
+          std::endl
+              << "Error in return mapping, count = " << count
+              << "\nres = " << res << "\nrelres  = " << res / f
+              << "\nrelres2 = " << res / Y << "\ng = " << F[0]
+              << "\ndg = " << dFdX[0] << "\nalpha = " << alpha << std::endl);
+    }
+
+    solver.computeFadInfo(dFdX, X, F);
+    dgam = X[0];
+
+    // plastic direction
+    N = (1 / smag) * s;
+
+    // update s
+    s -= 2 * mubar * dgam * N;
+
+    // update eqps
+    eqps_(cell, pt) = alpha;
+
+    // mechanical source
+    if (have_temperature_ && delta_time_(0) > 0) {
+      source_(cell, pt) =
+          (sq23 * dgam / delta_time_(0) * (Y + H + temperature_(cell, pt))) /
+          (density_ * heat_capacity_);
+    }
+
+    // exponential map to get Fpnew
+    A     = dgam * N;
+    expA  = minitensor::exp(A);
+    Fpnew = expA * Fpn;
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) { Fp_(cell, pt, i, j) = Fpnew(i, j); }
+    }
+  } else {
+    eqps_(cell, pt) = eqps_old_(cell, pt);
+    if (have_temperature_) source_(cell, pt) = 0.0;
+    for (int i(0); i < num_dims_; ++i) {
+      for (int j(0); j < num_dims_; ++j) { Fp_(cell, pt, i, j) = Fpn(i, j); }
+    }
+  }
+
+  // update yield surface
+  yield_surf_(cell, pt) =
+      Y + K * eqps_(cell, pt) +
+      sat_mod_ * (1. - std::exp(-sat_exp_ * eqps_(cell, pt)));
+
+  // compute pressure
+  p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
+
+  // compute stress
+  sigma = p * I + s / J_(cell, pt);
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      stress_(cell, pt, i, j) = sigma(i, j);
     }
   }
 }
 //------------------------------------------------------------------------------
-// computeState parallel function, which calls Kokkos::parallel_for
-template <typename EvalT, typename Traits>
-void
-J2Model<EvalT, Traits>::computeStateParallel(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
-{
-  return;
-}
-//-------------------------------------------------------------------------------
 }  // namespace LCM
@@ -8,5 +8,18 @@
 
 #include "RIHMRModel.hpp"
 #include "RIHMRModel_Def.hpp"
+#include "ParallelConstitutiveModel_Def.hpp"
 
+template <typename EvalT, typename Traits>
+LCM::RIHMRModel<EvalT, Traits>::RIHMRModel(
+    Teuchos::ParameterList*              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : LCM::ParallelConstitutiveModel<
+          EvalT,
+          Traits,
+          RIHMRKernel<EvalT, Traits>>(p, dl)
+{
+}
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::RIHMRKernel)
 PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::RIHMRModel)
@@ -9,7 +9,7 @@
 
 #include <MiniTensor.h>
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
+#include "ParallelConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
@@ -17,70 +17,78 @@
 
 namespace LCM {
 
-//! \brief Rate Independent Hardening Minus Recovery (RIHMR) Model
 template <typename EvalT, typename Traits>
-class RIHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
+struct RIHMRKernel : public ParallelKernel<EvalT, Traits>
 {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  using ScalarT     = typename EvalT::ScalarT;
-  using MeshScalarT = typename EvalT::MeshScalarT;
-  typedef typename Sacado::mpl::apply<FadType, ScalarT>::type DFadType;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
   ///
   /// Constructor
   ///
-  RIHMRModel(
+  RIHMRKernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
       Teuchos::ParameterList*              p,
-      const Teuchos::RCP<Albany::Layouts>& dl);
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Denstructor
+  /// No copy constructor
   ///
-  virtual ~RIHMRModel(){};
+  RIHMRKernel(RIHMRKernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
-  ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
-
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
-  {
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
-  }
-
- private:
+  /// No copy assignment
   ///
-  /// Private to prohibit copying
-  ///
-  RIHMRModel(const RIHMRModel&);
+  RIHMRKernel&
+  operator=(RIHMRKernel const&) = delete;
 
-  ///
-  /// Private to prohibit copying
-  ///
-  RIHMRModel&
-  operator=(const RIHMRModel&);
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+  using DFadType = typename Sacado::mpl::apply<FadType, ScalarT>::type;
+
+  using BaseKernel::field_name_map_;
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+
+  using BaseKernel::addStateVariable;
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_;
+  ConstScalarField elastic_modulus_;
+  ConstScalarField hardening_modulus_;
+  ConstScalarField J_;
+  ConstScalarField poissons_ratio_;
+  ConstScalarField recovery_modulus_;
+  ConstScalarField yield_strength_;
+
+  // Evaluated MDFields
+  ScalarField eqps_;
+  ScalarField iso_hardening_;
+  ScalarField logFp_;
+  ScalarField stress_;
+
+  // State variables
+  Albany::MDArray eqps_old_;
+  Albany::MDArray iso_hardening_old_;
+  Albany::MDArray logFp_old_;
 
   ///
   /// Saturation hardening constants
   ///
   RealType sat_mod_, sat_exp_;
 
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
+
   ///
   /// Compute Residual and Local Jacobian
   ///
@@ -96,7 +104,20 @@ class RIHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
       ScalarT&              kappa,
       ScalarT&              K,
       ScalarT&              Y,
-      ScalarT&              Rd);
+      ScalarT&              Rd) const;
+};
+
+//! \brief Rate Independent Hardening Minus Recovery (RIHMR) Model
+template <typename EvalT, typename Traits>
+class RIHMRModel : public LCM::ParallelConstitutiveModel<
+                       EvalT,
+                       Traits,
+                       RIHMRKernel<EvalT, Traits>>
+{
+ public:
+  RIHMRModel(
+      Teuchos::ParameterList*              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }  // namespace LCM
 
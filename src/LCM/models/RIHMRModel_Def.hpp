@@ -14,109 +14,90 @@ namespace LCM {
 
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
-RIHMRModel<EvalT, Traits>::RIHMRModel(
+RIHMRKernel<EvalT, Traits>::RIHMRKernel(
+    ConstitutiveModel<EvalT, Traits>&    model,
     Teuchos::ParameterList*              p,
-    const Teuchos::RCP<Albany::Layouts>& dl)
-    : LCM::ConstitutiveModel<EvalT, Traits>(p, dl),
+    Teuchos::RCP<Albany::Layouts> const& dl)
+    : BaseKernel(model),
       sat_mod_(p->get<RealType>("Saturation Modulus", 0.0)),
       sat_exp_(p->get<RealType>("Saturation Exponent", 0.0))
 {
   // define the dependent fields
-  this->dep_field_map_.insert(std::make_pair("F", dl->qp_tensor));
-  this->dep_field_map_.insert(std::make_pair("J", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Poissons Ratio", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Elastic Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(std::make_pair("Yield Strength", dl->qp_scalar));
-  this->dep_field_map_.insert(
-      std::make_pair("Hardening Modulus", dl->qp_scalar));
-  this->dep_field_map_.insert(
-      std::make_pair("Recovery Modulus", dl->qp_scalar));
+  setDependentField("F", dl->qp_tensor);
+  setDependentField("J", dl->qp_scalar);
+  setDependentField("Poissons Ratio", dl->qp_scalar);
+  setDependentField("Elastic Modulus", dl->qp_scalar);
+  setDependentField("Yield Strength", dl->qp_scalar);
+  setDependentField("Hardening Modulus", dl->qp_scalar);
+  setDependentField("Recovery Modulus", dl->qp_scalar);
 
   // retrieve appropriate field name strings
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string logFp_string        = (*field_name_map_)["logFp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string isoHardening_string = (*field_name_map_)["isotropic_hardening"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string logFp_string        = field_name_map_["logFp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string isoHardening_string = field_name_map_["isotropic_hardening"];
 
   // define evaluated fields
-  this->eval_field_map_.insert(std::make_pair(cauchy_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(logFp_string, dl->qp_tensor));
-  this->eval_field_map_.insert(std::make_pair(eqps_string, dl->qp_scalar));
-  this->eval_field_map_.insert(
-      std::make_pair(isoHardening_string, dl->qp_scalar));
+  setEvaluatedField(cauchy_string, dl->qp_tensor);
+  setEvaluatedField(logFp_string, dl->qp_tensor);
+  setEvaluatedField(eqps_string, dl->qp_scalar);
+  setEvaluatedField(isoHardening_string, dl->qp_scalar);
 
   // define the state variables
   //
   // stress
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(cauchy_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(false);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(cauchy_string, dl->qp_tensor, "scalar", 0.0, false, true);
   //
   // logFp
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(logFp_string);
-  this->state_var_layouts_.push_back(dl->qp_tensor);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(false);
+  addStateVariable(logFp_string, dl->qp_tensor, "scalar", 0.0, true, false);
   //
   // eqps
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(eqps_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(eqps_string, dl->qp_scalar, "scalar", 0.0, true, true);
   //
   // isoHardening
-  this->num_state_variables_++;
-  this->state_var_names_.push_back(isoHardening_string);
-  this->state_var_layouts_.push_back(dl->qp_scalar);
-  this->state_var_init_types_.push_back("scalar");
-  this->state_var_init_values_.push_back(0.0);
-  this->state_var_old_state_flags_.push_back(true);
-  this->state_var_output_flags_.push_back(true);
+  addStateVariable(
+      isoHardening_string, dl->qp_scalar, "scalar", 0.0, true, true);
 }
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-RIHMRModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+RIHMRKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<ScalarT const>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto recovery_modulus  = *dep_fields["Recovery Modulus"];
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  recovery_modulus_  = *dep_fields["Recovery Modulus"];
 
   // retrieve appropriate field name strings
-  std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
-  std::string logFp_string        = (*field_name_map_)["logFp"];
-  std::string eqps_string         = (*field_name_map_)["eqps"];
-  std::string isoHardening_string = (*field_name_map_)["isotropic_hardening"];
+  std::string cauchy_string       = field_name_map_["Cauchy_Stress"];
+  std::string logFp_string        = field_name_map_["logFp"];
+  std::string eqps_string         = field_name_map_["eqps"];
+  std::string isoHardening_string = field_name_map_["isotropic_hardening"];
+
   // extract evaluated MDFields
-  auto stress       = *eval_fields[cauchy_string];
-  auto logFp        = *eval_fields[logFp_string];
-  auto eqps         = *eval_fields[eqps_string];
-  auto isoHardening = *eval_fields[isoHardening_string];
+  stress_        = *eval_fields[cauchy_string];
+  logFp_         = *eval_fields[logFp_string];
+  eqps_          = *eval_fields[eqps_string];
+  iso_hardening_ = *eval_fields[isoHardening_string];
 
   // get State Variables
-  Albany::MDArray logFp_old = (*workset.stateArrayPtr)[logFp_string + "_old"];
-  Albany::MDArray eqps_old  = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray isoHardening_old =
+  logFp_old_ = (*workset.stateArrayPtr)[logFp_string + "_old"];
+  eqps_old_  = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  iso_hardening_old_ =
       (*workset.stateArrayPtr)[isoHardening_string + "_old"];
-
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+RIHMRKernel<EvalT, Traits>::operator()(int cell, int pt) const
+{
   // scratch space FCs
   minitensor::Tensor<ScalarT> be(num_dims_);
   minitensor::Tensor<ScalarT> s(num_dims_);
@@ -145,154 +126,136 @@ RIHMRModel<EvalT, Traits>::computeState(
   ScalarT                             normR0(0.0), normR(0.0), conv(0.0);
   LocalNonlinearSolver<EvalT, Traits> solver;
 
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int pt = 0; pt < num_pts_; ++pt) {
-      // logFp_n.fill(&logFp_old(cell, pt, int(0), int(0)) );
-      for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) {
-          logFp_n(i, j) = static_cast<ScalarT>(logFp_old(cell, pt, i, j));
-          // std::cout << "logFp_n(" << cell << ", " << pt << ", " << i << ", "
-          // << j << " ) = " << logFp_n(i, j) << std::endl;
-        }
-      }
+  for (int i(0); i < num_dims_; ++i) {
+    for (int j(0); j < num_dims_; ++j) {
+      logFp_n(i, j) = static_cast<ScalarT>(logFp_old_(cell, pt, i, j));
+    }
+  }
 
-      Fp    = minitensor::exp(logFp_n);
-      Fpold = Fp;
-      Cpinv = minitensor::dot(
-          minitensor::inverse(Fp),
-          minitensor::transpose(minitensor::inverse(Fp)));
-
-      kappa = elastic_modulus(cell, pt) /
-              (3.0 * (1.0 - 2.0 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      K  = hardening_modulus(cell, pt);
-      Y  = yield_strength(cell, pt);
-      Rd = recovery_modulus(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2.0 / 3.0);
-
-      // Compute Trial State
-      be.clear();
-      for (int i = 0; i < num_dims_; ++i)
-        for (int j = 0; j < num_dims_; ++j)
-          for (int p = 0; p < num_dims_; ++p)
-            for (int q = 0; q < num_dims_; ++q)
-              be(i, j) += Jm23 * def_grad(cell, pt, i, p) * Cpinv(p, q) *
-                          def_grad(cell, pt, j, q);
-
-      trd3  = minitensor::trace(be) / 3.;
-      mubar = trd3 * mu;
-      s     = mu * (be - trd3 * I);
-
-      isoH = isoHardening_old(cell, pt);
-
-      // check for yielding
-      smag = minitensor::norm(s);
-      Phi  = smag - sq23 * (Y + isoH);
-
-      if (Phi > 1e-11) {  // plastic yielding
-
-        // return mapping algorithm
-        bool converged = false;
-        int  iter      = 0;
-        dgam           = 0.0;
-
-        // initialize local unknown vector
-        X[0] = dgam;
-        X[1] = isoH;
-
-        while (!converged) {
-          ResidualJacobian(X, R, dRdX, isoH, smag, mubar, mu, kappa, K, Y, Rd);
-
-          normR = R[0] * R[0] + R[1] * R[1];
-          normR = std::sqrt(normR);
-
-          if (iter == 0) normR0 = normR;
-          if (normR0 != 0)
-            conv = normR / normR0;
-          else
-            conv = normR0;
-
-          //              std::cout << iter << " " << normR << " " << conv <<
-          //              std::endl;
-          if (conv < 1.e-11 || normR < 1.e-11) break;
-          if (iter > 20) break;
-
-          //            TEUCHOS_TEST_FOR_EXCEPTION( iter > 20,
-          //            std::runtime_error,
-          //                std::endl << "Error in return mapping, iter = " <<
-          //                iter << "\nres = " << normR << "\nrelres = " << conv
-          //                << std::endl);
-
-          solver.solve(dRdX, X, R);
-          iter++;
-        }
+  Fp    = minitensor::exp(logFp_n);
+  Fpold = Fp;
+  Cpinv = minitensor::dot(
+      minitensor::inverse(Fp), minitensor::transpose(minitensor::inverse(Fp)));
+
+  kappa = elastic_modulus_(cell, pt) /
+          (3.0 * (1.0 - 2.0 * poissons_ratio_(cell, pt)));
+  mu   = elastic_modulus_(cell, pt) / (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+  K    = hardening_modulus_(cell, pt);
+  Y    = yield_strength_(cell, pt);
+  Rd   = recovery_modulus_(cell, pt);
+  Jm23 = std::pow(J_(cell, pt), -2.0 / 3.0);
+
+  // Compute Trial State
+  be.clear();
+  for (int i = 0; i < num_dims_; ++i)
+    for (int j = 0; j < num_dims_; ++j)
+      for (int p = 0; p < num_dims_; ++p)
+        for (int q = 0; q < num_dims_; ++q)
+          be(i, j) += Jm23 * def_grad_(cell, pt, i, p) * Cpinv(p, q) *
+                      def_grad_(cell, pt, j, q);
+
+  trd3  = minitensor::trace(be) / 3.;
+  mubar = trd3 * mu;
+  s     = mu * (be - trd3 * I);
+
+  isoH = iso_hardening_old_(cell, pt);
+
+  // check for yielding
+  smag = minitensor::norm(s);
+  Phi  = smag - sq23 * (Y + isoH);
+
+  if (Phi > 1e-11) {  // plastic yielding
+
+    // return mapping algorithm
+    bool converged = false;
+    int  iter      = 0;
+    dgam           = 0.0;
+
+    // initialize local unknown vector
+    X[0] = dgam;
+    X[1] = isoH;
+
+    while (!converged) {
+      ResidualJacobian(X, R, dRdX, isoH, smag, mubar, mu, kappa, K, Y, Rd);
+
+      normR = R[0] * R[0] + R[1] * R[1];
+      normR = std::sqrt(normR);
+
+      if (iter == 0) normR0 = normR;
+      if (normR0 != 0)
+        conv = normR / normR0;
+      else
+        conv = normR0;
+
+      if (conv < 1.e-11 || normR < 1.e-11) break;
+      if (iter > 20) break;
+
+      solver.solve(dRdX, X, R);
+      iter++;
+    }
 
-        // compute sensitivity information w.r.t system parameters, and pack
-        // back to X
-        solver.computeFadInfo(dRdX, X, R);
+    // compute sensitivity information w.r.t system parameters, and pack
+    // back to X
+    solver.computeFadInfo(dRdX, X, R);
 
-        // update
-        dgam = X[0];
-        isoH = X[1];
+    // update
+    dgam = X[0];
+    isoH = X[1];
 
-        // plastic direction
-        n = ScalarT(1. / smag) * s;
+    // plastic direction
+    n = ScalarT(1. / smag) * s;
 
-        // updated deviatoric stress
-        s -= ScalarT(2. * mubar * dgam) * n;
+    // updated deviatoric stress
+    s -= ScalarT(2. * mubar * dgam) * n;
 
-        // update isoHardening
-        isoHardening(cell, pt) = isoH;
+    // update isoHardening
+    iso_hardening_(cell, pt) = isoH;
 
-        // update eqps
-        eqps(cell, pt) = eqps_old(cell, pt) + sq23 * dgam;
+    // update eqps
+    eqps_(cell, pt) = eqps_old_(cell, pt) + sq23 * dgam;
 
-        // exponential map to get Fp
-        A    = dgam * n;
-        expA = minitensor::exp<ScalarT>(A);
+    // exponential map to get Fp
+    A    = dgam * n;
+    expA = minitensor::exp<ScalarT>(A);
 
-        for (int i = 0; i < num_dims_; ++i) {
-          for (int j = 0; j < num_dims_; ++j) {
-            Fp(i, j) = 0.0;
-            for (int p = 0; p < num_dims_; ++p) {
-              Fp(i, j) += expA(i, p) * Fpold(p, j);
-            }
-          }
+    for (int i = 0; i < num_dims_; ++i) {
+      for (int j = 0; j < num_dims_; ++j) {
+        Fp(i, j) = 0.0;
+        for (int p = 0; p < num_dims_; ++p) {
+          Fp(i, j) += expA(i, p) * Fpold(p, j);
         }
+      }
+    }
 
-      } else {
-        // set state variables to old values
-        isoHardening(cell, pt) = isoHardening_old(cell, pt);
+  } else {
+    // set state variables to old values
+    iso_hardening_(cell, pt) = iso_hardening_old_(cell, pt);
 
-        eqps(cell, pt) = eqps_old(cell, pt);
-        Fp             = Fpold;
-      }
+    eqps_(cell, pt) = eqps_old_(cell, pt);
+    Fp              = Fpold;
+  }
 
-      // store logFp as the state variable
-      logFp_n = minitensor::log(Fp);
-      for (int i = 0; i < num_dims_; ++i)
-        for (int j = 0; j < num_dims_; ++j)
-          logFp(cell, pt, i, j) = logFp_n(i, j);
+  // store logFp as the state variable
+  logFp_n = minitensor::log(Fp);
+  for (int i = 0; i < num_dims_; ++i)
+    for (int j = 0; j < num_dims_; ++j) logFp_(cell, pt, i, j) = logFp_n(i, j);
 
-      // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1 / (J(cell, pt)));
+  // compute pressure
+  p = 0.5 * kappa * (J_(cell, pt) - 1 / (J_(cell, pt)));
 
-      // compute stress
-      for (int i = 0; i < num_dims_; ++i) {
-        for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = s(i, j) / J(cell, pt);
-        }
-        stress(cell, pt, i, i) += p;
-      }
+  // compute stress
+  for (int i = 0; i < num_dims_; ++i) {
+    for (int j = 0; j < num_dims_; ++j) {
+      stress_(cell, pt, i, j) = s(i, j) / J_(cell, pt);
     }
+    stress_(cell, pt, i, i) += p;
   }
-
-}  // end of compute state
+}
 //----------------------------------------------------------------------------
 // all local functions for compute state
 template <typename EvalT, typename Traits>
 void
-RIHMRModel<EvalT, Traits>::ResidualJacobian(
+RIHMRKernel<EvalT, Traits>::ResidualJacobian(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& R,
     std::vector<ScalarT>& dRdX,
@@ -303,7 +266,7 @@ RIHMRModel<EvalT, Traits>::ResidualJacobian(
     ScalarT&              kappa,
     ScalarT&              K,
     ScalarT&              Y,
-    ScalarT&              Rd)
+    ScalarT&              Rd) const
 {
   ScalarT               sq23 = std::sqrt(2.0 / 3.0);
   std::vector<DFadType> Rfad(2);
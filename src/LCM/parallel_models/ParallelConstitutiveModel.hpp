@@ -31,6 +31,23 @@ struct ParallelKernel
   using ScalarField      = PHX::MDField<ScalarT>;
   using ConstScalarField = PHX::MDField<const ScalarT>;
 
+  ///
+  /// The optional fields are set on the model by the interface after
+  /// the kernel has been constructed. Refresh the copies held here.
+  ///
+  void
+  updateOptionalFields()
+  {
+    coord_vec_              = model_.coord_vec_;
+    temperature_            = model_.temperature_;
+    total_concentration_    = model_.total_concentration_;
+    total_bubble_density_   = model_.total_bubble_density_;
+    bubble_volume_fraction_ = model_.bubble_volume_fraction_;
+    damage_                 = model_.damage_;
+    weights_                = model_.weights_;
+    j_                      = model_.j_;
+  }
+
  protected:
   ParallelKernel(ConstitutiveModel<EvalT, Traits>& model)
       : model_(model),
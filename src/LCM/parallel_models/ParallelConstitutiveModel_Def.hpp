@@ -41,6 +41,7 @@ ParallelConstitutiveModel<EvalT, Traits, Kernel>::computeState(
   Teuchos::RCP<Teuchos::Time> transfer_time =
       tmonitor["Constitutive Model: Transfer Time"];
 
+  kernel_->updateOptionalFields();
   kernel_->init(workset, dep_fields, eval_fields);
 
   // Data may be set using CUDA UVM so we need to synchronize
@@ -5,6 +5,11 @@
 //*****************************************************************//
 
 #include "Schwarz_Alternating.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Albany_CommUtils.hpp"
 #include "Albany_ModelEvaluator.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_SolverFactory.hpp"
@@ -12,6 +17,18 @@
 #include "MiniTensor.h"
 #include "Piro_LOCASolver.hpp"
 #include "Piro_TempusSolver.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_Time.hpp"
+
+#if defined(ALBANY_MPI)
+#include <mpi.h>
+#include "Teuchos_DefaultMpiComm.hpp"
+#endif
+
+#if defined(ALBANY_SEACAS)
+#include <Ionit_Initializer.h>
+#include <Ioss_SubSystem.h>
+#endif
 
 namespace LCM {
 
@@ -89,6 +106,23 @@ SchwarzAlternating::SchwarzAlternating(
     ALBANY_ASSERT(false, "Unknown Convergence Logical Operator");
   }
 
+  std::string mode_str =
+      alt_system_params.get<std::string>("Schwarz Mode", "MULTIPLICATIVE");
+
+  std::transform(
+      mode_str.begin(), mode_str.end(), mode_str.begin(), ::toupper);
+
+  if (mode_str == "MULTIPLICATIVE") {
+    mode_ = SchwarzMode::MULTIPLICATIVE;
+  } else if (mode_str == "ADDITIVE") {
+    mode_ = SchwarzMode::ADDITIVE;
+  } else {
+    ALBANY_ASSERT(false, "Unknown Schwarz Mode");
+  }
+
+  // Optional Aitken or Anderson relaxation of the Schwarz iteration
+  relaxation_.setParameters(alt_system_params);
+
   // Firewalls
   ALBANY_ASSERT(min_iters_ >= 1, "");
   ALBANY_ASSERT(max_iters_ >= 1, "");
@@ -132,7 +166,6 @@ SchwarzAlternating::SchwarzAlternating(
   sub_outargs_.resize(num_subdomains_);
   curr_disp_.resize(num_subdomains_);
   prev_step_disp_.resize(num_subdomains_);
-  internal_states_.resize(num_subdomains_);
   // the following 9 arrays are for dynamics
   ics_disp_.resize(num_subdomains_);
   ics_velo_.resize(num_subdomains_);
@@ -150,10 +183,22 @@ SchwarzAlternating::SchwarzAlternating(
 
   bool is_dynamic{false};
 
+  comm_           = comm;
+  subdomain_comm_ = comm;
+
+  if (mode_ == SchwarzMode::ADDITIVE) {
+    splitCommunicator(alt_system_params, model_filenames, comm);
+  } else {
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      local_subdomains_.push_back(subdomain);
+    }
+  }
+
   // Initialization
-  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+  for (auto subdomain : local_subdomains_) {
     // Get parameters for each subdomain
-    Albany::SolverFactory solver_factory(model_filenames[subdomain], comm);
+    Albany::SolverFactory solver_factory(
+        model_filenames[subdomain], subdomain_comm_);
 
     solver_factory.setSchwarz(true);
 
@@ -178,7 +223,7 @@ SchwarzAlternating::SchwarzAlternating(
     std::string const msg{
         "All subdomains must have the same solution method (NOX or Tempus)"};
 
-    if (subdomain == 0) {
+    if (subdomain == local_subdomains_.front()) {
       is_dynamic  = piro_params.isSublist("Tempus");
       is_static   = !is_dynamic;
       is_static_  = is_static;
@@ -215,7 +260,8 @@ SchwarzAlternating::SchwarzAlternating(
     Teuchos::RCP<Albany::Application> app{Teuchos::null};
 
     Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solver =
-        solver_factory.createAndGetAlbanyApp(app, comm, comm);
+        solver_factory.createAndGetAlbanyApp(
+            app, subdomain_comm_, subdomain_comm_);
 
     solvers_[subdomain] = solver;
 
@@ -245,6 +291,11 @@ SchwarzAlternating::SchwarzAlternating(
     curr_disp_[subdomain] = Teuchos::null;
   }
 
+  // The Schwarz BCs are known once all applications are built.
+  if (mode_ == SchwarzMode::ADDITIVE) {
+    transfer_.setup(apps_, local_subdomains_, comm_);
+  }
+
   //
   // Parameters
   //
@@ -269,6 +320,241 @@ SchwarzAlternating::SchwarzAlternating(
 //
 SchwarzAlternating::~SchwarzAlternating() { return; }
 
+namespace {
+
+#if defined(ALBANY_MPI)
+//
+// Number of elements of a subdomain, from its input file and without
+// building its mesh. 1 if it cannot be determined.
+//
+ST
+subdomainSize(
+    std::string const&                            model_filename,
+    Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  Albany::SolverFactory solver_factory(model_filename, comm);
+
+  Teuchos::ParameterList& disc_params =
+      solver_factory.getParameters().sublist("Discretization");
+
+  std::string const method = disc_params.get<std::string>("Method", "");
+
+  if (method == "STK1D" || method == "STK2D" || method == "STK3D") {
+    std::string const names[] = {"1D Elements", "2D Elements", "3D Elements"};
+
+    int const dimension = method[3] - '0';
+
+    ST size{1.0};
+
+    for (auto i = 0; i < dimension; ++i) {
+      size *= disc_params.get<int>(names[i], 1);
+    }
+    return size;
+  }
+
+  ST size{1.0};
+
+#if defined(ALBANY_SEACAS)
+  if (method == "Ioss" || method == "Exodus") {
+    std::string const mesh_filename =
+        disc_params.get<std::string>("Exodus Input File Name", "");
+
+    if (comm->getRank() == 0) {
+      Ioss::Init::Initializer io;
+
+      Ioss::DatabaseIO* const db = Ioss::IOFactory::create(
+          "exodus", mesh_filename, Ioss::READ_MODEL, MPI_COMM_SELF);
+
+      if (db != nullptr && db->ok() == true) {
+        Ioss::Region region(db);
+        size = region.get_property("element_count").get_int();
+      } else {
+        delete db;
+      }
+    }
+    Teuchos::broadcast(*comm, 0, Teuchos::ptrFromRef(size));
+  }
+#endif  // ALBANY_SEACAS
+
+  return size;
+}
+
+//
+// Number of ranks of each subdomain: one each, and the rest in proportion
+// to their sizes, rounded by largest remainders.
+//
+std::vector<int>
+distributeRanks(std::vector<ST> const& sizes, int const num_ranks)
+{
+  int const num_subdomains = sizes.size();
+
+  int const num_extra = num_ranks - num_subdomains;
+
+  ST total{0.0};
+
+  for (auto size : sizes) { total += size; }
+
+  std::vector<int> counts(num_subdomains, 1);
+
+  std::vector<std::pair<ST, int>> remainders;
+
+  int assigned{0};
+
+  for (auto subdomain = 0; subdomain < num_subdomains; ++subdomain) {
+    ST const  share = num_extra * sizes[subdomain] / total;
+    int const whole = static_cast<int>(std::floor(share));
+
+    counts[subdomain] += whole;
+    assigned += whole;
+    remainders.push_back(std::make_pair(-(share - whole), subdomain));
+  }
+
+  std::sort(remainders.begin(), remainders.end());
+
+  for (auto i = 0; i < num_extra - assigned; ++i) {
+    ++counts[remainders[i].second];
+  }
+
+  return counts;
+}
+#endif  // ALBANY_MPI
+
+//
+// In additive mode each rank only knows the norms of its own subdomains.
+// They are already reduced within its group, so only the first rank of
+// each group contributes.
+//
+void
+sumOverSubdomains(
+    Teuchos::Comm<int> const& comm,
+    bool const                contributes,
+    minitensor::Vector<ST>&   norms)
+{
+  int const num_subdomains = norms.get_dimension();
+
+  std::vector<ST> local(num_subdomains, 0.0);
+  std::vector<ST> global(num_subdomains, 0.0);
+
+  if (contributes == true) {
+    for (auto i = 0; i < num_subdomains; ++i) { local[i] = norms(i); }
+  }
+
+  Teuchos::reduceAll(
+      comm, Teuchos::REDUCE_SUM, num_subdomains, local.data(), global.data());
+
+  for (auto i = 0; i < num_subdomains; ++i) { norms(i) = global[i]; }
+}
+
+bool
+anyFailed(Teuchos::Comm<int> const& comm, bool const failed)
+{
+  int const local{failed == true ? 1 : 0};
+  int       global{0};
+
+  Teuchos::reduceAll(
+      comm, Teuchos::REDUCE_MAX, local, Teuchos::ptrFromRef(global));
+
+  return global == 1;
+}
+
+}  // anonymous namespace
+
+//
+// Additive Schwarz solves all subdomains at the same time. Split the ranks
+// into one group per subdomain, with a number of ranks proportional to the
+// subdomain size, taken from "Subdomain Weights" if given or else from the
+// number of elements. The ranks of a group are contiguous.
+//
+// With fewer ranks than subdomains, or a single rank, all ranks hold all
+// subdomains and solve them one after another. Their Schwarz BCs still
+// come from the start of the sweep, so the iterates are the same.
+//
+void
+SchwarzAlternating::splitCommunicator(
+    Teuchos::ParameterList&                       alt_system_params,
+    Teuchos::Array<std::string> const&            model_filenames,
+    Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  int const num_ranks = comm->getSize();
+
+  int const rank = comm->getRank();
+
+  auto& fos = *Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  if (num_ranks == 1 || num_ranks < num_subdomains_) {
+    fos << "Additive Schwarz: all subdomains on all " << num_ranks
+        << " rank(s)\n";
+
+    local_subdomains_.clear();
+
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      local_subdomains_.push_back(subdomain);
+    }
+
+    relaxation_.setCommunicator(comm, rank == 0);
+    return;
+  }
+
+#if defined(ALBANY_MPI)
+  std::vector<ST> sizes(num_subdomains_, 1.0);
+
+  if (alt_system_params.isParameter("Subdomain Weights") == true) {
+    auto const& weights =
+        alt_system_params.get<Teuchos::Array<ST>>("Subdomain Weights");
+
+    ALBANY_ASSERT(
+        weights.size() == num_subdomains_,
+        "One Subdomain Weight per subdomain is needed.");
+
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      sizes[subdomain] = weights[subdomain];
+    }
+  } else {
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      sizes[subdomain] = subdomainSize(model_filenames[subdomain], comm);
+    }
+  }
+
+  for (auto size : sizes) {
+    ALBANY_ASSERT(size > 0.0, "Subdomain Weights must be positive.");
+  }
+
+  std::vector<int> const counts = distributeRanks(sizes, num_ranks);
+
+  int local_subdomain{-1};
+
+  int first_rank{0};
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    if (first_rank <= rank && rank < first_rank + counts[subdomain]) {
+      local_subdomain = subdomain;
+    }
+    first_rank += counts[subdomain];
+  }
+
+  ALBANY_ASSERT(local_subdomain >= 0, "");
+
+  fos << "Additive Schwarz ranks per subdomain:";
+  for (auto count : counts) { fos << ' ' << count; }
+  fos << '\n';
+
+  Teuchos::RCP<Teuchos_Comm const> teuchos_comm = comm;
+
+  MPI_Comm const mpi_comm = Albany::getMpiCommFromTeuchosComm(teuchos_comm);
+
+  MPI_Comm split_comm;
+
+  MPI_Comm_split(mpi_comm, local_subdomain, rank, &split_comm);
+
+  subdomain_comm_ = Teuchos::rcp(new Teuchos::MpiComm<int>(
+      Teuchos::opaqueWrapper(split_comm, MPI_Comm_free)));
+
+  local_subdomains_.assign(1, local_subdomain);
+
+  relaxation_.setCommunicator(comm, subdomain_comm_->getRank() == 0);
+#endif  // ALBANY_MPI
+}
+
 //
 //
 //
@@ -592,6 +878,8 @@ SchwarzAlternating::reportFinals(std::ostream& os) const
 
   os << '\n';
   os << "Schwarz Alternating Method converged: " << conv_str << '\n';
+  os << "Schwarz mode       :";
+  os << (mode_ == SchwarzMode::ADDITIVE ? "Additive" : "Multiplicative") << '\n';
   os << "Minimum iterations :" << min_iters_ << '\n';
   os << "Maximum iterations :" << max_iters_ << '\n';
   os << "Total iterations   :" << num_iter_ << '\n';
@@ -599,9 +887,114 @@ SchwarzAlternating::reportFinals(std::ostream& os) const
   os << "Absolute tolerance :" << abs_tol_ << '\n';
   os << "Last relative error:" << rel_error_ << '\n';
   os << "Relative tolerance :" << rel_tol_ << '\n';
+  relaxation_.report(os);
+  os << "Step wall time     :" << step_wall_time_ << '\n';
+  os << "Accumulated iters  :" << total_iters_ << '\n';
+  os << "Accumulated time   :" << total_wall_time_ << '\n';
   os << std::endl;
 }
 
+//
+// Relax the subdomain solutions after a quasistatic Schwarz sweep and
+// make the relaxed values visible to the Schwarz BCs of the next sweep.
+//
+void
+SchwarzAlternating::relaxQuasistatics(
+    std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> const& sweep_disp,
+    ST const                                                      time) const
+{
+  if (relaxation_.isActive() == false) return;
+
+  std::vector<std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>>> x(1);
+  std::vector<std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>>       g(1);
+
+  for (auto subdomain : local_subdomains_) {
+    x[0].push_back(sweep_disp[subdomain]);
+    g[0].push_back(curr_disp_[subdomain]->clone_v());
+  }
+
+  relaxation_.apply(x, g);
+
+  for (auto i = 0; i < local_subdomains_.size(); ++i) {
+    auto const subdomain  = local_subdomains_[i];
+    curr_disp_[subdomain] = g[0][i];
+    exposeSolution(subdomain, curr_disp_[subdomain], time);
+  }
+}
+
+//
+// Same for dynamics. Displacement, velocity and acceleration are relaxed
+// with the same coefficients so that they remain consistent.
+//
+void
+SchwarzAlternating::relaxDynamics(ST const time) const
+{
+  if (relaxation_.isActive() == false) return;
+
+  std::vector<std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>>> x(3);
+  std::vector<std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>>       g(3);
+
+  for (auto subdomain : local_subdomains_) {
+    x[0].push_back(prev_disp_[subdomain]);
+    x[1].push_back(prev_velo_[subdomain]);
+    x[2].push_back(prev_acce_[subdomain]);
+    g[0].push_back(this_disp_[subdomain]);
+    g[1].push_back(this_velo_[subdomain]);
+    g[2].push_back(this_acce_[subdomain]);
+  }
+
+  relaxation_.apply(x, g);
+
+  for (auto subdomain : local_subdomains_) {
+    exposeSolution(
+        subdomain,
+        this_disp_[subdomain],
+        this_velo_[subdomain],
+        this_acce_[subdomain],
+        time);
+  }
+}
+
+//
+// Make a solution the one seen by the Schwarz BCs of the other subdomains
+// and by the output.
+//
+void
+SchwarzAlternating::exposeSolution(
+    int const                                        subdomain,
+    Teuchos::RCP<Thyra::VectorBase<ST> const> const& disp,
+    ST const                                         time) const
+{
+  auto& app = *apps_[subdomain];
+
+  app.setX(disp);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> const& app_disc =
+      app.getDiscretization();
+
+  app_disc->writeSolutionToMeshDatabase(*disp, time);
+}
+
+void
+SchwarzAlternating::exposeSolution(
+    int const                                        subdomain,
+    Teuchos::RCP<Thyra::VectorBase<ST> const> const& disp,
+    Teuchos::RCP<Thyra::VectorBase<ST> const> const& velo,
+    Teuchos::RCP<Thyra::VectorBase<ST> const> const& acce,
+    ST const                                         time) const
+{
+  auto& app = *apps_[subdomain];
+
+  app.setX(disp);
+  app.setXdot(velo);
+  app.setXdotdot(acce);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> const& app_disc =
+      app.getDiscretization();
+
+  app_disc->writeSolutionToMeshDatabase(*disp, *velo, *acce, time);
+}
+
 //
 // Schwarz Alternating loop, dynamic
 //
@@ -635,21 +1028,46 @@ SchwarzAlternating::SchwarzLoopDynamics() const
     fos << "Time step          :" << time_step << '\n';
     fos << delim << std::endl;
 
-    // Before the Schwarz loop, get internal states
-    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    // Before the Schwarz loop, take a snapshot of the internal states
+    for (auto subdomain : local_subdomains_) {
       auto& app       = *apps_[subdomain];
       auto& state_mgr = app.getStateMgr();
-      fromTo(state_mgr.getStateArrays(), internal_states_[subdomain]);
+      state_mgr.snapshotStates();
     }
 
     ST const next_time{current_time + time_step};
     num_iter_ = 0;
+    relaxation_.reset();
+
+    Teuchos::Time step_timer("Schwarz Step", true);
 
     // Schwarz loop
     do {
       bool const is_initial_state = stop == 0 && num_iter_ == 0;
 
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      // In additive mode all subdomains of a sweep get their Schwarz BCs
+      // from the solutions at the start of the sweep.
+      if (mode_ == SchwarzMode::ADDITIVE) {
+        std::vector<SchwarzTransfer::Fields> fields(num_subdomains_);
+
+        for (auto subdomain : local_subdomains_) {
+          if (is_initial_state == true) {
+            auto& me = dynamic_cast<Albany::ModelEvaluator&>(
+                *model_evaluators_[subdomain]);
+            auto const& nv    = me.getNominalValues();
+            fields[subdomain] = {
+                nv.get_x(), nv.get_x_dot(), nv.get_x_dot_dot()};
+          } else {
+            fields[subdomain] = {this_disp_[subdomain],
+                                 this_velo_[subdomain],
+                                 this_acce_[subdomain]};
+          }
+        }
+
+        transfer_.exchange(fields);
+      }
+
+      for (auto subdomain : local_subdomains_) {
         fos << delim << std::endl;
         fos << "Schwarz iteration  :" << num_iter_ << '\n';
         fos << "Subdomain          :" << subdomain << '\n';
@@ -667,11 +1085,8 @@ SchwarzAlternating::SchwarzLoopDynamics() const
           prev_acce_[subdomain] = Thyra::createMember(me.get_x_space());
           Thyra::copy(*(nv.get_x_dot_dot()), prev_acce_[subdomain].ptr());
         } else {
-          Thyra::put_scalar(0.0, prev_disp_[subdomain].ptr());
           Thyra::copy(*this_disp_[subdomain], prev_disp_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_velo_[subdomain].ptr());
           Thyra::copy(*this_velo_[subdomain], prev_velo_[subdomain].ptr());
-          Thyra::put_scalar(0.0, prev_acce_[subdomain].ptr());
           Thyra::copy(*this_acce_[subdomain], prev_acce_[subdomain].ptr());
         }
 
@@ -702,7 +1117,7 @@ SchwarzAlternating::SchwarzLoopDynamics() const
         auto& app       = *apps_[subdomain];
         auto& state_mgr = app.getStateMgr();
 
-        fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
+        state_mgr.rollbackStates();
 
         Teuchos::RCP<Tempus::SolutionHistory<ST>> solution_history;
         Teuchos::RCP<Tempus::SolutionState<ST>>   current_state;
@@ -762,7 +1177,6 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
         Teuchos::RCP<Thyra_Vector> disp_diff_rcp =
             Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, disp_diff_rcp.ptr());
         Thyra::V_VpStV(
             disp_diff_rcp.ptr(),
             *this_disp_[subdomain],
@@ -771,7 +1185,6 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
         Teuchos::RCP<Thyra_Vector> velo_diff_rcp =
             Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, velo_diff_rcp.ptr());
         Thyra::V_VpStV(
             velo_diff_rcp.ptr(),
             *this_velo_[subdomain],
@@ -780,7 +1193,6 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
         Teuchos::RCP<Thyra_Vector> acce_diff_rcp =
             Thyra::createMember(me.get_x_space());
-        Thyra::put_scalar<ST>(0.0, acce_diff_rcp.ptr());
         Thyra::V_VpStV(
             acce_diff_rcp.ptr(),
             *this_acce_[subdomain],
@@ -806,6 +1218,15 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
       }  // Subdomains loop
 
+      if (mode_ == SchwarzMode::ADDITIVE) {
+        bool const is_group_root = subdomain_comm_->getRank() == 0;
+
+        failed_ = anyFailed(*comm_, failed_);
+        sumOverSubdomains(*comm_, is_group_root, norms_init);
+        sumOverSubdomains(*comm_, is_group_root, norms_final);
+        sumOverSubdomains(*comm_, is_group_root, norms_diff);
+      }
+
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
         fos << "\n";
@@ -859,8 +1280,14 @@ SchwarzAlternating::SchwarzLoopDynamics() const
       fos << "Relative tolerance :" << rel_tol_ << '\n';
       fos << delim << std::endl;
 
+      if (converged_ == false) relaxDynamics(next_time);
+
     } while (continueSolve() == true);
 
+    step_wall_time_ = step_timer.stop();
+    total_wall_time_ += step_wall_time_;
+    total_iters_ += num_iter_;
+
     // One of the subdomains failed to solve. Reduce step.
     if (failed_ == true) {
       failed_ = false;
@@ -885,19 +1312,16 @@ SchwarzAlternating::SchwarzLoopDynamics() const
       }
 
       // Restore previous solutions
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
-        Thyra::put_scalar(0.0, this_disp_[subdomain].ptr());
+      for (auto subdomain : local_subdomains_) {
         Thyra::copy(*ics_disp_[subdomain], this_disp_[subdomain].ptr());
-        Thyra::put_scalar(0.0, this_velo_[subdomain].ptr());
         Thyra::copy(*ics_velo_[subdomain], this_velo_[subdomain].ptr());
-        Thyra::put_scalar(0.0, this_acce_[subdomain].ptr());
         Thyra::copy(*ics_acce_[subdomain], this_acce_[subdomain].ptr());
 
         // restore the state manager with the state variables from the previous
         // loadstep.
         auto& app       = *apps_[subdomain];
         auto& state_mgr = app.getStateMgr();
-        fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
+        state_mgr.rollbackStates();
 
         // restore the solution in the discretization so the schwarz solver gets
         // the right boundary conditions!
@@ -919,9 +1343,14 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
     reportFinals(fos);
 
+    // The step is accepted, its internal states are the new history.
+    for (auto subdomain : local_subdomains_) {
+      apps_[subdomain]->getStateMgr().commitStates();
+    }
+
     // Update IC vecs and output solution to exodus file
 
-    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    for (auto subdomain : local_subdomains_) {
       if (do_outputs_init_[subdomain] == true) {
         do_outputs_[subdomain] =
             output_interval_ > 0 ? (stop + 1) % output_interval_ == 0 : false;
@@ -957,7 +1386,7 @@ SchwarzAlternating::setExplicitUpdateInitialGuessForSchwarz(
 {
   // do an explicit update to form the initial guess for the schwarz
   // iteration
-  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+  for (auto subdomain : local_subdomains_) {
     auto& app = *apps_[subdomain];
 
     Thyra_Vector& ic_disp = *ics_disp_[subdomain];
@@ -1005,7 +1434,7 @@ SchwarzAlternating::setDynamicICVecsAndDoOutput(ST const time) const
 
   if (time == initial_time_) is_initial_time = true;
 
-  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+  for (auto subdomain : local_subdomains_) {
     Albany::AbstractSTKMeshStruct& stk_mesh_struct =
         *stk_mesh_structs_[subdomain];
 
@@ -1070,7 +1499,7 @@ SchwarzAlternating::setDynamicICVecsAndDoOutput(ST const time) const
 void
 SchwarzAlternating::doQuasistaticOutput(ST const time) const
 {
-  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+  for (auto subdomain : local_subdomains_) {
     if (do_outputs_[subdomain] == true) {
       auto& stk_mesh_struct = *stk_mesh_structs_[subdomain];
 
@@ -1138,7 +1567,7 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
     // Before the Schwarz loop, save the solutions for each subdomain in case
     // the solve fails. Then the load step is reduced and the Schwarz
     // loop is restarted from scratch.
-    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    for (auto subdomain : local_subdomains_) {
       // Set these initial values explicitly to zero so that no
       // extra logic is necessary for initial values in the
       // Schwarz and subdomain loops.
@@ -1159,15 +1588,33 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
       auto& app       = *apps_[subdomain];
       auto& state_mgr = app.getStateMgr();
-      fromTo(state_mgr.getStateArrays(), internal_states_[subdomain]);
+      state_mgr.snapshotStates();
     }
 
     num_iter_ = 0;
+    relaxation_.reset();
+
+    Teuchos::Time step_timer("Schwarz Step", true);
 
     // Schwarz loop
     do {
+      // Solutions at the start of the sweep, needed for relaxation.
+      auto const sweep_disp = curr_disp_;
+
+      // In additive mode all subdomains of a sweep get their Schwarz BCs
+      // from the solutions at the start of the sweep.
+      if (mode_ == SchwarzMode::ADDITIVE) {
+        std::vector<SchwarzTransfer::Fields> fields(num_subdomains_);
+
+        for (auto subdomain : local_subdomains_) {
+          fields[subdomain] = {curr_disp_[subdomain]};
+        }
+
+        transfer_.exchange(fields);
+      }
+
       // Subdomain loop
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      for (auto subdomain : local_subdomains_) {
         fos << delim << std::endl;
         fos << "Schwarz iteration  :" << num_iter_ << '\n';
         fos << "Subdomain          :" << subdomain << '\n';
@@ -1186,7 +1633,7 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
         // Restore internal states
         auto& app       = *apps_[subdomain];
         auto& state_mgr = app.getStateMgr();
-        fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
+        state_mgr.rollbackStates();
 
         // Restore solution from previous time step
         auto prev_step_disp_rcp = prev_step_disp_[subdomain];
@@ -1226,7 +1673,6 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
         auto disp_diff_rcp = Thyra::createMember(me.get_x_space());
         auto disp_diff_ptr = disp_diff_rcp.ptr();
 
-        Thyra::put_scalar<ST>(0.0, disp_diff_ptr);
         Thyra::V_VpStV(disp_diff_ptr, curr_disp, -1.0, prev_disp);
 
         auto& disp_diff = *disp_diff_rcp;
@@ -1239,6 +1685,15 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
       }  // Subdomain loop
 
+      if (mode_ == SchwarzMode::ADDITIVE) {
+        bool const is_group_root = subdomain_comm_->getRank() == 0;
+
+        failed_ = anyFailed(*comm_, failed_);
+        sumOverSubdomains(*comm_, is_group_root, norms_init);
+        sumOverSubdomains(*comm_, is_group_root, norms_final);
+        sumOverSubdomains(*comm_, is_group_root, norms_diff);
+      }
+
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
         fos << "\n";
@@ -1292,8 +1747,14 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
       fos << "Relative tolerance :" << rel_tol_ << '\n';
       fos << delim << std::endl;
 
+      if (converged_ == false) relaxQuasistatics(sweep_disp, next_time);
+
     } while (continueSolve() == true);  // Schwarz loop
 
+    step_wall_time_ = step_timer.stop();
+    total_wall_time_ += step_wall_time_;
+    total_iters_ += num_iter_;
+
     // One or more of the subdomains failed to solve. Reduce step.
     if (failed_ == true) {
       failed_ = false;
@@ -1318,7 +1779,7 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
       }
 
       // Restore previous solutions
-      for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      for (auto subdomain : local_subdomains_) {
         curr_disp_[subdomain] = prev_step_disp_[subdomain];
 
         // Restore the state manager with the state variables from the previous
@@ -1327,7 +1788,7 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
         auto& state_mgr = app.getStateMgr();
 
-        fromTo(internal_states_[subdomain], state_mgr.getStateArrays());
+        state_mgr.rollbackStates();
 
         // Restore the solution in the discretization so the schwarz solver gets
         // the right boundary conditions!
@@ -1345,9 +1806,14 @@ SchwarzAlternating::SchwarzLoopQuasistatics() const
 
     reportFinals(fos);
 
+    // The step is accepted, its internal states are the new history.
+    for (auto subdomain : local_subdomains_) {
+      apps_[subdomain]->getStateMgr().commitStates();
+    }
+
     // Output converged solution if at specified interval
 
-    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    for (auto subdomain : local_subdomains_) {
       if (do_outputs_init_[subdomain] == true) {
         do_outputs_[subdomain] =
             output_interval_ > 0 ? (stop + 1) % output_interval_ == 0 : false;
@@ -15,7 +15,8 @@
 #include "Albany_Application.hpp"
 #include "Albany_MaterialDatabase.hpp"
 #include "Piro_NOXSolver.hpp"
-#include "StateVarUtils.hpp"
+#include "Schwarz_Relaxation.hpp"
+#include "Schwarz_Transfer.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
 #include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
@@ -105,6 +106,11 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
     AND,
     OR
   };
+  enum class SchwarzMode
+  {
+    MULTIPLICATIVE,
+    ADDITIVE
+  };
 
  private:
   /// Create operator form of dg/dx for distributed responses
@@ -128,6 +134,13 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   Thyra::ModelEvaluatorBase::InArgs<ST>
   createInArgsImpl() const;
 
+  /// In additive mode, give each subdomain its own group of ranks
+  void
+  splitCommunicator(
+      Teuchos::ParameterList&                       alt_system_params,
+      Teuchos::Array<std::string> const&            model_filenames,
+      Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
   /// Schwarz Alternating loops
   void
   SchwarzLoopQuasistatics() const;
@@ -155,11 +168,40 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   void
   reportFinals(std::ostream& os) const;
 
+  void
+  relaxQuasistatics(
+      std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> const& sweep_disp,
+      ST const                                                      time) const;
+
+  void
+  relaxDynamics(ST const time) const;
+
+  void
+  exposeSolution(
+      int const                                        subdomain,
+      Teuchos::RCP<Thyra::VectorBase<ST> const> const& disp,
+      ST const                                         time) const;
+
+  void
+  exposeSolution(
+      int const                                        subdomain,
+      Teuchos::RCP<Thyra::VectorBase<ST> const> const& disp,
+      Teuchos::RCP<Thyra::VectorBase<ST> const> const& velo,
+      Teuchos::RCP<Thyra::VectorBase<ST> const> const& acce,
+      ST const                                         time) const;
+
   std::vector<Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>>> solvers_;
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>>                 apps_;
   std::vector<Teuchos::RCP<Albany::AbstractSTKMeshStruct>>  stk_mesh_structs_;
   std::vector<Teuchos::RCP<Albany::AbstractDiscretization>> discs_;
 
+  // All ranks, and the ranks of the subdomains of this rank. They are the
+  // same except in additive mode with at least as many ranks as
+  // subdomains, where each rank holds one subdomain.
+  Teuchos::RCP<Teuchos::Comm<int> const> comm_{Teuchos::null};
+  Teuchos::RCP<Teuchos::Comm<int> const> subdomain_comm_{Teuchos::null};
+  std::vector<int>                       local_subdomains_;
+
   char const*  failure_message_{"No failure detected"};
   int          num_subdomains_{0};
   int          min_iters_{0};
@@ -185,8 +227,16 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   mutable ST   norm_init_{0.0};
   mutable ST   norm_final_{0.0};
   mutable ST   norm_diff_{0.0};
+  mutable int  total_iters_{0};
+  mutable ST   step_wall_time_{0.0};
+  mutable ST   total_wall_time_{0.0};
+
+  mutable SchwarzRelaxation relaxation_;
+
+  mutable SchwarzTransfer transfer_;
 
   mutable ConvergenceCriterion       criterion_{ConvergenceCriterion::BOTH};
+  SchwarzMode                        mode_{SchwarzMode::MULTIPLICATIVE};
   mutable ConvergenceLogicalOperator operator_{ConvergenceLogicalOperator::AND};
 
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> curr_disp_;
@@ -207,9 +257,8 @@ class SchwarzAlternating : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> this_velo_;
   mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> this_acce_;
 
-  mutable std::vector<LCM::StateArrays> internal_states_;
-  mutable std::vector<bool>             do_outputs_;
-  mutable std::vector<bool>             do_outputs_init_;
+  mutable std::vector<bool> do_outputs_;
+  mutable std::vector<bool> do_outputs_init_;
 
   // Used if solving with loca or tempus
   bool is_static_{false};
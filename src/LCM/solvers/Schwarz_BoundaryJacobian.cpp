@@ -8,9 +8,14 @@
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_Utils.hpp"
 #include "Albany_GlobalLocalIndexer.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "SchwarzInterpolation.hpp"
 
 #include <Teuchos_ParameterListExceptions.hpp>
 #include <Teuchos_TestForException.hpp>
+#include <Thyra_MultiVectorStdOps.hpp>
+
+#include <algorithm>
 
 namespace LCM {
 
@@ -34,6 +39,7 @@ Schwarz_BoundaryJacobian::Schwarz_BoundaryJacobian(
   ALBANY_EXPECT(0 <= coupled_app_index && coupled_app_index < ca.size());
   domain_vs_ = ca[coupled_app_index]->getVectorSpace();
   range_vs_  = ca[this_app_index]->getVectorSpace();
+  initialize();
 }
 
 //
@@ -42,28 +48,150 @@ Schwarz_BoundaryJacobian::Schwarz_BoundaryJacobian(
 void
 Schwarz_BoundaryJacobian::initialize()
 {
-  return;
+  rows_.clear();
+  row_offsets_.assign(1, 0);
+  cols_.clear();
+  weights_.clear();
+
+  Albany::Application const& this_app    = getApplication(this_app_index_);
+  Albany::Application const& coupled_app = getApplication(coupled_app_index_);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> coupled_disc =
+      coupled_app.getDiscretization();
+
+  cas_manager_ = Albany::createCombineAndScatterManager(
+      coupled_disc->getVectorSpace(), coupled_disc->getOverlapVectorSpace());
+
+  if (this_app_index_ == coupled_app_index_) return;
+
+  if (this_app.isCoupled(coupled_app_index_) == false) return;
+
+  auto* coupled_stk_disc =
+      static_cast<Albany::STKDiscretization*>(coupled_disc.get());
+
+  std::string const& nodeset_name =
+      this_app.getNodesetName(coupled_app_index_);
+
+  std::vector<std::vector<int>> const& ns_dof =
+      this_app.getDiscretization()->getNodeSets().find(nodeset_name)->second;
+
+  auto const dimension = coupled_disc->getNumDim();
+
+  std::vector<LO>     coupled_nodes;
+  std::vector<double> weights;
+
+  for (auto ns_node = 0; ns_node < ns_dof.size(); ++ns_node) {
+    findSchwarzInterpolation(
+        this_app,
+        coupled_app,
+        coupled_app_index_,
+        ns_node,
+        coupled_nodes,
+        weights);
+
+    for (auto i = 0; i < dimension; ++i) {
+      rows_.push_back(ns_dof[ns_node][i]);
+      for (auto node = 0; node < coupled_nodes.size(); ++node) {
+        cols_.push_back(
+            coupled_stk_disc->getOverlapDOF(coupled_nodes[node], i));
+        weights_.push_back(weights[node]);
+      }
+      row_offsets_.push_back(cols_.size());
+    }
+  }
+}
+
+//
+// The Schwarz BC evaluator zeroes the row and puts j_coeff on the
+// diagonal, so the row sum of the diagonal block recovers it.
+//
+std::vector<ST>
+Schwarz_BoundaryJacobian::computeRowScales() const
+{
+  std::vector<ST> scales(rows_.size(), 1.0);
+
+  Teuchos::RCP<Thyra_LinearOp> jac = jacs_[this_app_index_];
+
+  if (jac == Teuchos::null) return scales;
+
+  Teuchos::Array<LO> indices;
+  Teuchos::Array<ST> values;
+
+  for (auto r = 0; r < rows_.size(); ++r) {
+    Albany::getLocalRowValues(jac, rows_[r], indices, values);
+    ST sum = 0.0;
+    for (auto const value : values) { sum += value; }
+    scales[r] = sum;
+  }
+
+  return scales;
 }
 
 //
 // Returns explicit matrix representation of operator if available.
+// The graph is built on the first call; later calls refresh the values
+// in place, so a blocked operator holding the result stays current.
 //
 Teuchos::RCP<Thyra_LinearOp>
 Schwarz_BoundaryJacobian::getExplicitOperator() const
 {
-  auto const max_num_cols = Albany::getLocalSubdim(this->domain());
+  auto const range_indexer = Albany::createGlobalLocalIndexer(this->range());
+  auto const overlap_indexer = Albany::createGlobalLocalIndexer(
+      getApplication(coupled_app_index_)
+          .getDiscretization()
+          ->getOverlapVectorSpace());
+
+  Teuchos::Array<GO> global_cols;
+
+  if (explicit_op_ == Teuchos::null) {
+    std::size_t max_num_cols = 0;
+    for (auto r = 0; r < rows_.size(); ++r) {
+      max_num_cols =
+          std::max(max_num_cols, row_offsets_[r + 1] - row_offsets_[r]);
+    }
+
+    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> jac_factory =
+        Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(
+            this->domain(), this->range(), max_num_cols));
+
+    for (auto r = 0; r < rows_.size(); ++r) {
+      global_cols.clear();
+      for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) {
+        global_cols.push_back(overlap_indexer->getGlobalElement(cols_[k]));
+      }
+      jac_factory->insertGlobalIndices(
+          range_indexer->getGlobalElement(rows_[r]), global_cols());
+    }
 
-  // IKT: there may be problems here in creating jac_factory - will need to
-  // check
-  Teuchos::RCP<Albany::ThyraCrsMatrixFactory> jac_factory =
-      Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(
-          this->range(), this->domain(), max_num_cols));
+    jac_factory->fillComplete();
 
-  jac_factory->fillComplete();
+    explicit_op_ = jac_factory->createOp();
+  }
 
-  Teuchos::RCP<Thyra_LinearOp> K = jac_factory->createOp();
+  if (Albany::isFillActive(explicit_op_) == false) {
+    Albany::resumeFill(explicit_op_);
+  }
 
-  return K;
+  std::vector<ST> const scales = computeRowScales();
+
+  Teuchos::Array<ST> values;
+  for (auto r = 0; r < rows_.size(); ++r) {
+    global_cols.clear();
+    values.clear();
+    for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) {
+      global_cols.push_back(overlap_indexer->getGlobalElement(cols_[k]));
+      values.push_back(-scales[r] * weights_[k]);
+    }
+    Albany::replaceGlobalValues(
+        explicit_op_,
+        range_indexer->getGlobalElement(rows_[r]),
+        global_cols(),
+        values());
+  }
+
+  Albany::fillComplete(explicit_op_);
+
+  return explicit_op_;
 }
 
 //
@@ -72,15 +200,77 @@ Schwarz_BoundaryJacobian::getExplicitOperator() const
 //
 void
 Schwarz_BoundaryJacobian::applyImpl(
-    const Thyra::EOpTransp                 /* M_trans */,
-    const Thyra_MultiVector&               /* X */,
+    const Thyra::EOpTransp                 M_trans,
+    const Thyra_MultiVector&               X,
     const Teuchos::Ptr<Thyra_MultiVector>& Y,
-    const ST                               /* alpha */,
-    const ST                               /* beta */) const
+    const ST                               alpha,
+    const ST                               beta) const
 {
   auto const zero = Teuchos::ScalarTraits<ST>::zero();
 
-  Y->assign(zero);
+  // Avoid propagating NaN/Inf from an uninitialized Y.
+  if (beta == zero) {
+    Y->assign(zero);
+  } else {
+    Y->scale(beta);
+  }
+
+  if (rows_.empty() == true || alpha == zero) return;
+
+  std::vector<ST> const scales = computeRowScales();
+
+  auto const overlap_vs = getApplication(coupled_app_index_)
+                              .getDiscretization()
+                              ->getOverlapVectorSpace();
+
+  auto const num_vectors = X.domain()->dim();
+
+  Teuchos::RCP<Thyra_MultiVector> overlap_mv =
+      Thyra::createMembers(overlap_vs, num_vectors);
+
+  bool const transpose = M_trans == Thyra::TRANS ||
+                         M_trans == Thyra::CONJTRANS;
+
+  if (transpose == false) {
+    // Y(this) += alpha * (-s P) X(coupled), P reading the overlapped X.
+    cas_manager_->scatter(X, *overlap_mv, Albany::CombineMode::INSERT);
+
+    auto const x_data = Albany::getLocalData(overlap_mv.getConst());
+    auto       y_data = Albany::getNonconstLocalData(*Y);
+
+    for (auto v = 0; v < num_vectors; ++v) {
+      for (auto r = 0; r < rows_.size(); ++r) {
+        ST sum = 0.0;
+        for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) {
+          sum += weights_[k] * x_data[v][cols_[k]];
+        }
+        y_data[v][rows_[r]] -= alpha * scales[r] * sum;
+      }
+    }
+  } else {
+    // Y(coupled) += alpha * (-s P)^T X(this), summed over the owners.
+    overlap_mv->assign(zero);
+
+    {
+      auto const x_data = Albany::getLocalData(X);
+      auto       o_data = Albany::getNonconstLocalData(overlap_mv);
+
+      for (auto v = 0; v < num_vectors; ++v) {
+        for (auto r = 0; r < rows_.size(); ++r) {
+          ST const xr = alpha * scales[r] * x_data[v][rows_[r]];
+          for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) {
+            o_data[v][cols_[k]] -= weights_[k] * xr;
+          }
+        }
+      }
+    }
+
+    Teuchos::RCP<Thyra_MultiVector> owned_mv =
+        Thyra::createMembers(domain_vs_, num_vectors);
+    owned_mv->assign(zero);
+    cas_manager_->combine(*overlap_mv, *owned_mv, Albany::CombineMode::ADD);
+    Thyra::update(Teuchos::ScalarTraits<ST>::one(), *owned_mv, Y);
+  }
 }
 
 }  // namespace LCM
@@ -8,11 +8,13 @@
 #define LCM_SchwarzBoundaryJacobian_hpp
 
 #include <iostream>
+#include <vector>
 
 #include "Teuchos_Comm.hpp"
 #include "Teuchos_RCP.hpp"
 
 #include "Albany_Application.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
 #include "Albany_DataTypes.hpp"
 #include "MiniTensor.h"
 
@@ -23,6 +25,13 @@ namespace LCM {
 /// LCM coupled Schwarz Multiscale problem.
 /// Each Jacobian couples one single application to another.
 ///
+/// The Schwarz BC rows of this application read r = x - P x_coupled,
+/// where P interpolates the coupled solution at the Schwarz node set
+/// (see findSchwarzInterpolation). The off-diagonal block is therefore
+/// -P, scaled by the same coefficient that SchwarzBC puts on the
+/// diagonal of the Dirichlet row. P depends only on the reference
+/// geometry and is computed once in initialize().
+///
 
 class Schwarz_BoundaryJacobian : public Thyra_LinearOp
 {
@@ -37,7 +46,6 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   ~Schwarz_BoundaryJacobian() = default;
 
   /// Initialize the operator with everything needed to apply it
-  // FIXME: add arguments
   void
   initialize();
 
@@ -61,6 +69,7 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   }
 
   /// Returns explicit matrix representation of operator if available.
+  /// Repeated calls return the same matrix with refreshed values.
   Teuchos::RCP<Thyra_LinearOp>
   getExplicitOperator() const;
 
@@ -115,6 +124,11 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   }
 
  private:
+  /// Coefficient of each Schwarz row in the diagonal block, that is,
+  /// j_coeff as set by the Schwarz BC evaluator.
+  std::vector<ST>
+  computeRowScales() const;
+
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> coupled_apps_;
 
   Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>> jacs_;
@@ -132,6 +146,20 @@ class Schwarz_BoundaryJacobian : public Thyra_LinearOp
   Teuchos::RCP<Teuchos_Comm const> comm_;
 
   int n_models_;
+
+  // Interpolation operator in CSR form. Rows are owned local DOFs of this
+  // application, columns are local DOFs of the coupled overlap space.
+  std::vector<LO> rows_;
+
+  std::vector<std::size_t> row_offsets_;
+
+  std::vector<LO> cols_;
+
+  std::vector<ST> weights_;
+
+  Teuchos::RCP<Albany::CombineAndScatterManager const> cas_manager_;
+
+  mutable Teuchos::RCP<Thyra_LinearOp> explicit_op_;
 };
 
 }  // namespace LCM
@@ -101,6 +101,21 @@ SchwarzCoupled::SchwarzCoupled(
     ALBANY_ASSERT(false, "Unknown Matrix-Free Preconditioner type.");
   }
 
+  // Coupling between the subdomain Jacobians. With "None" the monolithic
+  // Newton is only a block Jacobi approximation.
+  std::string const off_diagonal =
+      coupled_system_params.get<std::string>("Off-Diagonal Blocks", "None");
+
+  if (off_diagonal == "None") {
+    off_diagonal_type_ = BLOCK_JACOBI;
+  } else if (off_diagonal == "Matrix-Free") {
+    off_diagonal_type_ = MATRIX_FREE_COUPLING;
+  } else if (off_diagonal == "Explicit") {
+    off_diagonal_type_ = EXPLICIT_COUPLING;
+  } else {
+    ALBANY_ASSERT(false, "Unknown Off-Diagonal Blocks type.");
+  }
+
   // If using matrix-free, get NOX sublist and set "Preconditioner Type" to
   // "None" regardless  of what is specified in the input file.
   // Currently preconditioners for matrix-free  are implemented in this
@@ -698,12 +713,42 @@ SchwarzCoupled::getUpperBounds() const
   return Thyra::ModelEvaluatorBase::InArgs<ST>();  // Default value
 }
 
+Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>
+SchwarzCoupled::getOffDiagonalBlocks() const
+{
+  Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>> blocks;
+
+  if (off_diagonal_type_ == BLOCK_JACOBI) return blocks;
+
+  if (boundary_jacs_.size() == 0) {
+    boundary_jacs_.resize(num_models_ * num_models_);
+    for (auto i = 0; i < num_models_; ++i) {
+      for (auto j = 0; j < num_models_; ++j) {
+        if (i == j || apps_[i]->isCoupled(j) == false) continue;
+        boundary_jacs_[i * num_models_ + j] = Teuchos::rcp(
+            new Schwarz_BoundaryJacobian(comm_, apps_, jacs_, i, j));
+      }
+    }
+  }
+
+  blocks.resize(boundary_jacs_.size());
+  for (auto k = 0; k < boundary_jacs_.size(); ++k) {
+    if (boundary_jacs_[k] == Teuchos::null) continue;
+    if (off_diagonal_type_ == EXPLICIT_COUPLING) {
+      blocks[k] = boundary_jacs_[k]->getExplicitOperator();
+    } else {
+      blocks[k] = boundary_jacs_[k];
+    }
+  }
+  return blocks;
+}
+
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 SchwarzCoupled::create_W_op() const
 {
   Schwarz_CoupledJacobian jac(comm_);
 
-  return jac.getThyraCoupledJacobian(jacs_, apps_);
+  return jac.getThyraCoupledJacobian(jacs_, apps_, getOffDiagonalBlocks());
 }
 
 Teuchos::RCP<Thyra_Preconditioner>
@@ -954,9 +999,11 @@ SchwarzCoupled::evalModelImpl(
           jacs_[m]);
       fs_already_computed[m] = true;
     }
-    // FIXME: create coupled W matrix from array of model W matrices
-    Schwarz_CoupledJacobian jac(comm_);
-    W_op_out = jac.getThyraCoupledJacobian(jacs_, apps_);
+    // The blocked W_op_out created by create_W_op() holds jacs_ and the
+    // boundary Jacobians, so the diagonal blocks are already current.
+    // Matrix-free coupling blocks read the Schwarz row coefficients from
+    // jacs_ when applied; explicit ones need their values refreshed.
+    if (off_diagonal_type_ == EXPLICIT_COUPLING) { getOffDiagonalBlocks(); }
   }
 
   for (auto m = 0; m < num_models_; ++m) {
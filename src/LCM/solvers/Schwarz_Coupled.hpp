@@ -198,6 +198,26 @@ class SchwarzCoupled : public Thyra::ModelEvaluatorDefaultBase<ST>
   };
 
   MF_PREC_TYPE mf_prec_type_;
+
+  /// Coupling blocks of the monolithic Jacobian: none (block Jacobi),
+  /// Schwarz_BoundaryJacobian applied matrix-free, or its explicit matrix.
+  enum OFF_DIAGONAL_TYPE
+  {
+    BLOCK_JACOBI,
+    MATRIX_FREE_COUPLING,
+    EXPLICIT_COUPLING
+  };
+
+  OFF_DIAGONAL_TYPE off_diagonal_type_;
+
+  /// Boundary Jacobians, (i,j) at i * num_models_ + j, built on first use.
+  mutable Teuchos::Array<Teuchos::RCP<Schwarz_BoundaryJacobian>>
+      boundary_jacs_;
+
+  /// Off-diagonal blocks for Schwarz_CoupledJacobian. For explicit
+  /// coupling this also refreshes the matrix values.
+  Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>
+  getOffDiagonalBlocks() const;
 };
 
 }  // namespace LCM
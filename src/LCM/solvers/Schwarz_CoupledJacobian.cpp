@@ -29,15 +29,14 @@ Schwarz_CoupledJacobian::Schwarz_CoupledJacobian(
 
 Schwarz_CoupledJacobian::~Schwarz_CoupledJacobian() { return; }
 
-//#define USE_OFF_DIAGONAL
-//#define EXPLICIT_OFF_DIAGONAL
-
 // getThyraCoupledJacobian method is similar to getThyraMatrix in panzer
 //(Panzer_BlockedTpetraLinearObjFactory_impl.hpp).
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Schwarz_CoupledJacobian::getThyraCoupledJacobian(
     Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>                jacs,
-    Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca) const
+    Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca,
+    Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>> const&         off_diagonal)
+    const
 {
   auto const block_dim = jacs.size();
 
@@ -66,29 +65,12 @@ Schwarz_CoupledJacobian::getThyraCoupledJacobian(
       // build (i,j) block matrix and add it to blocked operator
       if (i == j) {  // Diagonal blocks
         blocked_op->setNonconstBlock(i, j, jacs[i]);
-      } else {  // Off-diagonal blocks
-#if defined(USE_OFF_DIAGONAL)
-#if defined(EXPLICIT_OFF_DIAGONAL)
-
-        Teuchos::RCP<Schwarz_BoundaryJacobian> jac_boundary =
-            Teuchos::rcp(new Schwarz_BoundaryJacobian(comm_, ca, jacs, i, j));
-
-        Teuchos::RCP<Thyra_LinearOp> exp_jac =
-            jac_boundary->getExplicitOperator();
-
-        Teuchos::RCP<Thyra::LinearOpBase<ST>> block = exp_jac;
-
-#else
-
-        Teuchos::RCP<Thyra_LinearOp> jac_boundary =
-            Teuchos::rcp(new Schwarz_BoundaryJacobian(comm_, ca, jacs, i, j));
-
-        Teuchos::RCP<Thyra::LinearOpBase<ST>> block = jac_boundary;
-
-#endif  // EXPLICIT_OFF_DIAGONAL
-
-        blocked_op->setNonconstBlock(i, j, block);
-#endif  // USE_OFF_DIAGONAL
+      } else if (off_diagonal.size() > 0) {  // Off-diagonal blocks
+        Teuchos::RCP<Thyra_LinearOp> const& block =
+            off_diagonal[i * block_dim + j];
+        if (block != Teuchos::null) {
+          blocked_op->setNonconstBlock(i, j, block);
+        }
       }
     }
   }
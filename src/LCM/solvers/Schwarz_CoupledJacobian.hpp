@@ -27,10 +27,15 @@ class Schwarz_CoupledJacobian
 
   ~Schwarz_CoupledJacobian();
 
+  /// Block operator with jacs on the diagonal. off_diagonal, if not
+  /// empty, holds the (i,j) coupling block at i * jacs.size() + j;
+  /// null entries and an empty array mean zero blocks (block Jacobi).
   Teuchos::RCP<Thyra::LinearOpBase<ST>>
   getThyraCoupledJacobian(
       Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>                jacs,
-      Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca) const;
+      Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& ca,
+      Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>> const&         off_diagonal =
+          Teuchos::Array<Teuchos::RCP<Thyra_LinearOp>>()) const;
 
  private:
   Teuchos::RCP<Teuchos_Comm const> comm_;
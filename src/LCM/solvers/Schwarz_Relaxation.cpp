@@ -0,0 +1,313 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Schwarz_Relaxation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Albany_Utils.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+#include "Teuchos_SerialDenseSolver.hpp"
+#include "Teuchos_SerialDenseVector.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace LCM {
+
+//
+//
+//
+void
+SchwarzRelaxation::setParameters(Teuchos::ParameterList& params)
+{
+  std::string relaxation_str =
+      params.get<std::string>("Relaxation", "NONE");
+
+  std::transform(
+      relaxation_str.begin(),
+      relaxation_str.end(),
+      relaxation_str.begin(),
+      ::toupper);
+
+  if (relaxation_str == "NONE") {
+    type_ = Type::NONE;
+  } else if (relaxation_str == "AITKEN") {
+    type_ = Type::AITKEN;
+  } else if (relaxation_str == "ANDERSON") {
+    type_ = Type::ANDERSON;
+  } else {
+    ALBANY_ASSERT(false, "Unknown Schwarz Relaxation");
+  }
+
+  depth_          = params.get<int>("Anderson Depth", 5);
+  mixing_         = params.get<ST>("Anderson Mixing", 1.0);
+  omega_init_     = params.get<ST>("Initial Relaxation Factor", 1.0);
+  omega_min_      = params.get<ST>("Minimum Relaxation Factor", 0.05);
+  omega_max_      = params.get<ST>("Maximum Relaxation Factor", 2.0);
+  restart_factor_ = params.get<ST>("Relaxation Restart Factor", 10.0);
+
+  // Firewalls
+  ALBANY_ASSERT(depth_ >= 1, "");
+  ALBANY_ASSERT(mixing_ > 0.0, "");
+  ALBANY_ASSERT(omega_min_ > 0.0, "");
+  ALBANY_ASSERT(omega_max_ >= omega_min_, "");
+  ALBANY_ASSERT(omega_init_ >= omega_min_, "");
+  ALBANY_ASSERT(omega_init_ <= omega_max_, "");
+  ALBANY_ASSERT(restart_factor_ >= 1.0, "");
+
+  omega_ = omega_init_;
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::setCommunicator(
+    Teuchos::RCP<Teuchos::Comm<int> const> const& comm,
+    bool const                                    contributes)
+{
+  comm_        = comm;
+  contributes_ = contributes;
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::reset()
+{
+  restart();
+  prev_x_.clear();
+  prev_r_.clear();
+  prev_res_norm_ = 0.0;
+  num_restarts_  = 0;
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::restart()
+{
+  dx_.clear();
+  dr_.clear();
+  omega_ = omega_init_;
+}
+
+//
+// Inner product over all subdomains of field 0
+//
+ST
+SchwarzRelaxation::dot(Fields const& a, Fields const& b) const
+{
+  ST s{0.0};
+  for (auto subdomain = 0; subdomain < a[0].size(); ++subdomain) {
+    s += Thyra::dot(*a[0][subdomain], *b[0][subdomain]);
+  }
+  if (comm_.is_null() == true) return s;
+
+  ST const local{contributes_ == true ? s : 0.0};
+  Teuchos::reduceAll(
+      *comm_, Teuchos::REDUCE_SUM, local, Teuchos::ptrFromRef(s));
+  return s;
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::apply(
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g)
+{
+  if (type_ == Type::NONE) return;
+
+  auto const num_fields     = x.size();
+  auto const num_subdomains = x[0].size();
+
+  Fields r(num_fields);
+
+  for (auto field = 0; field < num_fields; ++field) {
+    r[field].resize(num_subdomains);
+    for (auto subdomain = 0; subdomain < num_subdomains; ++subdomain) {
+      auto& r_rcp = r[field][subdomain];
+      r_rcp       = Thyra::createMember(x[field][subdomain]->space());
+      Thyra::V_VmV(
+          r_rcp.ptr(), *g[field][subdomain], *x[field][subdomain]);
+    }
+  }
+
+  ST const res_norm = std::sqrt(dot(r, r));
+
+  bool const have_prev = prev_r_.size() > 0;
+
+  bool const diverging =
+      have_prev == true && res_norm > restart_factor_ * prev_res_norm_;
+
+  if (diverging == true) {
+    restart();
+    ++num_restarts_;
+  } else if (have_prev == true) {
+    Fields dx(num_fields), dr(num_fields);
+    for (auto field = 0; field < num_fields; ++field) {
+      dx[field].resize(num_subdomains);
+      dr[field].resize(num_subdomains);
+      for (auto subdomain = 0; subdomain < num_subdomains; ++subdomain) {
+        auto const& space = x[field][subdomain]->space();
+        dx[field][subdomain] = Thyra::createMember(space);
+        dr[field][subdomain] = Thyra::createMember(space);
+        Thyra::V_VmV(
+            dx[field][subdomain].ptr(),
+            *x[field][subdomain],
+            *prev_x_[field][subdomain]);
+        Thyra::V_VmV(
+            dr[field][subdomain].ptr(),
+            *r[field][subdomain],
+            *prev_r_[field][subdomain]);
+      }
+    }
+    dx_.push_back(dx);
+    dr_.push_back(dr);
+    while (dr_.size() > depth_) {
+      dx_.pop_front();
+      dr_.pop_front();
+    }
+  }
+
+  // Save the unrelaxed data of this iteration before g is overwritten.
+  prev_x_.resize(num_fields);
+  for (auto field = 0; field < num_fields; ++field) {
+    prev_x_[field].resize(num_subdomains);
+    for (auto subdomain = 0; subdomain < num_subdomains; ++subdomain) {
+      prev_x_[field][subdomain] = x[field][subdomain]->clone_v();
+    }
+  }
+  prev_r_        = r;
+  prev_res_norm_ = res_norm;
+
+  switch (type_) {
+    default: ALBANY_ASSERT(false, "Unknown Schwarz Relaxation"); break;
+    case Type::AITKEN: applyAitken(x, r, g); break;
+    case Type::ANDERSON: applyAnderson(x, r, g); break;
+  }
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::applyAitken(
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+    Fields const&                                                     r,
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g)
+{
+  if (dr_.size() > 0) {
+    // dr_.back() = r_k - r_{k-1}, r_{k-1} = r_k - dr_.back()
+    Fields const& dr       = dr_.back();
+    ST const      dr_dr    = dot(dr, dr);
+    ST const      r_dr     = dot(r, dr);
+    ST const      rprev_dr = r_dr - dr_dr;
+
+    if (dr_dr > 0.0) {
+      omega_ = -omega_ * rprev_dr / dr_dr;
+      omega_ = std::max(omega_min_, std::min(omega_max_, omega_));
+    }
+  }
+
+  for (auto field = 0; field < x.size(); ++field) {
+    for (auto subdomain = 0; subdomain < x[field].size(); ++subdomain) {
+      Thyra::V_VpStV(
+          g[field][subdomain].ptr(),
+          *x[field][subdomain],
+          omega_,
+          *r[field][subdomain]);
+    }
+  }
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::applyAnderson(
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+    Fields const&                                                     r,
+    std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g)
+{
+  int const m = dr_.size();
+
+  // Least squares min |r - dR c| through the normal equations. The
+  // history is short, so the m x m Gram matrix is cheap and its
+  // conditioning acceptable with a small Tikhonov shift.
+  Teuchos::SerialDenseVector<int, ST> c(m);
+
+  if (m > 0) {
+    Teuchos::SerialDenseMatrix<int, ST> A(m, m);
+    Teuchos::SerialDenseVector<int, ST> b(m);
+
+    ST trace{0.0};
+    for (auto i = 0; i < m; ++i) {
+      for (auto j = 0; j <= i; ++j) {
+        A(i, j) = dot(dr_[i], dr_[j]);
+        A(j, i) = A(i, j);
+      }
+      b(i) = dot(dr_[i], r);
+      trace += A(i, i);
+    }
+    for (auto i = 0; i < m; ++i) { A(i, i) += 1.0e-12 * trace; }
+
+    Teuchos::SerialDenseSolver<int, ST> solver;
+    solver.setMatrix(Teuchos::rcpFromRef(A));
+    solver.setVectors(Teuchos::rcpFromRef(c), Teuchos::rcpFromRef(b));
+    solver.factorWithEquilibration(true);
+
+    int const error = trace > 0.0 ? solver.solve() : 1;
+
+    // Fall back to simple mixing with a fresh history if the
+    // least-squares problem is singular.
+    if (error != 0) {
+      restart();
+      ++num_restarts_;
+      c.putScalar(0.0);
+    }
+  }
+
+  ST const beta = mixing_;
+
+  for (auto field = 0; field < x.size(); ++field) {
+    for (auto subdomain = 0; subdomain < x[field].size(); ++subdomain) {
+      auto g_ptr = g[field][subdomain].ptr();
+      Thyra::V_VpStV(g_ptr, *x[field][subdomain], beta, *r[field][subdomain]);
+      for (auto i = 0; i < dr_.size(); ++i) {
+        Thyra::Vp_StV(g_ptr, -c(i), *dx_[i][field][subdomain]);
+        Thyra::Vp_StV(g_ptr, -c(i) * beta, *dr_[i][field][subdomain]);
+      }
+    }
+  }
+}
+
+//
+//
+//
+void
+SchwarzRelaxation::report(std::ostream& os) const
+{
+  switch (type_) {
+    default: break;
+    case Type::AITKEN:
+      os << "Aitken relaxation  :" << omega_ << '\n';
+      break;
+    case Type::ANDERSON:
+      os << "Anderson history   :" << dr_.size() << " of " << depth_ << '\n';
+      break;
+  }
+  if (type_ != Type::NONE) {
+    os << "Relaxation restarts:" << num_restarts_ << '\n';
+  }
+}
+
+}  // namespace LCM
@@ -0,0 +1,154 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_SchwarzRelaxation_hpp)
+#define LCM_SchwarzRelaxation_hpp
+
+#include <deque>
+#include <iostream>
+#include <vector>
+
+#include "Albany_ThyraTypes.hpp"
+#include "Teuchos_Comm.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace LCM {
+
+///
+/// Relaxation of the Schwarz alternating fixed-point iteration.
+///
+/// One Schwarz iteration (a sweep over all subdomains) is a map
+/// x_{k+1} = G(x_k), where x stacks the solutions of all subdomains.
+/// Given the iterate x_k at the start of the sweep and g_k = G(x_k)
+/// at its end, apply() overwrites g_k with the relaxed iterate:
+///
+///   Aitken:   x_{k+1} = x_k + w_k r_k, r_k = g_k - x_k, with the
+///             dynamic factor w_k = -w_{k-1} (r_{k-1}, r_k - r_{k-1})
+///             / |r_k - r_{k-1}|^2 clipped to [w_min, w_max].
+///   Anderson: x_{k+1} = x_k + b r_k - (dX + b dR) c, where dX and dR
+///             hold the last m differences of iterates and residuals
+///             and c minimizes |r_k - dR c|.
+///
+/// Several fields can be relaxed together (e.g. displacement, velocity
+/// and acceleration in dynamics). The coefficients are computed from
+/// field 0 only and applied to all of them; since they are affine
+/// combinations, kinematic relations between the fields are preserved.
+///
+/// If the residual norm grows by more than the restart factor from one
+/// iteration to the next the history is discarded and the relaxation
+/// factor reset, which guards against divergence of the accelerated
+/// iteration.
+///
+class SchwarzRelaxation
+{
+ public:
+  enum class Type
+  {
+    NONE,
+    AITKEN,
+    ANDERSON
+  };
+
+  SchwarzRelaxation() = default;
+
+  /// Read options from the "Alternating System" parameter list
+  void
+  setParameters(Teuchos::ParameterList& params);
+
+  /// When each rank holds only some of the subdomains, sum the inner
+  /// products over comm. Thyra::dot already reduces within the group
+  /// of ranks of a subdomain, so only one rank per group contributes.
+  void
+  setCommunicator(
+      Teuchos::RCP<Teuchos::Comm<int> const> const& comm,
+      bool const                                    contributes);
+
+  /// Discard history, to be called at the start of every step
+  void
+  reset();
+
+  /// x[f][s] is field f of subdomain s at the start of the sweep,
+  /// g[f][s] the same after the sweep and is replaced by the
+  /// relaxed iterate.
+  void
+  apply(
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g);
+
+  bool
+  isActive() const
+  {
+    return type_ != Type::NONE;
+  }
+
+  Type
+  getType() const
+  {
+    return type_;
+  }
+
+  ST
+  getLastFactor() const
+  {
+    return omega_;
+  }
+
+  int
+  getNumRestarts() const
+  {
+    return num_restarts_;
+  }
+
+  void
+  report(std::ostream& os) const;
+
+ private:
+  using Fields = std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>>;
+
+  ST
+  dot(Fields const& a, Fields const& b) const;
+
+  void
+  restart();
+
+  void
+  applyAitken(
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+      Fields const&                                                     r,
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g);
+
+  void
+  applyAnderson(
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector const>>> const& x,
+      Fields const&                                                     r,
+      std::vector<std::vector<Teuchos::RCP<Thyra_Vector>>> const&       g);
+
+  Teuchos::RCP<Teuchos::Comm<int> const> comm_{Teuchos::null};
+
+  bool contributes_{true};
+
+  Type type_{Type::NONE};
+  int  depth_{5};
+  ST   omega_init_{1.0};
+  ST   omega_min_{0.05};
+  ST   omega_max_{2.0};
+  ST   mixing_{1.0};
+  ST   restart_factor_{10.0};
+
+  ST     omega_{1.0};
+  ST     prev_res_norm_{0.0};
+  int    num_restarts_{0};
+  Fields prev_x_;
+  Fields prev_r_;
+
+  std::deque<Fields> dx_;
+  std::deque<Fields> dr_;
+};
+
+}  // namespace LCM
+
+#endif  // LCM_SchwarzRelaxation_hpp
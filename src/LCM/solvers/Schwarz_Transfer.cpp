@@ -0,0 +1,374 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Schwarz_Transfer.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_Utils.hpp"
+#include "SchwarzInterpolation.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace LCM {
+
+namespace {
+
+std::vector<int>::const_iterator
+findSubdomain(std::vector<int> const& subdomains, int const subdomain)
+{
+  return std::find(subdomains.begin(), subdomains.end(), subdomain);
+}
+
+}  // anonymous namespace
+
+//
+//
+//
+void
+SchwarzTransfer::setup(
+    Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& apps,
+    std::vector<int> const&                       local_subdomains,
+    Teuchos::RCP<Teuchos::Comm<int> const> const& comm)
+{
+  apps_             = apps;
+  comm_             = comm;
+  local_subdomains_ = local_subdomains;
+
+  int const num_subdomains = apps.size();
+
+  cas_managers_.assign(num_subdomains, Teuchos::null);
+
+  // Node sets of this rank coupled to other subdomains, packed as
+  // [number of node sets, (subdomain, target, points, name length,
+  // name)...] and their coordinates.
+  std::vector<int>    int_data{0};
+  std::vector<double> double_data;
+
+  for (auto subdomain : local_subdomains_) {
+    auto const& app  = *apps_[subdomain];
+    auto const  disc = app.getDiscretization();
+    auto&       stk_disc = static_cast<Albany::STKDiscretization&>(*disc);
+
+    ALBANY_ASSERT(disc->getNumDim() == 3, "Schwarz transfer needs a 3D mesh");
+
+    cas_managers_[subdomain] = Albany::createCombineAndScatterManager(
+        disc->getVectorSpace(), disc->getOverlapVectorSpace());
+
+    auto const& ns_coords = stk_disc.getNodeSetCoords();
+
+    for (auto target = 0; target < num_subdomains; ++target) {
+      if (target == subdomain || app.isCoupled(target) == false) continue;
+
+      std::string const block_name = app.getCoupledBlockName(target);
+
+      auto it = ns_coords.find(app.getNodesetName(target));
+
+      int const num_points = it == ns_coords.end() ? 0 : it->second.size();
+
+      ++int_data[0];
+      int_data.push_back(subdomain);
+      int_data.push_back(target);
+      int_data.push_back(num_points);
+      int_data.push_back(block_name.size());
+      int_data.insert(int_data.end(), block_name.begin(), block_name.end());
+
+      for (auto p = 0; p < num_points; ++p) {
+        double const* const coord = it->second[p];
+        double_data.insert(double_data.end(), coord, coord + 3);
+      }
+    }
+  }
+
+  // Send them to all ranks, padded to a common length.
+  int const num_ranks = comm->getSize();
+  int const rank      = comm->getRank();
+
+  int local_sizes[2] = {static_cast<int>(int_data.size()),
+                        static_cast<int>(double_data.size()) + 1};
+  int max_sizes[2];
+
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 2, local_sizes, max_sizes);
+
+  int_data.resize(max_sizes[0], 0);
+  double_data.resize(max_sizes[1], 0.0);
+
+  std::vector<int>    all_ints(num_ranks * max_sizes[0]);
+  std::vector<double> all_doubles(num_ranks * max_sizes[1]);
+
+  Teuchos::gatherAll(
+      *comm,
+      max_sizes[0],
+      int_data.data(),
+      num_ranks * max_sizes[0],
+      all_ints.data());
+
+  Teuchos::gatherAll(
+      *comm,
+      max_sizes[1],
+      double_data.data(),
+      num_ranks * max_sizes[1],
+      all_doubles.data());
+
+  // Number all points, keep the requests of this rank and locate the
+  // points coupled to the local subdomains in the elements of this rank.
+  std::vector<Source> candidates;
+  std::vector<int>    requesters;
+
+  requests_.clear();
+  num_slots_ = 0;
+
+  int num_points_total{0};
+
+  for (auto r = 0; r < num_ranks; ++r) {
+    int const* const    ints    = &all_ints[r * max_sizes[0]];
+    double const* const doubles = &all_doubles[r * max_sizes[1]];
+
+    auto const num_requests = ints[0];
+
+    auto pos       = 1;
+    auto coord_pos = 0;
+
+    for (auto q = 0; q < num_requests; ++q) {
+      auto const subdomain   = ints[pos++];
+      auto const target      = ints[pos++];
+      auto const num_points  = ints[pos++];
+      auto const name_length = ints[pos++];
+
+      std::string const block_name(ints + pos, ints + pos + name_length);
+
+      pos += name_length;
+
+      requesters.insert(requesters.end(), num_points, r);
+
+      if (r == rank) {
+        requests_.push_back(
+            {subdomain, target, num_points_total, num_points, num_slots_});
+        num_slots_ += num_points;
+      }
+
+      auto const it = findSubdomain(local_subdomains_, target);
+
+      if (it != local_subdomains_.end()) {
+        for (auto p = 0; p < num_points; ++p) {
+          Source source;
+
+          source.subdomain = target;
+          source.point     = num_points_total + p;
+
+          bool const found = locateSchwarzPoint(
+              *apps_[target],
+              block_name,
+              doubles + coord_pos + 3 * p,
+              source.nodes,
+              source.weights);
+
+          if (found == true) candidates.push_back(source);
+        }
+      }
+
+      coord_pos += 3 * num_points;
+      num_points_total += num_points;
+    }
+  }
+
+  // The lowest rank that found a point owns it.
+  std::vector<int> local_owners(num_points_total, num_ranks);
+  std::vector<int> owners(num_points_total, num_ranks);
+
+  for (auto const& source : candidates) { local_owners[source.point] = rank; }
+
+  if (num_points_total > 0) {
+    Teuchos::reduceAll(
+        *comm,
+        Teuchos::REDUCE_MIN,
+        num_points_total,
+        local_owners.data(),
+        owners.data());
+  }
+
+  for (auto point = 0; point < num_points_total; ++point) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        owners[point] == num_ranks,
+        std::runtime_error,
+        "Schwarz boundary point " << point
+                                  << " not found in its coupled subdomain.\n");
+  }
+
+  sources_.clear();
+
+  for (auto const& source : candidates) {
+    if (owners[source.point] == rank) sources_.push_back(source);
+  }
+
+  // Points go from their owner to the rank that requested them. Both
+  // sides list them in increasing point order.
+  std::map<int, std::vector<int>> send_items;
+  std::map<int, std::vector<int>> receive_items;
+
+  for (auto s = 0; s < sources_.size(); ++s) {
+    send_items[requesters[sources_[s].point]].push_back(s);
+  }
+
+  for (auto const& request : requests_) {
+    for (auto p = 0; p < request.num_points; ++p) {
+      receive_items[owners[request.offset + p]].push_back(request.slot + p);
+    }
+  }
+
+  sends_.clear();
+  receives_.clear();
+
+  for (auto const& items : send_items) {
+    sends_.push_back({items.first, items.second});
+  }
+
+  for (auto const& items : receive_items) {
+    receives_.push_back({items.first, items.second});
+  }
+}
+
+//
+//
+//
+void
+SchwarzTransfer::exchange(std::vector<Fields> const& fields) const
+{
+  int const num_fields = fields[local_subdomains_.front()].size();
+  int const stride     = 3 * num_fields;
+  int const rank       = comm_->getRank();
+
+  // Values at the points owned by this rank, as [source][field][component]
+  std::vector<ST> source_values(sources_.size() * stride, 0.0);
+
+  for (auto subdomain : local_subdomains_) {
+    auto const disc          = apps_[subdomain]->getDiscretization();
+    auto const num_equations = apps_[subdomain]->getNumEquations();
+
+    ALBANY_ASSERT(
+        fields[subdomain].size() == num_fields,
+        "All subdomains must exchange the same number of fields.");
+
+    for (auto f = 0; f < num_fields; ++f) {
+      if (fields[subdomain][f] == Teuchos::null) continue;
+
+      // The interpolation uses the nodes of the elements of this rank.
+      Teuchos::RCP<Thyra_Vector> overlap =
+          Thyra::createMember(disc->getOverlapVectorSpace());
+
+      cas_managers_[subdomain]->scatter(
+          *fields[subdomain][f], *overlap, Albany::CombineMode::INSERT);
+
+      Teuchos::ArrayRCP<ST const> const view =
+          Albany::getLocalData(overlap.getConst());
+
+      for (auto s = 0; s < sources_.size(); ++s) {
+        auto const& source = sources_[s];
+
+        if (source.subdomain != subdomain) continue;
+
+        for (auto i = 0; i < 3; ++i) {
+          ST value{0.0};
+
+          for (auto n = 0; n < source.nodes.size(); ++n) {
+            value += source.weights[n] *
+                     view[num_equations * source.nodes[n] + i];
+          }
+
+          source_values[s * stride + 3 * f + i] = value;
+        }
+      }
+    }
+  }
+
+  // Values at the points requested by this rank, as [slot][field][component]
+  std::vector<ST> values(num_slots_ * stride, 0.0);
+
+  std::vector<Teuchos::ArrayRCP<ST>> receive_buffers;
+  std::vector<Teuchos::ArrayRCP<ST>> send_buffers;
+
+  Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<int>>> receive_reqs;
+  Teuchos::Array<Teuchos::RCP<Teuchos::CommRequest<int>>> send_reqs;
+
+  for (auto const& message : receives_) {
+    if (message.rank == rank) continue;
+
+    receive_buffers.push_back(
+        Teuchos::ArrayRCP<ST>(message.items.size() * stride));
+    receive_reqs.push_back(
+        Teuchos::ireceive(*comm_, receive_buffers.back(), message.rank));
+  }
+
+  for (auto const& message : sends_) {
+    Teuchos::ArrayRCP<ST> buffer(message.items.size() * stride);
+
+    for (auto k = 0; k < message.items.size(); ++k) {
+      std::copy_n(
+          &source_values[message.items[k] * stride],
+          stride,
+          &buffer[k * stride]);
+    }
+
+    if (message.rank == rank) {
+      // Points owned and requested by this rank
+      auto const it = std::find_if(
+          receives_.begin(), receives_.end(), [rank](Message const& m) {
+            return m.rank == rank;
+          });
+
+      ALBANY_ASSERT(it != receives_.end(), "");
+
+      for (auto k = 0; k < it->items.size(); ++k) {
+        std::copy_n(
+            &buffer[k * stride], stride, &values[it->items[k] * stride]);
+      }
+      continue;
+    }
+
+    send_buffers.push_back(buffer);
+    send_reqs.push_back(
+        Teuchos::isend(*comm_, buffer.getConst(), message.rank));
+  }
+
+  Teuchos::waitAll(*comm_, receive_reqs());
+  Teuchos::waitAll(*comm_, send_reqs());
+
+  auto b = 0;
+
+  for (auto const& message : receives_) {
+    if (message.rank == rank) continue;
+
+    auto const& buffer = receive_buffers[b++];
+
+    for (auto k = 0; k < message.items.size(); ++k) {
+      std::copy_n(
+          &buffer[k * stride], stride, &values[message.items[k] * stride]);
+    }
+  }
+
+  for (auto const& request : requests_) {
+    std::vector<std::vector<ST>> boundary_values(num_fields);
+
+    for (auto f = 0; f < num_fields; ++f) {
+      boundary_values[f].resize(3 * request.num_points);
+
+      for (auto p = 0; p < request.num_points; ++p) {
+        for (auto i = 0; i < 3; ++i) {
+          boundary_values[f][3 * p + i] =
+              values[(request.slot + p) * stride + 3 * f + i];
+        }
+      }
+    }
+
+    apps_[request.subdomain]->setSchwarzBoundaryValues(
+        request.target, boundary_values);
+  }
+}
+
+}  // namespace LCM
@@ -0,0 +1,106 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_SchwarzTransfer_hpp)
+#define LCM_SchwarzTransfer_hpp
+
+#include <string>
+#include <vector>
+
+#include "Albany_Application.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_ThyraTypes.hpp"
+#include "Teuchos_Comm.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace LCM {
+
+///
+/// Transfer of Schwarz boundary values between subdomains for additive
+/// Schwarz. The subdomains may live on disjoint groups of ranks, so the
+/// Schwarz BCs cannot read the coupled solution directly.
+///
+/// setup() sends the coordinates of the Schwarz node sets of every rank
+/// to all ranks. The ranks of the coupled subdomain locate them in their
+/// elements, and the lowest rank that finds a point becomes its owner.
+/// Every rank then knows which of its points come from which owner.
+///
+/// exchange() has the owners interpolate the current solution of their
+/// subdomain at the points they own and send the values only to the
+/// ranks that requested them. The values of each node set are handed to
+/// its application through Albany::Application::setSchwarzBoundaryValues().
+///
+class SchwarzTransfer
+{
+ public:
+  using Fields = std::vector<Teuchos::RCP<Thyra_Vector const>>;
+
+  SchwarzTransfer() = default;
+
+  /// Collective over comm. apps[s] for s in local_subdomains are the
+  /// applications of this rank, the other entries are not used.
+  void
+  setup(
+      Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> const& apps,
+      std::vector<int> const&                       local_subdomains,
+      Teuchos::RCP<Teuchos::Comm<int> const> const& comm);
+
+  /// Collective over comm, with the same number of fields for all local
+  /// subdomains on all ranks. fields[s][f] is the solution (f = 0) or one
+  /// of its time derivatives of local subdomain s, in its owned vector
+  /// space. A null field is sent as zero.
+  void
+  exchange(std::vector<Fields> const& fields) const;
+
+ private:
+  // A Schwarz node set of a local subdomain coupled to another subdomain.
+  // Its points are numbered offset, ..., offset + num_points - 1 over all
+  // ranks and stored from slot on this rank.
+  struct Request
+  {
+    int subdomain;
+    int target;
+    int offset;
+    int num_points;
+    int slot;
+  };
+
+  // A point owned by this rank: interpolation from a local solution
+  struct Source
+  {
+    int                 subdomain;
+    int                 point;
+    std::vector<LO>     nodes;
+    std::vector<double> weights;
+  };
+
+  // Points exchanged with one rank, in increasing point order: indices
+  // into sources_ when sending, slots when receiving.
+  struct Message
+  {
+    int              rank;
+    std::vector<int> items;
+  };
+
+  Teuchos::ArrayRCP<Teuchos::RCP<Albany::Application>> apps_;
+  Teuchos::RCP<Teuchos::Comm<int> const> comm_{Teuchos::null};
+
+  std::vector<int> local_subdomains_;
+
+  // Indexed by subdomain, null for subdomains of other ranks
+  std::vector<Teuchos::RCP<Albany::CombineAndScatterManager>> cas_managers_;
+
+  int num_slots_{0};
+
+  std::vector<Request> requests_;
+  std::vector<Source>  sources_;
+  std::vector<Message> sends_;
+  std::vector<Message> receives_;
+};
+
+}  // namespace LCM
+
+#endif  // LCM_SchwarzTransfer_hpp
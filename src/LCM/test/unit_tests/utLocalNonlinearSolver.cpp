@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 #include <LocalNonlinearSolver.hpp>
+#include <algorithm>
 #include <Sacado.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
 #include "PHAL_AlbanyTraits.hpp"
@@ -156,3 +157,160 @@ TEUCHOS_UNIT_TEST(LocalNonlinearSolver, Tangent)
   TEST_COMPARE(fabs(X[0].val() - refX[0]), <=, 1.0e-15);
 }
 }  // namespace
+
+namespace {
+
+//
+// Diagonally weak test matrix that forces row interchanges.
+//
+template <int N>
+void
+fillTestSystem(RealType* A, RealType* b)
+{
+  for (int j = 0; j < N; ++j) {
+    for (int i = 0; i < N; ++i) {
+      A[i + N * j] = 1.0 / (1.0 + i + 2.0 * j) + (i == N - 1 - j ? 3.0 : 0.0);
+    }
+    b[j] = 1.0 + 0.5 * j;
+  }
+}
+
+template <int N>
+RealType
+fixedSizeVersusLapack()
+{
+  RealType A[N * N], b[N], A_lapack[N * N], b_lapack[N];
+  fillTestSystem<N>(A, b);
+  for (int k = 0; k < N * N; ++k) A_lapack[k] = A[k];
+  for (int i = 0; i < N; ++i) b_lapack[i] = b[i];
+
+  LCM::FixedSizeLU<N> lu;
+  lu.factor(A);
+  lu.solve(b);
+
+  Teuchos::LAPACK<int, RealType> lapack;
+  int                            ipiv[N];
+  int                            info(0);
+  lapack.GESV(N, 1, A_lapack, N, ipiv, b_lapack, N, &info);
+
+  RealType error(0.0);
+  for (int i = 0; i < N; ++i) {
+    error = std::max(error, std::abs(b[i] - b_lapack[i]));
+  }
+  return error;
+}
+
+}  // namespace
+
+namespace {
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, FixedSizeLU)
+{
+  TEST_COMPARE(fixedSizeVersusLapack<1>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<2>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<3>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<5>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<6>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<9>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<13>(), <=, 1.0e-14);
+  TEST_COMPARE(fixedSizeVersusLapack<16>(), <=, 1.0e-14);
+}
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, JacobianSystem)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Jacobian          EvalT;
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // x_i^3 + sum_j c_ij x_j - p_i == 0 with global parameters p
+  int const                                numLocalVars(5);
+  int const                                numGlobalVars(numLocalVars);
+  std::vector<ScalarT>                     F(numLocalVars);
+  std::vector<ScalarT>                     dFdX(numLocalVars * numLocalVars);
+  std::vector<ScalarT>                     X(numLocalVars);
+  LCM::LocalNonlinearSolver<EvalT, Traits> solver;
+
+  std::vector<ScalarT> P(numLocalVars);
+  for (int i = 0; i < numLocalVars; ++i) {
+    P[i] = ScalarT(numGlobalVars, i, 1.0 + i);
+    X[i] = 0.5;
+  }
+
+  auto c = [](int i, int j) { return i == j ? 2.0 : 0.1 * (i + 1) / (j + 1); };
+
+  auto evaluate = [&]() {
+    for (int i = 0; i < numLocalVars; ++i) {
+      F[i] = X[i] * X[i] * X[i] - P[i];
+      for (int j = 0; j < numLocalVars; ++j) {
+        F[i] += c(i, j) * X[j];
+        dFdX[i + numLocalVars * j] =
+            c(i, j) + (i == j ? 3.0 * X[i] * X[i] : 0.0);
+      }
+    }
+  };
+
+  for (int iter = 0; iter < 30; ++iter) {
+    evaluate();
+    solver.solve(dFdX, X, F);
+  }
+  evaluate();
+  solver.computeFadInfo(dFdX, X, F);
+
+  // dX/dP = (dF/dX)^{-1} at the solution, computed directly with LAPACK
+  std::vector<RealType> J(numLocalVars * numLocalVars);
+  std::vector<RealType> inv(numLocalVars * numLocalVars, 0.0);
+  std::vector<int>      ipiv(numLocalVars);
+  int                   info(0);
+  for (int k = 0; k < numLocalVars * numLocalVars; ++k) J[k] = dFdX[k].val();
+  for (int i = 0; i < numLocalVars; ++i) inv[i + numLocalVars * i] = 1.0;
+  solver.lapack.GESV(
+      numLocalVars,
+      numLocalVars,
+      &J[0],
+      numLocalVars,
+      &ipiv[0],
+      &inv[0],
+      numLocalVars,
+      &info);
+
+  for (int i = 0; i < numLocalVars; ++i) {
+    TEST_COMPARE(std::abs(F[i].val()), <=, 1.0e-12);
+    for (int j = 0; j < numGlobalVars; ++j) {
+      TEST_COMPARE(
+          std::abs(X[i].dx(j) - inv[i + numLocalVars * j]), <=, 1.0e-13);
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(LocalNonlinearSolver, LargeSystemFallback)
+{
+  typedef PHAL::AlbanyTraits                    Traits;
+  typedef PHAL::AlbanyTraits::Residual          EvalT;
+  typedef PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+
+  // larger than the fixed-size path, goes through LAPACK
+  int const numLocalVars = LCM::LOCAL_SOLVER_MAX_FIXED_SIZE + 4;
+  std::vector<ScalarT>                     F(numLocalVars);
+  std::vector<ScalarT>                     dFdX(numLocalVars * numLocalVars);
+  std::vector<ScalarT>                     X(numLocalVars, 0.0);
+  LCM::LocalNonlinearSolver<EvalT, Traits> solver;
+
+  for (int i = 0; i < numLocalVars; ++i) {
+    F[i] = -(1.0 + i);
+    for (int j = 0; j < numLocalVars; ++j) {
+      dFdX[i + numLocalVars * j] = i == j ? 4.0 : 1.0 / (1.0 + i + j);
+    }
+  }
+  std::vector<ScalarT> const A = dFdX;
+  std::vector<ScalarT> const B = F;
+
+  solver.solve(dFdX, X, F);
+
+  for (int i = 0; i < numLocalVars; ++i) {
+    RealType r = B[i];
+    for (int j = 0; j < numLocalVars; ++j) r += A[i + numLocalVars * j] * X[j];
+    TEST_COMPARE(std::abs(r), <=, 1.0e-13);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,96 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <Sacado.hpp>
+#include <algorithm>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "ACEcommon.hpp"
+
+namespace {
+
+// Abscissas for the tests, including points outside the table, at the
+// table nodes and in the last interval.
+std::vector<RealType>
+samplePoints(std::vector<RealType> const& xv)
+{
+  std::vector<RealType> xs;
+  RealType const        a = xv.front() - 1.0;
+  RealType const        b = xv.back() + 1.0;
+  auto const            m = 1000;
+  for (auto i = 0; i <= m; ++i) { xs.push_back(a + (b - a) * i / m); }
+  for (auto x : xv) { xs.push_back(x); }
+  return xs;
+}
+
+TEUCHOS_UNIT_TEST(TabulatedFunction, Uniform)
+{
+  std::vector<RealType> xv;
+  std::vector<RealType> yv;
+  for (auto i = 0; i < 101; ++i) {
+    xv.push_back(-2.0 + 0.25 * i);
+    yv.push_back(std::sin(0.25 * i));
+  }
+
+  LCM::TabulatedFunction const table(xv, yv);
+  TEST_EQUALITY(table.isUniform(), true);
+
+  auto const xs = samplePoints(xv);
+  for (auto x : xs) {
+    TEST_EQUALITY(table.value(x), LCM::interpolateVectors(xv, yv, x));
+  }
+}
+
+TEUCHOS_UNIT_TEST(TabulatedFunction, NonUniform)
+{
+  std::vector<RealType> xv;
+  std::vector<RealType> yv;
+  for (auto i = 0; i < 101; ++i) {
+    xv.push_back(0.01 * i * i);
+    yv.push_back(std::cos(0.1 * i));
+  }
+
+  LCM::TabulatedFunction const table(xv, yv);
+  TEST_EQUALITY(table.isUniform(), false);
+
+  // Increasing, then decreasing, to exercise the cached bracket.
+  auto        xs = samplePoints(xv);
+  std::size_t hint{0};
+  for (auto x : xs) {
+    TEST_EQUALITY(table.value(x, hint), LCM::interpolateVectors(xv, yv, x));
+  }
+  std::reverse(xs.begin(), xs.end());
+  for (auto x : xs) {
+    TEST_EQUALITY(table.value(x, hint), LCM::interpolateVectors(xv, yv, x));
+  }
+
+  std::vector<RealType> ys(xs.size());
+  table.values(xs, ys, xs.size());
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    TEST_EQUALITY(ys[i], LCM::interpolateVectors(xv, yv, xs[i]));
+  }
+}
+
+TEUCHOS_UNIT_TEST(TabulatedFunction, Derivative)
+{
+  using FadT = Sacado::Fad::DFad<RealType>;
+
+  std::vector<RealType> const xv{0.0, 1.0, 3.0, 4.0, 8.0};
+  std::vector<RealType> const yv{1.0, 2.0, -2.0, 0.0, 4.0};
+
+  LCM::TabulatedFunction const table(xv, yv);
+
+  FadT x(1, 0, 2.0);
+  FadT y = table.value(x);
+  TEST_EQUALITY(y.val(), LCM::interpolateVectors(xv, yv, 2.0));
+  TEST_FLOATING_EQUALITY(y.dx(0), -2.0, 1.0e-14);
+
+  // Constant outside the table.
+  x = FadT(1, 0, -1.0);
+  y = table.value(x);
+  TEST_EQUALITY(y.val(), yv.front());
+  TEST_EQUALITY(y.dx(0), 0.0);
+}
+
+}  // namespace
@@ -0,0 +1,118 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+// Timing of the fixed-size LU path in LocalNonlinearSolver against
+// LAPACK GESV for the system sizes found in the LCM return mappings.
+//
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_LAPACK.hpp>
+
+#include "LocalNonlinearSolver.hpp"
+
+namespace {
+
+template <int N>
+void
+fillSystem(RealType* A, RealType* b, int const seed)
+{
+  for (int j = 0; j < N; ++j) {
+    for (int i = 0; i < N; ++i) {
+      A[i + N * j] = 1.0 / (1.0 + i + j + seed % 7) + (i == j ? N : 0.0);
+    }
+    b[j] = 1.0 + j + seed % 3;
+  }
+}
+
+template <int N>
+void
+timeSize(int const num_solves)
+{
+  RealType A[N * N], b[N];
+  int      ipiv[N];
+  int      info(0);
+  RealType checksum_lapack(0.0), checksum_fixed(0.0);
+
+  Teuchos::LAPACK<int, RealType> lapack;
+
+  auto const lapack_start = std::chrono::steady_clock::now();
+  for (int k = 0; k < num_solves; ++k) {
+    fillSystem<N>(A, b, k);
+    lapack.GESV(N, 1, A, N, ipiv, b, N, &info);
+    checksum_lapack += b[0];
+  }
+  auto const lapack_stop = std::chrono::steady_clock::now();
+
+  auto const fixed_start = std::chrono::steady_clock::now();
+  for (int k = 0; k < num_solves; ++k) {
+    fillSystem<N>(A, b, k);
+    LCM::FixedSizeLU<N> lu;
+    lu.factor(A);
+    lu.solve(b);
+    checksum_fixed += b[0];
+  }
+  auto const fixed_stop = std::chrono::steady_clock::now();
+
+  std::chrono::duration<double> const lapack_time = lapack_stop - lapack_start;
+  std::chrono::duration<double> const fixed_time  = fixed_stop - fixed_start;
+
+  std::cout << std::setw(4) << N;
+  std::cout << std::setw(16) << lapack_time.count();
+  std::cout << std::setw(16) << fixed_time.count();
+  std::cout << std::setw(12) << lapack_time.count() / fixed_time.count();
+  std::cout << std::setw(16) << std::abs(checksum_lapack - checksum_fixed);
+  std::cout << '\n';
+}
+
+}  // anonymous namespace
+
+int
+main(int ac, char* av[])
+{
+  Teuchos::CommandLineProcessor command_line_processor;
+
+  command_line_processor.setDocString(
+      "Timing of LocalNonlinearSolver fixed-size LU versus LAPACK.\n");
+
+  int num_solves = 1000000;
+  command_line_processor.setOption(
+      "solves", &num_solves, "Number of solves per system size");
+
+  command_line_processor.recogniseAllOptions(true);
+  command_line_processor.throwExceptions(false);
+
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parse_return =
+      command_line_processor.parse(ac, av);
+
+  if (parse_return == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    return 0;
+  }
+
+  if (parse_return != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    return 1;
+  }
+
+  std::cout << std::setw(4) << "N";
+  std::cout << std::setw(16) << "LAPACK [s]";
+  std::cout << std::setw(16) << "fixed [s]";
+  std::cout << std::setw(12) << "speedup";
+  std::cout << std::setw(16) << "difference";
+  std::cout << '\n';
+
+  timeSize<2>(num_solves);
+  timeSize<3>(num_solves);
+  timeSize<4>(num_solves);
+  timeSize<5>(num_solves);
+  timeSize<6>(num_solves);
+  timeSize<7>(num_solves);
+  timeSize<9>(num_solves);
+  timeSize<13>(num_solves);
+
+  return 0;
+}
@@ -13,6 +13,94 @@
 
 namespace LCM {
 
+///
+/// Largest local system size handled by the fixed-size path.
+/// Larger systems fall back to LAPACK.
+///
+constexpr int LOCAL_SOLVER_MAX_FIXED_SIZE = 16;
+
+///
+/// Dense LU factorization with partial pivoting for N x N systems in
+/// column-major storage, as LAPACK GETRF/GETRS, with all storage on
+/// the stack. Intended for the small local systems of constitutive
+/// updates, where a library call and heap buffers dominate the cost.
+///
+template <int N>
+class FixedSizeLU
+{
+ public:
+  ///
+  /// Factor column-major A. Returns 0 on success or k + 1 if the
+  /// pivot U(k, k) is exactly zero, following the LAPACK convention.
+  ///
+  KOKKOS_INLINE_FUNCTION
+  int
+  factor(RealType const* A);
+
+  ///
+  /// Overwrite b with the solution of A x = b using the factors.
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void
+  solve(RealType* b) const;
+
+ private:
+  RealType lu_[N * N];
+  int      piv_[N];
+};
+
+///
+/// Invoke op.template apply<N>() for the compile-time N equal to the
+/// runtime size n. Returns false if n is not in [1, M].
+///
+template <int M>
+struct FixedSizeDispatch
+{
+  template <typename Op>
+  static bool
+  run(int const n, Op& op)
+  {
+    if (n == M) {
+      op.template apply<M>();
+      return true;
+    }
+    return FixedSizeDispatch<M - 1>::run(n, op);
+  }
+};
+
+template <>
+struct FixedSizeDispatch<0>
+{
+  template <typename Op>
+  static bool
+  run(int const, Op&)
+  {
+    return false;
+  }
+};
+
+///
+/// Newton update X -= A^{-1} B on the values of the arguments using
+/// the fixed-size path. Returns false if the system is too large.
+///
+template <typename ScalarT>
+bool
+solveFixedSize(
+    std::vector<ScalarT> const& A,
+    std::vector<ScalarT>&       X,
+    std::vector<ScalarT> const& B);
+
+///
+/// Implicit function theorem dX/dP = -A^{-1} dB/dP using the
+/// fixed-size path. Returns false if the system is too large.
+///
+template <typename ScalarT>
+bool
+computeFadInfoFixedSize(
+    std::vector<ScalarT> const& A,
+    std::vector<ScalarT>&       X,
+    std::vector<ScalarT> const& B);
+
 ///
 /// Local Nonlinear Solver Base class
 ///
@@ -6,6 +6,187 @@
 
 namespace LCM {
 
+// -----------------------------------------------------------------------------
+// Fixed-size LU, same pivoting and operation order as unblocked LAPACK
+// GETF2/GETRS so results agree with the GESV path to round-off.
+// -----------------------------------------------------------------------------
+template <int N>
+KOKKOS_INLINE_FUNCTION int
+FixedSizeLU<N>::factor(RealType const* A)
+{
+  int info(0);
+
+  for (int k = 0; k < N * N; ++k) lu_[k] = A[k];
+
+  for (int k = 0; k < N; ++k) {
+    // find pivot
+    int      p = k;
+    RealType m = std::abs(lu_[k + N * k]);
+    for (int i = k + 1; i < N; ++i) {
+      RealType const v = std::abs(lu_[i + N * k]);
+      if (v > m) {
+        m = v;
+        p = i;
+      }
+    }
+    piv_[k] = p;
+
+    // swap full rows
+    if (p != k) {
+      for (int j = 0; j < N; ++j) {
+        RealType const t = lu_[k + N * j];
+        lu_[k + N * j]   = lu_[p + N * j];
+        lu_[p + N * j]   = t;
+      }
+    }
+
+    RealType const pivot = lu_[k + N * k];
+    if (pivot != 0.0) {
+      RealType const r = 1.0 / pivot;
+      for (int i = k + 1; i < N; ++i) lu_[i + N * k] *= r;
+    } else if (info == 0) {
+      info = k + 1;
+    }
+
+    // rank-one update of the trailing block
+    for (int j = k + 1; j < N; ++j) {
+      RealType const u = lu_[k + N * j];
+      for (int i = k + 1; i < N; ++i) lu_[i + N * j] -= lu_[i + N * k] * u;
+    }
+  }
+
+  return info;
+}
+
+template <int N>
+KOKKOS_INLINE_FUNCTION void
+FixedSizeLU<N>::solve(RealType* b) const
+{
+  // apply row interchanges
+  for (int k = 0; k < N; ++k) {
+    int const p = piv_[k];
+    if (p != k) {
+      RealType const t = b[k];
+      b[k]             = b[p];
+      b[p]             = t;
+    }
+  }
+
+  // forward substitution with unit lower triangle
+  for (int j = 0; j < N; ++j) {
+    RealType const bj = b[j];
+    if (bj != 0.0) {
+      for (int i = j + 1; i < N; ++i) b[i] -= bj * lu_[i + N * j];
+    }
+  }
+
+  // back substitution with upper triangle
+  for (int j = N - 1; j >= 0; --j) {
+    if (b[j] != 0.0) {
+      b[j] /= lu_[j + N * j];
+      RealType const bj = b[j];
+      for (int i = 0; i < j; ++i) b[i] -= bj * lu_[i + N * j];
+    }
+  }
+}
+
+inline void
+decrementValue(RealType& x, RealType const dx)
+{
+  x -= dx;
+}
+
+template <typename T>
+inline void
+decrementValue(T& x, RealType const dx)
+{
+  x.val() -= dx;
+}
+
+template <typename ScalarT>
+struct FixedSizeSolveOp
+{
+  std::vector<ScalarT> const& A;
+  std::vector<ScalarT>&       X;
+  std::vector<ScalarT> const& B;
+
+  template <int N>
+  void
+  apply()
+  {
+    RealType a[N * N];
+    RealType b[N];
+    for (int k = 0; k < N * N; ++k) {
+      a[k] = Sacado::ScalarValue<ScalarT>::eval(A[k]);
+    }
+    for (int i = 0; i < N; ++i) b[i] = Sacado::ScalarValue<ScalarT>::eval(B[i]);
+
+    FixedSizeLU<N> lu;
+    lu.factor(a);
+    lu.solve(b);
+
+    for (int i = 0; i < N; ++i) decrementValue(X[i], b[i]);
+  }
+};
+
+template <typename ScalarT>
+struct FixedSizeFadInfoOp
+{
+  std::vector<ScalarT> const& A;
+  std::vector<ScalarT>&       X;
+  std::vector<ScalarT> const& B;
+
+  template <int N>
+  void
+  apply()
+  {
+    int const num_global_vars = B[0].size();
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        num_global_vars == 0,
+        std::logic_error,
+        "In LocalNonlinearSolver the numGlobalVars is zero where it should "
+        "be positive\n");
+
+    RealType a[N * N];
+    for (int k = 0; k < N * N; ++k) a[k] = A[k].val();
+
+    FixedSizeLU<N> lu;
+    lu.factor(a);
+
+    for (int i = 0; i < N; ++i) X[i].resize(num_global_vars);
+
+    // one global derivative direction at a time, reusing the factors
+    RealType col[N];
+    for (int j = 0; j < num_global_vars; ++j) {
+      for (int i = 0; i < N; ++i) col[i] = B[i].dx(j);
+      lu.solve(col);
+      for (int i = 0; i < N; ++i) X[i].fastAccessDx(j) = -col[i];
+    }
+  }
+};
+
+template <typename ScalarT>
+bool
+solveFixedSize(
+    std::vector<ScalarT> const& A,
+    std::vector<ScalarT>&       X,
+    std::vector<ScalarT> const& B)
+{
+  FixedSizeSolveOp<ScalarT> op{A, X, B};
+  return FixedSizeDispatch<LOCAL_SOLVER_MAX_FIXED_SIZE>::run(B.size(), op);
+}
+
+template <typename ScalarT>
+bool
+computeFadInfoFixedSize(
+    std::vector<ScalarT> const& A,
+    std::vector<ScalarT>&       X,
+    std::vector<ScalarT> const& B)
+{
+  FixedSizeFadInfoOp<ScalarT> op{A, X, B};
+  return FixedSizeDispatch<LOCAL_SOLVER_MAX_FIXED_SIZE>::run(B.size(), op);
+}
+
 template <typename EvalT, typename Traits>
 LocalNonlinearSolver_Base<EvalT, Traits>::LocalNonlinearSolver_Base() : lapack()
 {
@@ -31,6 +212,9 @@ void inline LocalNonlinearSolver<PHAL::AlbanyTraits::Residual, Traits>::solve(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (solveFixedSize(A, X, B) == true) return;
+
   // system size
   int numLocalVars = B.size();
 
@@ -80,6 +264,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::solve(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (solveFixedSize(A, X, B) == true) return;
+
   // system size
   int numLocalVars = B.size();
 
@@ -119,6 +306,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Jacobian, Traits>::computeFadInfo(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (computeFadInfoFixedSize(A, X, B) == true) return;
+
   // local system size
   int numLocalVars  = B.size();
   int numGlobalVars = B[0].size();
@@ -184,6 +374,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::solve(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (solveFixedSize(A, X, B) == true) return;
+
   // system size
   int numLocalVars = B.size();
 
@@ -223,6 +416,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::Tangent, Traits>::computeFadInfo(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (computeFadInfoFixedSize(A, X, B) == true) return;
+
   // local system size
   int numLocalVars  = B.size();
   int numGlobalVars = B[0].size();
@@ -289,6 +485,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::DistParamDeriv, Traits>::solve(
     std::vector<ScalarT>& X,
     std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (solveFixedSize(A, X, B) == true) return;
+
   // system size
   int numLocalVars = B.size();
 
@@ -329,6 +528,9 @@ LocalNonlinearSolver<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
         std::vector<ScalarT>& X,
         std::vector<ScalarT>& B)
 {
+  // small systems use the fixed-size path
+  if (computeFadInfoFixedSize(A, X, B) == true) return;
+
   // local system size
   int numLocalVars  = B.size();
   int numGlobalVars = B[0].size();
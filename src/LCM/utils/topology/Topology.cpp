@@ -193,6 +193,94 @@ Topology::setBoundaryIndicator()
   }
 }
 
+//
+// Collect the closure of the given cells and their face neighbors.
+// Only these entities can change orphan or boundary status when the
+// cells are removed. In parallel, cells eroded by other processes are
+// removed from this one as well if they are ghosted here, so the faces
+// of ghosted cells and the cells attached to them are collected too.
+//
+void
+Topology::getErosionNeighborhood(
+    stk::mesh::EntityVector const& cells,
+    std::set<stk::mesh::Entity>&   faces,
+    std::set<stk::mesh::Entity>&   segments,
+    std::set<stk::mesh::Entity>&   points,
+    std::set<stk::mesh::Entity>&   neighbors)
+{
+  auto&      bulk_data = get_bulk_data();
+  auto const face_rank = stk::topology::FACE_RANK;
+  auto const edge_rank = stk::topology::EDGE_RANK;
+  auto const node_rank = stk::topology::NODE_RANK;
+
+  auto add_faces = [&](stk::mesh::Entity const cell) {
+    auto const* cell_faces = bulk_data.begin(cell, face_rank);
+    auto const  num_faces  = bulk_data.num_connectivity(cell, face_rank);
+    for (auto i = 0; i < num_faces; ++i) {
+      auto const  face       = cell_faces[i];
+      auto const* face_elems = bulk_data.begin_elements(face);
+      auto const  num_elems  = bulk_data.num_elements(face);
+      faces.emplace(face);
+      for (auto j = 0; j < num_elems; ++j) {
+        if (face_elems[j] != cell) neighbors.emplace(face_elems[j]);
+      }
+    }
+  };
+
+  for (auto cell : cells) {
+    add_faces(cell);
+    auto const* cell_edges = bulk_data.begin(cell, edge_rank);
+    auto const  num_edges  = bulk_data.num_connectivity(cell, edge_rank);
+    for (auto i = 0; i < num_edges; ++i) { segments.emplace(cell_edges[i]); }
+    auto const* cell_nodes = bulk_data.begin(cell, node_rank);
+    auto const  num_nodes  = bulk_data.num_connectivity(cell, node_rank);
+    for (auto i = 0; i < num_nodes; ++i) { points.emplace(cell_nodes[i]); }
+  }
+
+  if (bulk_data.parallel_size() > 1) {
+    auto&                   meta_data = get_meta_data();
+    stk::mesh::Selector     ghosted   = !meta_data.locally_owned_part();
+    stk::mesh::EntityVector ghost_cells;
+    stk::mesh::get_selected_entities(
+        ghosted, bulk_data.buckets(stk::topology::ELEMENT_RANK), ghost_cells);
+    for (auto cell : ghost_cells) { add_faces(cell); }
+  }
+
+  // Cells eroded in the same pass are not neighbors.
+  for (auto cell : cells) { neighbors.erase(cell); }
+}
+
+//
+// Incremental version of createBoundary(), initializeCellFailureState()
+// and setBoundaryIndicator() after erosion. A face is on the boundary
+// if it is locally owned and attached to exactly one cell, which is
+// what skin_mesh would produce for a full mesh representation. The
+// faces and cells must come from getErosionNeighborhood(), which also
+// covers the cells removed by other processes.
+//
+void
+Topology::updateErodedBoundary(
+    std::set<stk::mesh::Entity> const& faces,
+    std::set<stk::mesh::Entity> const& neighbors)
+{
+  auto& bulk_data = get_bulk_data();
+
+  for (auto face : faces) {
+    boundary_.erase(face);
+    if (bulk_data.is_valid(face) == false) continue;
+    bool const is_owned   = bulk_data.bucket(face).owned() == true;
+    bool const is_exposed = bulk_data.num_elements(face) == 1;
+    if (is_owned == true && is_exposed == true) boundary_.emplace(face);
+  }
+
+  for (auto cell : neighbors) {
+    if (bulk_data.is_valid(cell) == false) continue;
+    set_failure_state(cell, INTACT);
+    auto const bi = is_boundary_cell(cell) == true ? EXTERIOR : INTERIOR;
+    set_boundary_indicator(cell, bi);
+  }
+}
+
 //
 //
 //
@@ -1001,8 +1089,6 @@ Topology::splitOpenFaces()
   // 3D only for now.
   assert(get_space_dimension() == stk::topology::ELEMENT_RANK);
 
-  stk::mesh::EntityVector points;
-
   stk::mesh::EntityVector open_points;
 
   stk::mesh::Selector local_bulk = get_local_bulk_selector();
@@ -1011,15 +1097,12 @@ Topology::splitOpenFaces()
 
   stk::mesh::BulkData& bulk_data = get_bulk_data();
 
-  stk::mesh::BucketVector const& point_buckets =
-      bulk_data.buckets(stk::topology::NODE_RANK);
-
-  stk::mesh::get_selected_entities(local_bulk, point_buckets, points);
+  // Collect open points. These are tracked as their failure state is
+  // set, so only the points marked since the last split are visited.
+  for (auto point : open_points_) {
+    if (bulk_data.is_valid(point) == false) continue;
 
-  // Collect open points
-  for (stk::mesh::EntityVector::iterator i = points.begin(); i != points.end();
-       ++i) {
-    stk::mesh::Entity point = *i;
+    if (local_bulk(bulk_data.bucket(point)) == false) continue;
 
     if (get_failure_state(point) == FAILED) { open_points.push_back(point); }
   }
@@ -1326,56 +1409,57 @@ double
 Topology::erodeFailedElements()
 {
   auto const cell_rank     = stk::topology::ELEMENT_RANK;
-  auto const face_rank     = stk::topology::FACE_RANK;
-  auto const edge_rank     = stk::topology::EDGE_RANK;
-  auto const node_rank     = stk::topology::NODE_RANK;
   auto&      bulk_data     = get_bulk_data();
   auto&      meta_data     = get_meta_data();
   auto&      locally_owned = meta_data.locally_owned_part();
   double     eroded_volume = 0.0;
 
   assert(get_space_dimension() == cell_rank);
-  modification_begin();
 
-  // Collect and remove failed cells
+  // Collect failed cells
   auto const&             cell_buckets = bulk_data.buckets(cell_rank);
   stk::mesh::EntityVector cells;
+  stk::mesh::EntityVector failed_cells;
   stk::mesh::get_selected_entities(locally_owned, cell_buckets, cells);
   for (auto cell : cells) {
     if (failure_criterion_->check(bulk_data, cell) == true) {
-      auto cell_volume = getCellVolume(cell);
-      eroded_volume += cell_volume;
-      set_failure_state(cell, INTACT);
-      remove_entity_and_up_relations(cell);
+      failed_cells.emplace_back(cell);
     }
   }
 
-  auto const&             face_buckets = bulk_data.buckets(face_rank);
-  stk::mesh::EntityVector faces;
-  stk::mesh::get_selected_entities(locally_owned, face_buckets, faces);
+  // Only the closure of the failed cells can be orphaned, and only
+  // faces of the failed cells can become exposed.
+  std::set<stk::mesh::Entity> faces;
+  std::set<stk::mesh::Entity> segments;
+  std::set<stk::mesh::Entity> points;
+  std::set<stk::mesh::Entity> neighbors;
+  getErosionNeighborhood(failed_cells, faces, segments, points, neighbors);
+
+  modification_begin();
+  for (auto cell : failed_cells) {
+    auto cell_volume = getCellVolume(cell);
+    eroded_volume += cell_volume;
+    set_failure_state(cell, INTACT);
+    remove_entity_and_up_relations(cell);
+  }
   for (auto face : faces) {
+    if (bulk_data.bucket(face).owned() == false) continue;
     auto const num_elems = bulk_data.num_elements(face);
     if (num_elems == 0) { remove_entity_and_up_relations(face); }
   }
-  auto const&             edge_buckets = bulk_data.buckets(edge_rank);
-  stk::mesh::EntityVector edges;
-  stk::mesh::get_selected_entities(locally_owned, edge_buckets, edges);
-  for (auto edge : edges) {
+  for (auto edge : segments) {
+    if (bulk_data.bucket(edge).owned() == false) continue;
     auto const num_faces = bulk_data.num_faces(edge);
     if (num_faces == 0) { remove_entity_and_up_relations(edge); }
   }
-  auto const&             node_buckets = bulk_data.buckets(node_rank);
-  stk::mesh::EntityVector nodes;
-  stk::mesh::get_selected_entities(locally_owned, node_buckets, nodes);
-  for (auto node : nodes) {
+  for (auto node : points) {
+    if (bulk_data.bucket(node).owned() == false) continue;
     auto const num_edges = bulk_data.num_edges(node);
     if (num_edges == 0) { remove_entity_and_up_relations(node); }
   }
   modification_end();
   Albany::fix_node_sharing(bulk_data);
-  initializeCellFailureState();
-  createBoundary();
-  setBoundaryIndicator();
+  updateErodedBoundary(faces, neighbors);
 
   return eroded_volume;
 }
@@ -1799,6 +1883,7 @@ Topology::set_failure_state_0(stk::mesh::Entity e, FailureState const fs)
   auto const rank                            = bulk_data.entity_rank(e);
   auto&      failure_field                   = get_failure_state_field(rank);
   *(stk::mesh::field_data(failure_field, e)) = static_cast<int>(fs);
+  trackOpenPoint(e, rank, fs);
 }
 
 //
@@ -1813,6 +1898,7 @@ Topology::set_failure_state(stk::mesh::Entity e, FailureState const fs)
   ScalarFieldType&     failure_field =
       *meta_data.get_field<ScalarFieldType>(rank, "Failure Indicator");
   *(stk::mesh::field_data(failure_field, e)) = static_cast<int>(fs);
+  trackOpenPoint(e, rank, fs);
 }
 
 //
@@ -1966,11 +2052,14 @@ Topology::erodeElements()
       failed_cells.emplace_back(cell);
     }
   }
+  std::set<stk::mesh::Entity> faces;
+  std::set<stk::mesh::Entity> segments;
+  std::set<stk::mesh::Entity> points;
+  std::set<stk::mesh::Entity> neighbors;
+  getErosionNeighborhood(failed_cells, faces, segments, points, neighbors);
   execute_entity_deletion_operations(failed_cells);
   Albany::fix_node_sharing(bulk_data);
-  initializeCellFailureState();
-  createBoundary();
-  setBoundaryIndicator();
+  updateErodedBoundary(faces, neighbors);
   return eroded_volume;
 }
 
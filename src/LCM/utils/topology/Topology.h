@@ -610,6 +610,29 @@ class Topology
   void
   setBoundaryIndicator();
 
+  ///
+  /// Collect the faces, segments and points of the given cells,
+  /// together with the cells that share a face with them. In parallel
+  /// this includes the faces of ghosted cells and their neighbors,
+  /// as ghosted cells may be eroded by their owners.
+  ///
+  void
+  getErosionNeighborhood(
+      stk::mesh::EntityVector const& cells,
+      std::set<stk::mesh::Entity>&   faces,
+      std::set<stk::mesh::Entity>&   segments,
+      std::set<stk::mesh::Entity>&   points,
+      std::set<stk::mesh::Entity>&   neighbors);
+
+  ///
+  /// Update boundary set, cell failure state and boundary indicator
+  /// after erosion, restricted to the faces and cells given.
+  ///
+  void
+  updateErodedBoundary(
+      std::set<stk::mesh::Entity> const& faces,
+      std::set<stk::mesh::Entity> const& neighbors);
+
   ///
   ///
   ///
@@ -1005,6 +1028,24 @@ class Topology
   void
   initializeTopologies();
 
+  //
+  // Keep the set of open points in sync with their failure state so
+  // that splitOpenFaces() does not need to scan every point.
+  //
+  void
+  trackOpenPoint(
+      stk::mesh::Entity           e,
+      stk::mesh::EntityRank const rank,
+      FailureState const          fs)
+  {
+    if (rank != stk::topology::NODE_RANK) return;
+    if (fs == FAILED) {
+      open_points_.emplace(e);
+    } else {
+      open_points_.erase(e);
+    }
+  }
+
   //
   //
   Teuchos::RCP<Albany::AbstractDiscretization> discretization_{Teuchos::null};
@@ -1015,6 +1056,7 @@ class Topology
   std::vector<stk::topology>             topologies_;
   std::vector<stk::mesh::EntityId>       highest_ids_;
   std::set<stk::mesh::Entity>            boundary_;
+  std::set<stk::mesh::Entity>            open_points_;
   std::string                            bulk_block_name_{""};
   std::string                            interface_block_name_{""};
   OutputType                             output_type_;
@@ -38,6 +38,7 @@
 #include "Piro_PerformSolve.hpp"
 #include "Albany_OrdinarySTKFieldContainer.hpp"
 #include "Albany_STKDiscretization.hpp"
+#include "Albany_ModelEvaluator.hpp"
 #include "Thyra_DetachedVectorView.hpp"
 #include "Teuchos_YamlParameterListHelpers.hpp"
 
@@ -68,6 +69,17 @@ Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<double> > solver;
 
 bool keptMesh =false;
 
+// If true, as long as the mesh does not change, the application and the solver
+// (with maps, graphs and field managers) are reused across calls.
+bool keepSolverAlive = false;
+std::string aliveSolverType;
+
+// Stk entities of the 3d vertices and of the (elements in) prisms, in the MPAS
+// ordering, and local ids of the velocity dofs. Valid as long as the mesh and
+// the discretization do not change.
+std::vector<stk::mesh::Entity> vertexEntities, prismEntities;
+std::vector<int> velocityLIds;
+
 std::string elemShape;
 
 typedef struct TET_ {
@@ -147,14 +159,39 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
   ScalarFieldType* stiffeningFactorField = meshStruct->metaData->get_field <ScalarFieldType> (stk::topology::NODE_RANK, "stiffening_factor");
   ScalarFieldType* effectivePressureField = meshStruct->metaData->get_field <ScalarFieldType> (stk::topology::NODE_RANK, "effective_pressure");
 
+  if (!keptMesh) {
+    // The mesh was rebuilt: look up its entities once, rather than at every call
+    vertexEntities.resize(numVertices3D);
+    for (int j = 0; j < numVertices3D; ++j) {
+      int ib = (ordering == 0) * (j % lVertexColumnShift)
+              + (ordering == 1) * (j / vertexLayerShift);
+      int il = (ordering == 0) * (j / lVertexColumnShift)
+              + (ordering == 1) * (j % vertexLayerShift);
+      int gId = il * vertexColumnShift + vertexLayerShift * indexToVertexID[ib];
+      vertexEntities[j] = meshStruct->bulkData->get_entity(stk::topology::NODE_RANK, gId + 1);
+    }
+
+    prismEntities.resize(numPrisms * numElemsInPrism);
+    for (int j = 0; j < numPrisms; ++j) {
+      int ib = (ordering == 0) * (j % (lElemColumnShift))
+              + (ordering == 1) * (j / (elemLayerShift));
+      int il = (ordering == 0) * (j / (lElemColumnShift))
+              + (ordering == 1) * (j % (elemLayerShift));
+      int gId = numElemsInPrism * (il * elemColumnShift + elemLayerShift * indexToTriangleID[ib]);
+      int lId = il * lElemColumnShift + elemLayerShift * ib;
+      for (int iElem = 0; iElem < numElemsInPrism; iElem++) {
+        prismEntities[lId * numElemsInPrism + iElem] = meshStruct->bulkData->get_entity(stk::topology::ELEMENT_RANK, ++gId);
+      }
+    }
+  }
+
   bool nonEmptyEffectivePressure = effectivePressureData.size()>0;
   for (int j = 0; j < numVertices3D; ++j) {
     int ib = (ordering == 0) * (j % lVertexColumnShift)
             + (ordering == 1) * (j / vertexLayerShift);
     int il = (ordering == 0) * (j / lVertexColumnShift)
             + (ordering == 1) * (j % vertexLayerShift);
-    int gId = il * vertexColumnShift + vertexLayerShift * indexToVertexID[ib];
-    stk::mesh::Entity node = meshStruct->bulkData->get_entity(stk::topology::NODE_RANK, gId + 1);
+    stk::mesh::Entity node = vertexEntities[j];
     double* coord = stk::mesh::field_data(*meshStruct->getCoordinatesField(), node);
     coord[2] = elevationData[ib] - levelsNormalizedThickness[nLayers - il] * thicknessData[ib];
 
@@ -198,10 +235,9 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
             + (ordering == 1) * (j / (elemLayerShift));
     int il = (ordering == 0) * (j / (lElemColumnShift))
             + (ordering == 1) * (j % (elemLayerShift));
-    int gId = numElemsInPrism * (il * elemColumnShift + elemLayerShift * indexToTriangleID[ib]);
     int lId = il * lElemColumnShift + elemLayerShift * ib;
     for (int iElem = 0; iElem < numElemsInPrism; iElem++) {
-      stk::mesh::Entity elem = meshStruct->bulkData->get_entity(stk::topology::ELEMENT_RANK, ++gId);
+      stk::mesh::Entity elem = prismEntities[lId * numElemsInPrism + iElem];
       double* temperature = stk::mesh::field_data(*temperature_field, elem);
       temperature[0] = temperatureDataOnPrisms[lId];
     }
@@ -221,19 +257,41 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
     }
   }
 
-  if(!keptMesh) {
-    albanyApp->createDiscretization();
-  } else {
+  // The solver must be rebuilt if the mesh changed, or if the homotopy
+  // continuation is over and we switched to a plain NOX solver.
+  const auto& piroList = paramList->sublist("Piro");
+  const std::string solverType = piroList.isParameter("Solver Type") ? piroList.get<std::string>("Solver Type") : "";
+  const bool reuseSolver = keepSolverAlive && keptMesh && Teuchos::nonnull(solver) && solverType == aliveSolverType;
+
+  if (reuseSolver) {
+    // The input fields have been updated in place. We only need to pass the
+    // new coordinates to the preconditioner, and the velocity provided by
+    // MPAS (stored in the solution field) as initial guess.
     auto abs_disc = albanyApp->getDiscretization();
     auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(abs_disc);
-    stk_disc->updateMesh();
+    stk_disc->updateMLCoords();
+
+    auto model = Teuchos::rcp_dynamic_cast<Albany::ModelEvaluator>(slvrfctry->returnModel(), true);
+    auto x_init = Teuchos::rcp_const_cast<Thyra_Vector>(model->getNominalValues().get_x());
+    x_init->assign(*abs_disc->getSolutionField());
+  } else {
+    if(!keptMesh) {
+      albanyApp->createDiscretization();
+    } else {
+      auto abs_disc = albanyApp->getDiscretization();
+      auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(abs_disc);
+      stk_disc->updateMesh();
+    }
+    albanyApp->finalSetUp(paramList);
   }
-  albanyApp->finalSetUp(paramList);
 
   bool success = true;
   Teuchos::ArrayRCP<const ST> solution_constView;
   try {
-    solver = slvrfctry->createAndGetAlbanyApp(albanyApp, mpiComm, mpiComm, Teuchos::null, false);
+    if (!reuseSolver) {
+      solver = slvrfctry->createAndGetAlbanyApp(albanyApp, mpiComm, mpiComm, Teuchos::null, false);
+      aliveSolverType = solverType;
+    }
 
     Teuchos::ParameterList solveParams;
     solveParams.set("Compute Sensitivities", false);
@@ -265,23 +323,22 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
 
   auto overlapVS = albanyApp->getDiscretization()->getOverlapVectorSpace();
 
-  auto indexer = Albany::createGlobalLocalIndexer(overlapVS);
-  for (int j = 0; j < numVertices3D; ++j) {
-    int ib = (ordering == 0) * (j % lVertexColumnShift)
-            + (ordering == 1) * (j / vertexLayerShift);
-    int il = (ordering == 0) * (j / lVertexColumnShift)
-            + (ordering == 1) * (j % vertexLayerShift);
-    int gId = il * vertexColumnShift + vertexLayerShift * indexToVertexID[ib];
-
-    int lId0, lId1;
-
-    if (interleavedOrdering) {
-      lId0 = indexer->getLocalElement(neq * gId);
-      lId1 = lId0 + 1;
-    } else {
-      lId0 = indexer->getLocalElement(gId);
-      lId1 = lId0 + numVertices3D;
+  if (!reuseSolver) {
+    auto indexer = Albany::createGlobalLocalIndexer(overlapVS);
+    velocityLIds.resize(numVertices3D);
+    for (int j = 0; j < numVertices3D; ++j) {
+      int ib = (ordering == 0) * (j % lVertexColumnShift)
+              + (ordering == 1) * (j / vertexLayerShift);
+      int il = (ordering == 0) * (j / lVertexColumnShift)
+              + (ordering == 1) * (j % vertexLayerShift);
+      int gId = il * vertexColumnShift + vertexLayerShift * indexToVertexID[ib];
+      velocityLIds[j] = indexer->getLocalElement(interleavedOrdering ? neq * gId : gId);
     }
+  }
+
+  for (int j = 0; j < numVertices3D; ++j) {
+    int lId0 = velocityLIds[j];
+    int lId1 = interleavedOrdering ? lId0 + 1 : lId0 + numVertices3D;
     velocityOnVertices[j] = solution_constView[lId0];
     velocityOnVertices[j + numVertices3D] = solution_constView[lId1];
   }
@@ -292,11 +349,10 @@ void velocity_solver_solve_fo(int nLayers, int globalVerticesStride,
             + (ordering == 1) * (j / (elemLayerShift));
     int il = (ordering == 0) * (j / (lElemColumnShift))
             + (ordering == 1) * (j % (elemLayerShift));
-    int gId = numElemsInPrism * (il * elemColumnShift + elemLayerShift * indexToTriangleID[ib]);
     int lId = il * lElemColumnShift + elemLayerShift * ib;
     dissipationHeatOnPrisms[lId] = 0;
     for (int iElem = 0; iElem < numElemsInPrism; iElem++) {
-      stk::mesh::Entity elem = meshStruct->bulkData->get_entity(stk::topology::ELEMENT_RANK, ++gId);
+      stk::mesh::Entity elem = prismEntities[lId * numElemsInPrism + iElem];
       double* dissipationHeat = stk::mesh::field_data(*dissipationHeatField, elem);
       dissipationHeatOnPrisms[lId] += dissipationHeat[0]/numElemsInPrism;
     }
@@ -330,6 +386,9 @@ void velocity_solver_finalize() {
   MPAS_dt = Teuchos::null;
   solver = Teuchos::null;
   mpiComm = Teuchos::null;
+  vertexEntities.clear();
+  prismEntities.clear();
+  velocityLIds.clear();
 
   // Print Teuchos timers into file
   std::ostream* os = &std::cout;
@@ -430,6 +489,13 @@ void velocity_solver_extrude_3d_grid(int nLayers, int globalTrianglesStride,
 
   paramList->set("Overwrite Nominal Values With Final Point", true);
 
+  // Memoized fields would not see the new input fields if the solver is reused
+  keepSolverAlive = paramList->sublist("Problem").get("Keep Solver Alive", false);
+  if (keepSolverAlive && paramList->sublist("Problem").get("Use MDField Memoization", false)) {
+    std::cout<<"\nWARNING: 'Keep Solver Alive' cannot be used with 'Use MDField Memoization'. The solver will be rebuilt at every call.\n"<<std::endl;
+    keepSolverAlive = false;
+  }
+
   Teuchos::Array<std::string> arrayRequiredFields(9);
   arrayRequiredFields[0]="temperature";  arrayRequiredFields[1]="ice_thickness"; arrayRequiredFields[2]="surface_height"; arrayRequiredFields[3]="bed_topography";
   arrayRequiredFields[4]="basal_friction";  arrayRequiredFields[5]="surface_mass_balance"; arrayRequiredFields[6]="dirichlet_field", arrayRequiredFields[7]="stiffening_factor", arrayRequiredFields[8]="effective_pressure";
@@ -119,6 +119,9 @@ struct Workset
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::WorksetConn                           wsElNodeEqID;
+  // With element activation, the cells of the workset that are assembled
+  // (nonzero entry). Empty if all of them are.
+  Kokkos::View<const int*, PHX::Device>         activeCells;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO>>      wsElNodeID;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>> wsCoords;
   Teuchos::ArrayRCP<double>                     wsSphereVolume;
@@ -71,6 +71,27 @@ namespace TDM {
 	//Create an object that will import and contain an array of the laser path data
     Laser Laser_object;
 
+    // The source is taken as zero at points farther than the cutoff radius
+    // from the laser center. The cutoff is a multiple of the beam radius.
+    RealType cutoff_factor_;
+
+    // Bounding box in the x-y plane of a set of quadrature points
+    struct BoundingBox
+    {
+      RealType lo[2];
+      RealType hi[2];
+    };
+
+    // Boxes of each workset and of each of its cells, built on first use
+    std::vector<BoundingBox> workset_boxes_;
+    std::vector<std::vector<BoundingBox>> cell_boxes_;
+
+    void
+    buildBoundingBoxes(typename Traits::EvalData workset);
+
+    bool
+    intersects(BoundingBox const& box, RealType x, RealType y, RealType r) const;
+
     // variable use to decide if subtractive is true or false
     bool Subtractive_;
 
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 #include <fstream>
+#include <limits>
 #include "Sacado_ParameterRegistration.hpp"
 #include "Albany_Utils.hpp"
 
@@ -68,6 +69,17 @@ Laser_Source(Teuchos::ParameterList& p,
 
   initial_porosity = porosity_list->get("Value", 1.0);
 
+  // The Gaussian beam profile exp(-2 r^2 / R^2) drops below the given
+  // tolerance beyond r = R sqrt(-log(tol) / 2). By default keep the
+  // historical cutoff at twice the beam radius.
+  cutoff_factor_ = 2.0;
+  if (cond_list->isParameter("Laser Source Cutoff Tolerance")) {
+    RealType const tol = cond_list->get<double>("Laser Source Cutoff Tolerance");
+    TEUCHOS_TEST_FOR_EXCEPTION(tol <= 0.0 || tol >= 1.0, std::logic_error,
+        "Laser Source Cutoff Tolerance must be in (0, 1)\n");
+    cutoff_factor_ = std::sqrt(-0.5 * std::log(tol));
+  }
+
   //sim_type = input_list->get<std::string>("Simulation Type");
   
   //Import the laser path data from the specified file
@@ -94,6 +106,56 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(laser_source_,fm);
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void Laser_Source<EvalT, Traits>::
+buildBoundingBoxes(typename Traits::EvalData workset)
+{
+  std::size_t const ws = workset.wsIndex;
+  if (ws >= workset_boxes_.size()) {
+    workset_boxes_.resize(ws + 1);
+    cell_boxes_.resize(ws + 1);
+  }
+
+  // The mesh does not move, so the boxes are built only once per workset.
+  std::vector<BoundingBox>& cell_boxes = cell_boxes_[ws];
+  if (cell_boxes.size() == workset.numCells) return;
+
+  RealType const big = std::numeric_limits<RealType>::max();
+  BoundingBox& ws_box = workset_boxes_[ws];
+  ws_box.lo[0] = ws_box.lo[1] = big;
+  ws_box.hi[0] = ws_box.hi[1] = -big;
+
+  cell_boxes.resize(workset.numCells);
+  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+    BoundingBox& box = cell_boxes[cell];
+    box.lo[0] = box.lo[1] = big;
+    box.hi[0] = box.hi[1] = -big;
+    for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+      for (int i = 0; i < 2; ++i) {
+        RealType const x = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,i));
+        box.lo[i] = std::min(box.lo[i], x);
+        box.hi[i] = std::max(box.hi[i], x);
+      }
+    }
+    for (int i = 0; i < 2; ++i) {
+      ws_box.lo[i] = std::min(ws_box.lo[i], box.lo[i]);
+      ws_box.hi[i] = std::max(ws_box.hi[i], box.hi[i]);
+    }
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool Laser_Source<EvalT, Traits>::
+intersects(BoundingBox const& box, RealType x, RealType y, RealType r) const
+{
+  // Distance from (x,y) to the closest point of the box
+  RealType const dx = std::max(0.0, std::max(box.lo[0] - x, x - box.hi[0]));
+  RealType const dy = std::max(0.0, std::max(box.lo[1] - y, y - box.hi[1]));
+  return dx * dx + dy * dy < r * r;
+}
+
 //**********************************************************************
 template<typename EvalT, typename Traits>
 void Laser_Source<EvalT, Traits>::
@@ -118,6 +180,22 @@ evaluateFields(typename Traits::EvalData workset)
   ScalarT Laser_center_x = x;
   ScalarT Laser_center_y = y;
   ScalarT Laser_power = power * average_laser_power;
+
+  // Skip the worksets and cells that lie entirely outside the cutoff
+  // radius around the laser center, where the source vanishes.
+  RealType const cutoff_radius =
+    cutoff_factor_ * Sacado::ScalarValue<ScalarT>::eval(laser_beam_radius);
+  ScalarT const cutoff = cutoff_radius;
+
+  buildBoundingBoxes(workset);
+  std::vector<BoundingBox> const& cell_boxes = cell_boxes_[workset.wsIndex];
+
+  if (!intersects(workset_boxes_[workset.wsIndex], x, y, cutoff_radius)) {
+    for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+      for (std::size_t qp = 0; qp < num_qps_; ++qp)
+        laser_source_(cell,qp) = 0.0;
+    return;
+  }
   
   ScalarT pi = 3.1415926535897932;
   //std::cout << " laser information  "<< Laser_center_x << "," << Laser_center_y << ","<<average_laser_power<<","<<power<< "\n" ; 
@@ -165,6 +243,10 @@ evaluateFields(typename Traits::EvalData workset)
   ScalarT beta_d = absortivity;
   //-----------------------------------------------------------------------------------------------
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+    if (!intersects(cell_boxes[cell], x, y, cutoff_radius)) {
+      for (std::size_t qp = 0; qp < num_qps_; ++qp) laser_source_(cell,qp) = 0.0;
+      continue;
+    }
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
     MeshScalarT X = coord_(cell,qp,0);
     MeshScalarT Y = coord_(cell,qp,1);
@@ -172,7 +254,7 @@ evaluateFields(typename Traits::EvalData workset)
 
     ScalarT radius = sqrt(((X - Laser_center_x)*(X - Laser_center_x)) + ((Y - Laser_center_y)*(Y - Laser_center_y)));
       // std::cout << "laser source has calculated radius is "<< radius <<"\n" ; 
-      if (radius < (2*laser_beam_radius)){
+      if (radius < cutoff){
       ScalarT Q =(2.0*Laser_power/(pi*laser_beam_radius*laser_beam_radius))*exp(-2*radius*radius/(laser_beam_radius*laser_beam_radius));  // horizontal aenergy distribution
       //Dense Material Power Input
       ScalarT g_d = (1.0 - reflectivity); //fraction of energy absorbed
@@ -202,6 +284,10 @@ evaluateFields(typename Traits::EvalData workset)
 
      beta_d = absortivity;
      for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+       if (!intersects(cell_boxes[cell], x, y, cutoff_radius)) {
+         for (std::size_t qp = 0; qp < num_qps_; ++qp) laser_source_(cell,qp) = 0.0;
+         continue;
+       }
        for (std::size_t qp = 0; qp < num_qps_; ++qp) {
 	 MeshScalarT X = coord_(cell,qp,0);
 	 MeshScalarT Y = coord_(cell,qp,1);
@@ -211,7 +297,7 @@ evaluateFields(typename Traits::EvalData workset)
 	 ScalarT radius = sqrt(((X - Laser_center_x)*(X - Laser_center_x)) + ((Y - Laser_center_y)*(Y - Laser_center_y)));
 
 	 if( Z>=0 ){  
-	   if (radius < (2*laser_beam_radius)){
+	   if (radius < cutoff){
 	     ScalarT Q =(2.0*Laser_power/(pi*laser_beam_radius*laser_beam_radius))*exp(-2*radius*radius/(laser_beam_radius*laser_beam_radius));  // horizontal aenergy distribution
 	     //Dense Material Power Input
 	     ScalarT g_d = (1.0 - reflectivity); //fraction of energy absorbed
@@ -257,6 +343,7 @@ getValidLaser_SourceParameters() const
   valid_pl->set<double>("Powder Diameter", 1.0);
   valid_pl->set<std::string>("Powder Layer Thickness Type", "Constant");
   valid_pl->set<double>("Powder Layer Thickness", 1.0);
+  valid_pl->set<double>("Laser Source Cutoff Tolerance", std::exp(-8.0));
 
   return valid_pl;
 }
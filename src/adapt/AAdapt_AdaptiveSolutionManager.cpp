@@ -329,7 +329,17 @@ AdaptiveSolutionManager::resizeMeshDataArrays(
   // IKT, 1/20/15: the following is needed to ensure Laplace matrix is
   // non-diagonal for Aeras problems that have hyperviscosity and are integrated
   // using an explicit time integration scheme.
-  overlapped_jac = disc->createImplicitOverlapJacobianOp();
+  // With "Matrix-Free Hyperviscosity" the Laplacian is never assembled, so the
+  // (diagonal, for explicit schemes) Jacobian graph is enough.
+  Teuchos::ParameterList& problemParams = appParams_->sublist("Problem");
+  const bool matrixFreeHV =
+      problemParams.isSublist("Hydrostatic Problem") &&
+      problemParams.sublist("Hydrostatic Problem")
+          .get<bool>("Matrix-Free Hyperviscosity", false);
+  if (matrixFreeHV)
+    overlapped_jac = disc->createOverlapJacobianOp();
+  else
+    overlapped_jac = disc->createImplicitOverlapJacobianOp();
 #else
   overlapped_jac = disc->createOverlapJacobianOp();
 #endif
@@ -224,6 +224,8 @@ void MeshAdapt::beforeAdapt()
   TEUCHOS_FUNC_TIME_MONITOR("AlbanyAdapt: Transfer to APF Mesh");
   if (should_transfer_ip_data)
     pumi_discretization->attachQPData();
+  else // drop the qp fields kept on the mesh for output
+    pumi_discretization->detachQPData();
   szField->preProcessOriginalMesh();
 }
 
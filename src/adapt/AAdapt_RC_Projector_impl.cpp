@@ -10,6 +10,7 @@
 #include <BelosBlockCGSolMgr.hpp>
 #include <BelosThyraAdapter.hpp>
 
+#include "Albany_ThyraUtils.hpp"
 #include "Albany_TpetraThyraUtils.hpp"
 #include <BelosTpetraAdapter.hpp>
 #include <Ifpack2_RILUK.hpp>
@@ -41,6 +42,9 @@ solve (const Teuchos::RCP<const Thyra_LinearOp>& A,
       {
         pl_.set<int>("fact: iluk level-of-fill", 0);
         Teuchos::RCP< Ifpack2::RILUK<Tpetra_RowMatrix> > prec;
+        TEUCHOS_TEST_FOR_EXCEPTION(Albany::getBlockSize(A)>1, std::logic_error,
+            "Error! The reference configuration projector needs a Tpetra_CrsMatrix, "
+            "which is incompatible with 'Point Block Jacobian'.\n");
         Teuchos::RCP<const Tpetra_CrsMatrix> tA = Albany::getConstTpetraMatrix(A);
         prec = Teuchos::rcp(new Ifpack2::RILUK<Tpetra_RowMatrix>(tA));
         prec->setParameters(pl_);
@@ -21,6 +21,8 @@
 
 #include <apfMesh.h>
 #include <apfShape.h>
+#include <apfField.h>
+#include <apfFieldData.h>
 #include <PCU.h>
 
 #include <string>
@@ -369,7 +371,7 @@ void APFDiscretization::writeAnySolutionToFile(const double time_value)
   copyNodalDataToAPF(false);
   copyQPStatesToAPF(fs,false);
   meshOutput->writeFile(time_label);
-  removeQPStatesFromAPF();
+  removeQPStatesFromAPF(true);
   removeNodalDataFromAPF();
 
   if ((continuationStep == meshStruct->restartWriteStep) &&
@@ -393,7 +395,7 @@ void APFDiscretization::writeRestartFile(const double time)
   std::ostringstream oss;
   oss << "restart_" << time << "_.smb";
   m->writeNative(oss.str().c_str());
-  removeQPStatesFromAPF();
+  removeQPStatesFromAPF(true);
   removeNodalDataFromAPF();
 }
 
@@ -402,7 +404,7 @@ void APFDiscretization::writeMeshDebug (const std::string& filename) {
                                         meshStruct->cubatureDegree);
   copyQPStatesToAPF(fs, true);
   apf::writeVtkFiles(filename.c_str(), meshStruct->getMesh());
-  removeQPStatesFromAPF();
+  removeQPStatesFromAPF(true);
 }
 
 double APFDiscretization::monotonicTimeLabel(const double time)
@@ -1141,19 +1143,100 @@ void APFDiscretization::computeSideSets()
   m->end(it);
 }
 
-void APFDiscretization::
-copyQPScalarToAPF(unsigned nqp,
-                  const std::string& stateName,
-                  apf::Field* f)
+namespace {
+
+// APF stores 1, 3 or 9 components per qp for scalar, vector and matrix fields,
+// while Albany stores 1, spdim and spdim^2. The state arrays are row-major, so
+// the qp data of an element is contiguous in both, and can be moved with one
+// call to FieldDataOf::set/get (the per-qp apf::setScalar & co. read and write
+// the whole element data at each call). We only need to (un)pack when spdim<3.
+void transferQPState (apf::Field* f,
+                      const std::vector<std::vector<apf::MeshEntity*>>& buckets,
+                      StateArrayVec& elemStateArrays,
+                      const std::string& stateName,
+                      const unsigned nqp,
+                      const unsigned rank,
+                      const unsigned spdim,
+                      const bool toAPF)
 {
+  const unsigned apf_ncomp = rank==0 ? 1 : (rank==1 ? 3 : 9);
+  const unsigned alb_ncomp = rank==0 ? 1 : (rank==1 ? spdim : spdim*spdim);
+  const unsigned apf_dim   = rank==0 ? 1 : 3;
+  const unsigned alb_dim   = rank==0 ? 1 : spdim;
+  const bool same_layout = apf_ncomp==alb_ncomp;
+
+  auto data = static_cast<apf::FieldDataOf<double>*>(f->getData());
+  std::vector<double> buf(same_layout ? 0 : nqp*apf_ncomp, 0.0);
+
   for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
+    const std::vector<apf::MeshEntity*>& buck = buckets[b];
+    if (buck.size()==0) {
+      continue;
+    }
+    MDArray& ar = elemStateArrays[b][stateName];
+    double* ar_data = ar.contiguous_data();
     for (std::size_t e=0; e < buck.size(); ++e) {
+      double* elem_data = ar_data + e*nqp*alb_ncomp;
+      if (same_layout) {
+        if (toAPF) {
+          data->set(buck[e],elem_data);
+        } else {
+          data->get(buck[e],elem_data);
+        }
+        continue;
+      }
+
+      if (!toAPF) {
+        data->get(buck[e],buf.data());
+      }
       for (std::size_t p=0; p < nqp; ++p) {
-        apf::setScalar(f,buck[e],p,ar(e,p));
-    }}
+        const unsigned nrows = rank==2 ? alb_dim : 1;
+        for (std::size_t i=0; i < nrows; ++i) {
+          double* apf_row = buf.data() + p*apf_ncomp + i*apf_dim;
+          double* alb_row = elem_data + p*alb_ncomp + i*alb_dim;
+          for (std::size_t j=0; j < alb_dim; ++j) {
+            if (toAPF) {
+              apf_row[j] = alb_row[j];
+            } else {
+              alb_row[j] = apf_row[j];
+            }
+          }
+        }
+      }
+      if (toAPF) {
+        data->set(buck[e],buf.data());
+      }
+    }
+  }
+}
+
+// Get the field for a qp state, reusing the one left on the mesh by a
+// previous call, unless it was created with a different shape or type.
+apf::Field* getQPStateField (apf::Mesh2* m,
+                             const std::string& name,
+                             const int valueType,
+                             apf::FieldShape* fs)
+{
+  apf::Field* f = m->findField(name.c_str());
+  if (f!=nullptr && (apf::getShape(f)!=fs || apf::getValueType(f)!=valueType)) {
+    apf::destroyField(f);
+    f = nullptr;
   }
+  if (f==nullptr) {
+    f = apf::createField(m,name.c_str(),valueType,fs);
+  }
+  return f;
+}
+
+} // anonymous namespace
+
+void APFDiscretization::
+copyQPScalarToAPF(unsigned nqp,
+                  const std::string& stateName,
+                  apf::Field* f)
+{
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,0,meshStruct->problemDim,true);
 }
 
 void APFDiscretization::
@@ -1161,20 +1244,8 @@ copyQPVectorToAPF(unsigned nqp,
                   const std::string& stateName,
                   apf::Field* f)
 {
-  const unsigned spdim = meshStruct->problemDim;
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i) {
-          v[i] = ar(e,p,i);
-        }
-        apf::setVector(f,buck[e],p,v);
-      }
-    }
-  }
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,1,meshStruct->problemDim,true);
 }
 
 void APFDiscretization::
@@ -1182,21 +1253,8 @@ copyQPTensorToAPF(unsigned nqp,
                   const std::string& stateName,
                   apf::Field* f)
 {
-  const unsigned spdim = meshStruct->problemDim;
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i) {
-          for (std::size_t j=0; j < spdim; ++j) {
-            v[i][j] = ar(e,p,i,j);
-        }}
-        apf::setMatrix(f,buck[e],p,v);
-      }
-    }
-  }
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,2,meshStruct->problemDim,true);
 }
 
 void APFDiscretization::
@@ -1210,7 +1268,7 @@ copyQPStatesToAPF(apf::FieldShape* fs,
       continue;
     }
     int nqp = state.dims[1];
-    auto f = apf::createField(m,state.name.c_str(),apf::SCALAR,fs);
+    auto f = getQPStateField(m,state.name,apf::SCALAR,fs);
     copyQPScalarToAPF(nqp, state.name, f);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
@@ -1219,7 +1277,7 @@ copyQPStatesToAPF(apf::FieldShape* fs,
       continue;
     }
     int nqp = state.dims[1];
-    auto f = apf::createField(m,state.name.c_str(),apf::VECTOR,fs);
+    auto f = getQPStateField(m,state.name,apf::VECTOR,fs);
     copyQPVectorToAPF(nqp, state.name, f);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
@@ -1228,7 +1286,7 @@ copyQPStatesToAPF(apf::FieldShape* fs,
       continue;
     }
     int nqp = state.dims[1];
-    auto f = apf::createField(m,state.name.c_str(),apf::MATRIX,fs);
+    auto f = getQPStateField(m,state.name,apf::MATRIX,fs);
     copyQPTensorToAPF(nqp, state.name, f);
   }
   if (meshStruct->saveStabilizedStress) {
@@ -1236,20 +1294,26 @@ copyQPStatesToAPF(apf::FieldShape* fs,
   }
 }
 
-void APFDiscretization::removeQPStatesFromAPF()
+void APFDiscretization::removeQPStatesFromAPF(bool keepOutput)
 {
   apf::Mesh2* m = meshStruct->getMesh();
+  auto remove = [&](const std::string& name, const bool output) {
+    apf::Field* f = m->findField(name.c_str());
+    if (f!=nullptr && !(keepOutput && output)) {
+      apf::destroyField(f);
+    }
+  };
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    remove(state.name,state.output);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    remove(state.name,state.output);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    remove(state.name,state.output);
   }
 }
 
@@ -1258,13 +1322,8 @@ copyQPScalarFromAPF(unsigned nqp,
                     const std::string& stateName,
                     apf::Field* f)
 {
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p = 0; p < nqp; ++p) {
-        ar(e,p) = apf::getScalar(f,buck[e],p);
-  }}}
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,0,meshStruct->problemDim,false);
 }
 
 void APFDiscretization::
@@ -1272,17 +1331,8 @@ copyQPVectorFromAPF(unsigned nqp,
                     const std::string& stateName,
                     apf::Field* f)
 {
-  const unsigned spdim = meshStruct->problemDim;
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getVector(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i) {
-          ar(e,p,i) = v[i];
-  }}}}
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,1,meshStruct->problemDim,false);
 }
 
 void APFDiscretization::
@@ -1290,18 +1340,8 @@ copyQPTensorFromAPF(unsigned nqp,
                     const std::string& stateName,
                     apf::Field* f)
 {
-  const unsigned spdim = meshStruct->problemDim;
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b = 0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getMatrix(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i) {
-          for (std::size_t j=0; j < spdim; ++j) {
-            ar(e,p,i,j) = v[i][j];
-  }}}}}
+  transferQPState(f,buckets,stateArrays.elemStateArrays,stateName,
+                  nqp,2,meshStruct->problemDim,false);
 }
 
 void APFDiscretization::copyQPStatesFromAPF()
@@ -1525,6 +1565,9 @@ void APFDiscretization::initTemperatureHack()
   if (!meshStruct->useTemperatureHack) {
     return;
   }
+  // Do not pick up (stale) output fields, and let temperaturesToQP create
+  // its own Temperature fields
+  removeQPStatesFromAPF();
   apf::Mesh* m = meshStruct->getMesh();
   temperaturesToQP(m, meshStruct->cubatureDegree);
   copyQPStatesFromAPF();
@@ -388,12 +388,15 @@ private:
 
 public:
 
-  //! Transfer PUMIQPData to APF
+  //! Transfer PUMIQPData to APF. Fields left on the mesh by a previous call
+  //! are reused if they have the same shape, so output does not recreate them.
   void copyQPScalarToAPF(unsigned nqp, std::string const& state, apf::Field* f);
   void copyQPVectorToAPF(unsigned nqp, std::string const& state, apf::Field* f);
   void copyQPTensorToAPF(unsigned nqp, std::string const& state, apf::Field* f);
   void copyQPStatesToAPF(apf::FieldShape* fs, bool copyAll = true);
-  void removeQPStatesFromAPF();
+  //! Destroy the qp fields. If keepOutput=true, the fields of output states are
+  //! kept on the mesh, to be reused at the next output.
+  void removeQPStatesFromAPF(bool keepOutput = false);
 
   //! Transfer QP Fields from APF to PUMIQPData
   void copyQPScalarFromAPF(unsigned nqp, std::string const& stateName, apf::Field* f);
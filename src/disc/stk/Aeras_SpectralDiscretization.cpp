@@ -1849,8 +1849,27 @@ void Aeras::SpectralDiscretization::computeGraphs()
 #ifdef OUTPUT_TO_SCREEN
   *out << "DEBUG: " << __PRETTY_FUNCTION__ << std::endl;
 #endif
-  computeGraphsUpToFillComplete();
-  fillCompleteGraphs();
+  //For implicit scheme, the Jacobian graph is the full element graph, and the
+  //implicit graph factories alias it.  For explicit scheme, the implicit graph
+  //is only needed to assemble the hyperviscosity Laplace operator, and is built
+  //on demand in computeImplicitGraphs().
+  if (explicit_scheme == false) {
+    m_overlap_jac_factory = computeOverlapElementGraph();
+    m_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_vs, m_vs, m_overlap_jac_factory) );
+    m_implicit_overlap_jac_factory = m_overlap_jac_factory;
+    m_implicit_jac_factory = m_jac_factory;
+  } else {
+    m_implicit_overlap_jac_factory = Teuchos::null;
+    m_implicit_jac_factory = Teuchos::null;
+  }
+}
+
+void Aeras::SpectralDiscretization::computeImplicitGraphs() const
+{
+  if (m_implicit_jac_factory != Teuchos::null) return;
+
+  m_implicit_overlap_jac_factory = computeOverlapElementGraph();
+  m_implicit_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_vs, m_vs, m_implicit_overlap_jac_factory) );
 }
 
 void Aeras::SpectralDiscretization::computeGraphs_Explicit()
@@ -1917,7 +1936,8 @@ void Aeras::SpectralDiscretization::computeGraphsExplicitUpToFillComplete()
   }
 }
 
-void Aeras::SpectralDiscretization::computeGraphsUpToFillComplete()
+Teuchos::RCP<Albany::ThyraCrsMatrixFactory>
+Aeras::SpectralDiscretization::computeOverlapElementGraph() const
 {
 #ifdef OUTPUT_TO_SCREEN
   *out << "DEBUG: " << __PRETTY_FUNCTION__ << std::endl;
@@ -1926,12 +1946,9 @@ void Aeras::SpectralDiscretization::computeGraphsUpToFillComplete()
   *out << "nodes_per_element: " << nodes_per_element << std::endl;
 #endif
 
-  //Create implicit overlap jac factory and populate  
-  m_implicit_overlap_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_overlap_vs,m_overlap_vs,neq*nodes_per_element) );
-  //For implicit scheme, m_overlap_jac_factory = m_implicit_overlap_jac_factory
-  if (explicit_scheme == false) {
-    m_overlap_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_overlap_vs,m_overlap_vs,neq*nodes_per_element) );
-  }
+  //Create overlap jac factory and populate
+  Teuchos::RCP<Albany::ThyraCrsMatrixFactory> overlap_jac_factory =
+    Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_overlap_vs,m_overlap_vs,neq*nodes_per_element) );
 #ifdef OUTPUT_TO_SCREEN
   *out << "neq*nodes_per_element: " << neq*nodes_per_element << std::endl;
 #endif
@@ -1949,9 +1966,8 @@ void Aeras::SpectralDiscretization::computeGraphsUpToFillComplete()
          << std::endl;
 
   GO row, col;
-  Teuchos::ArrayView<GO> colAV;
 
-  //Populate the graphs
+  //Populate the graph
   for (int b = 0; b < numBuckets; ++b)
   {
     stk::mesh::Bucket & buck = *buckets[b];
@@ -1972,71 +1988,18 @@ void Aeras::SpectralDiscretization::computeGraphsUpToFillComplete()
             for (std::size_t m=0; m < neq; m++)
             {
               col = getGlobalDOF(colNode, m);
-              m_implicit_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col,1));
-              m_implicit_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col,1));
+              overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col,1));
               //IKT, FIXME?  The following line might be needed 
-              //m_implicit_overlap_jac_factory->insertGlobalIndices(col, Teuchos::arrayView(&row,1));
-            }
-          }
-        }
-      }
-    }
-  }
-  //For implicit scheme, m_overlap_jac_factory = m_implicit_overlap_jac_factory 
-  if (explicit_scheme == false) {
-    for (int b = 0; b < numBuckets; ++b)
-    {
-      stk::mesh::Bucket & buck = *buckets[b];
-      // i is the element index within bucket b
-      for (std::size_t i = 0; i < buck.size(); ++i)
-      {
-        Teuchos::ArrayRCP< GO > node_rels = wsElNodeID[b][i];
-        for (int j = 0; j < nodes_per_element; ++j)
-        {
-          const GO rowNode = node_rels[j];
-          // loop over eqs
-          for (std::size_t k=0; k < neq; k++)
-          {
-            row = getGlobalDOF(rowNode, k);
-            for (int l=0; l < nodes_per_element; l++)
-            {
-              const GO colNode = node_rels[l];
-              for (std::size_t m=0; m < neq; m++)
-              {
-                col = getGlobalDOF(colNode, m);
-                m_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col,1));
-                m_overlap_jac_factory->insertGlobalIndices(row, Teuchos::arrayView(&col,1));
-                //IKT, FIXME?  The following line might be needed 
-                //m_overlap_jac_factory->insertGlobalIndices(col, Teuchos::arrayView(&row,1));
-              }
+              //overlap_jac_factory->insertGlobalIndices(col, Teuchos::arrayView(&row,1));
             }
           }
         }
       }
     }
   }
-}
-
-
-void Aeras::SpectralDiscretization::fillCompleteGraphs()
-{
-#ifdef OUTPUT_TO_SCREEN
-  *out << "DEBUG: " << __PRETTY_FUNCTION__ << std::endl;
-#endif
-
-  //fill complete m_implicit_overlap_jac_factory
-  m_implicit_overlap_jac_factory->fillComplete();
-  //For implicit scheme, m_overlap_jac_factory = m_implicit_overlap_jac_factory 
-  if (explicit_scheme == false) {
-    m_overlap_jac_factory->fillComplete();
-  }
 
-  //create m_implicit_jac_factory (owned) 
-  m_implicit_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_vs, m_vs, m_implicit_overlap_jac_factory) );
-  //For implicit scheme, m_jac_factory = m_implicit_jac_factory 
-  if (explicit_scheme == false) {
-    m_jac_factory = Teuchos::rcp( new Albany::ThyraCrsMatrixFactory(m_vs, m_vs, m_overlap_jac_factory) );
-  }
+  overlap_jac_factory->fillComplete();
+  return overlap_jac_factory;
 }
 
 void Aeras::SpectralDiscretization::fillCompleteGraphsExplicit()
@@ -3313,17 +3276,17 @@ Aeras::SpectralDiscretization::updateMesh()
   // Right now, computeGraphs_Explicit() will not work with shallow water; therefore
   // only call this function for hydrostatic (numLevels > 0)
 
-  //computeGraphs populates m_implicit_graph_factory and m_implicit_overlap_graph_factory
-  //for an explicit scheme; for an implicit scheme, it also populates m_graph_factory and m_overlap_graph_factory.
-  //For an explicit scheme, these the implicit graph factories are needed to populate correctly the Laplace 
-  //operator, needed for hyperviscosity
+  //computeGraphs populates m_graph_factory and m_overlap_graph_factory for an
+  //implicit scheme, and the implicit graph factories alias them. For an explicit
+  //scheme the implicit graph factories, needed to populate correctly the Laplace
+  //operator for hyperviscosity, are built on first use.
   computeGraphs(); 
   //computeGraphs_Explicit will populate m_graph_factory and m_overlap_graph_factory
   //for an explicit scheme, which will have graphs of diagonal matrices. 
   computeGraphs_Explicit(); 
 
 #ifdef WRITE_TO_MATRIX_MARKET_TO_MM_FILE
-  Albany::writeMatrixMarket(m_implicit_jac_factory->createOp(), "ImplicitOp.mm"); 
+  Albany::writeMatrixMarket(createImplicitJacobianOp(), "ImplicitOp.mm"); 
   Albany::writeMatrixMarket(m_jac_factory->createOp(), "Op.mm"); 
   Albany::writeMatrixMarket(m_overlap_jac_factory->createOp(), "OverlapOp.mm"); 
 #endif
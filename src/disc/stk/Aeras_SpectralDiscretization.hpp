@@ -226,9 +226,10 @@ namespace Aeras
     Teuchos::RCP<Thyra_LinearOp> createJacobianOp        () const override {return m_jac_factory->createOp(); }
     Teuchos::RCP<Thyra_LinearOp> createOverlapJacobianOp () const override { return m_overlap_jac_factory->createOp(); }
 
-    //! Create implicit Jacobian operator (owned and overlapped) (for Aeras)
-    Teuchos::RCP<Thyra_LinearOp> createImplicitJacobianOp        () const { return m_implicit_jac_factory->createOp();         }
-    Teuchos::RCP<Thyra_LinearOp> createImplicitOverlapJacobianOp () const { return m_implicit_overlap_jac_factory->createOp(); }
+    //! Create implicit Jacobian operator (owned and overlapped) (for Aeras).
+    //! For explicit schemes the full element graph is only built on first use.
+    Teuchos::RCP<Thyra_LinearOp> createImplicitJacobianOp        () const { computeImplicitGraphs(); return m_implicit_jac_factory->createOp();         }
+    Teuchos::RCP<Thyra_LinearOp> createImplicitOverlapJacobianOp () const { computeImplicitGraphs(); return m_implicit_overlap_jac_factory->createOp(); }
 
     //! Get Node set lists (typedef in Albany_AbstractDiscretization.hpp)
     const Albany::NodeSetList& getNodeSets() const override { return nodeSets; };
@@ -618,9 +619,10 @@ namespace Aeras
     Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_jac_factory;
     Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_overlap_jac_factory;
     
-    //! Implicit Jacobian matrix graph proxy (owned, overlap)
-    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_implicit_jac_factory;
-    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_implicit_overlap_jac_factory;
+    //! Implicit Jacobian matrix graph proxy (owned, overlap); same as the
+    //! Jacobian graph for implicit schemes, built lazily for explicit ones
+    mutable Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_implicit_jac_factory;
+    mutable Teuchos::RCP<Albany::ThyraCrsMatrixFactory> m_implicit_overlap_jac_factory;
 
     //! Processor ID
     unsigned int myPID;
@@ -724,9 +726,9 @@ namespace Aeras
 
   private:
   
-    void computeGraphsUpToFillComplete();
+    Teuchos::RCP<Albany::ThyraCrsMatrixFactory> computeOverlapElementGraph() const;
+    void computeImplicitGraphs() const;
     void computeGraphsExplicitUpToFillComplete();
-    void fillCompleteGraphs();
     void fillCompleteGraphsExplicit();
 
   };
@@ -933,6 +933,15 @@ STKDiscretization::setupMLCoords()
     for (int j = 0; j < numDim; j++) { coordMV_data[j][node_lid] = X[j]; }
   }
 
+  // For extruded meshes, let the preconditioner know about the vertical columns
+  const auto layeredMeshNumbering = stkMeshStruct->layered_mesh_numbering;
+  if (!layeredMeshNumbering.is_null()) {
+    const bool contiguousColumns =
+        layeredMeshNumbering->ordering == LayeredMeshOrdering::COLUMN &&
+        interleavedOrdering && sideSetEquations.empty();
+    rigidBodyModes->setLayeredMeshInfo(layeredMeshNumbering->numLevels, contiguousColumns);
+  }
+
   rigidBodyModes->setCoordinatesAndNullspace(coordMV, m_vs, m_overlap_vs);
 
   // Some optional matrix-market output was tagged on here; keep that
@@ -1744,8 +1753,30 @@ STKDiscretization::computeGraphsUpToFillComplete()
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map,
   // coordinates, graphs
 
+  // Optionally store the Jacobian as a point-block matrix, with one dense
+  // neq x neq block per node pair. This needs interleaved dofs, and all
+  // equations defined on the whole mesh. The device-side Jacobian scatter
+  // of ALBANY_KOKKOS_UNDER_DEVELOPMENT only fills CrsMatrix storage.
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  bool const device_scatter = true;
+#else
+  bool const device_scatter = false;
+#endif
+  int block_size = 1;
+  if (discParams->get<bool>("Point Block Jacobian", false)) {
+    if (neq > 1 && interleavedOrdering && sideSetEquations.empty() &&
+        Albany::build_type() == Albany::BuildType::Tpetra && !device_scatter) {
+      block_size = neq;
+    } else if (comm->getRank() == 0) {
+      *out << "Warning! 'Point Block Jacobian' requires Tpetra, more than one "
+              "equation, interleaved ordering, no side set equations and a "
+              "build without ALBANY_KOKKOS_UNDER_DEVELOPMENT. "
+              "Using a point Jacobian instead.\n";
+    }
+  }
+
   m_overlap_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(
-      m_overlap_vs, m_overlap_vs, neq * nodes_per_element));
+      m_overlap_vs, m_overlap_vs, neq * nodes_per_element, block_size));
 
   stk::mesh::Selector select_owned_in_part =
       stk::mesh::Selector(metaData.universal_part()) &
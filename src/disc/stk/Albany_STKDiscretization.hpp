@@ -396,6 +396,14 @@ class STKDiscretization : public AbstractDiscretization
   void
   updateMesh();
 
+  //! After the nodes moved (without changing the mesh connectivity), pass the
+  //! new coordinates to the preconditioner
+  void
+  updateMLCoords()
+  {
+    setupMLCoords();
+  }
+
   //! Function that transforms an STK mesh of a unit cube (for LandIce problems)
   void
   transformMesh();
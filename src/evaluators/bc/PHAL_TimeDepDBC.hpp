@@ -7,7 +7,7 @@
 #ifndef PHAL_TIMEDEPBC_HPP
 #define PHAL_TIMEDEPBC_HPP
 
-#include <vector>
+#include "Albany_TimeTable.hpp"
 #include "PHAL_Dirichlet.hpp"
 
 namespace PHAL {
@@ -26,9 +26,8 @@ class TimeDepDBC_Base : public PHAL::Dirichlet<EvalT, Traits>
   computeVal(RealType time);
 
  protected:
-  const int             offset;
-  std::vector<RealType> timeValues;
-  std::vector<RealType> BCValues;
+  const int         offset;
+  Albany::TimeTable timeTable;
 };
 
 template <typename EvalT, typename Traits>
@@ -13,38 +13,28 @@ template <typename EvalT, typename Traits>
 TimeDepDBC_Base<EvalT, Traits>::TimeDepDBC_Base(Teuchos::ParameterList& p)
     : offset(p.get<int>("Equation Offset")), PHAL::Dirichlet<EvalT, Traits>(p)
 {
-  timeValues = p.get<Teuchos::Array<RealType>>("Time Values").toVector();
-  BCValues   = p.get<Teuchos::Array<RealType>>("BC Values").toVector();
+  const auto timeValues =
+      p.get<Teuchos::Array<RealType>>("Time Values").toVector();
+  const auto BCValues = p.get<Teuchos::Array<RealType>>("BC Values").toVector();
 
   TEUCHOS_TEST_FOR_EXCEPTION(
       !(timeValues.size() == BCValues.size()),
       Teuchos::Exceptions::InvalidParameter,
       "Dimension of \"Time Values\" and \"BC Values\" do not match");
+
+  timeTable = Albany::TimeTable(
+      timeValues,
+      BCValues,
+      1,
+      Albany::TimeTable::interpolationFromString(
+          p.get<std::string>("Time Interpolation", "Linear")));
 }
 
 template <typename EvalT, typename Traits>
 typename TimeDepDBC_Base<EvalT, Traits>::ScalarT
 TimeDepDBC_Base<EvalT, Traits>::computeVal(RealType time)
 {
-  TEUCHOS_TEST_FOR_EXCEPTION(
-      time > timeValues.back(),
-      Teuchos::Exceptions::InvalidParameter,
-      "Time is growing unbounded!");
-
-  ScalarT      val;
-  RealType     slope;
-  unsigned int index(0);
-
-  while (timeValues[index] < time) index++;
-
-  if (index == 0)
-    val = BCValues[index];
-  else {
-    slope =
-        ((BCValues[index] - BCValues[index - 1]) /
-         (timeValues[index] - timeValues[index - 1]));
-    val = BCValues[index - 1] + slope * (time - timeValues[index - 1]);
-  }
+  ScalarT val = timeTable.evaluate(time);
 
   return val;
 }
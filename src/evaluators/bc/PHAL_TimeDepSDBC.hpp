@@ -7,8 +7,7 @@
 #if !defined(PHAL_TimeDepSDBC_hpp)
 #define PHAL_TimeDepSDBC_hpp
 
-#include <vector>
-
+#include "Albany_TimeTable.hpp"
 #include "PHAL_SDirichlet.hpp"
 
 namespace PHAL {
@@ -31,9 +30,7 @@ class TimeDepSDBC_Base : public PHAL::SDirichlet<EvalT, Traits>
  protected:
   int const offset_;
 
-  std::vector<RealType> times_;
-
-  std::vector<RealType> values_;
+  Albany::TimeTable table_;
 };
 
 template <typename EvalT, typename Traits>
@@ -21,12 +21,19 @@ template <typename EvalT, typename Traits>
 TimeDepSDBC_Base<EvalT, Traits>::TimeDepSDBC_Base(Teuchos::ParameterList& p)
     : offset_(p.get<int>("Equation Offset")), PHAL::SDirichlet<EvalT, Traits>(p)
 {
-  times_  = p.get<Teuchos::Array<RealType>>("Time Values").toVector();
-  values_ = p.get<Teuchos::Array<RealType>>("BC Values").toVector();
+  auto const times  = p.get<Teuchos::Array<RealType>>("Time Values").toVector();
+  auto const values = p.get<Teuchos::Array<RealType>>("BC Values").toVector();
 
   ALBANY_ASSERT(
-      times_.size() == values_.size(),
+      times.size() == values.size(),
       "Number of times and number of values must match");
+
+  table_ = Albany::TimeTable(
+      times,
+      values,
+      1,
+      Albany::TimeTable::interpolationFromString(
+          p.get<std::string>("Time Interpolation", "Linear")));
 }
 
 //
@@ -36,20 +43,7 @@ template <typename EvalT, typename Traits>
 typename TimeDepSDBC_Base<EvalT, Traits>::ScalarT
 TimeDepSDBC_Base<EvalT, Traits>::computeVal(RealType time)
 {
-  ScalarT value{0.0};
-
-  size_t index{0};
-
-  while (times_[index] < time) index++;
-
-  if (index == 0) {
-    value = values_[index];
-  } else {
-    RealType const slope = (values_[index] - values_[index - 1]) /
-                           (times_[index] - times_[index - 1]);
-
-    value = values_[index - 1] + slope * (time - times_[index - 1]);
-  }
+  ScalarT value = table_.evaluate(time);
 
   return value;
 }
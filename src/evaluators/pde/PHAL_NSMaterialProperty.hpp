@@ -8,6 +8,7 @@
 #define PHAL_NSMATERIAL_PROPERTY_HPP
 
 #include "Albany_config.h"
+#include "Albany_TimeTable.hpp"
 
 #include "Phalanx_config.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
@@ -89,8 +90,7 @@ private:
   Teuchos::Array<MeshScalarT> point;
 
   // Time Dependent value
-  std::vector< RealType > timeValues;
-  std::vector< RealType > depValues;
+  Albany::TimeTable timeTable;
 
 };
 }
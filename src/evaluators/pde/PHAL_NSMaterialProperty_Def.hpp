@@ -166,13 +166,17 @@ NSMaterialProperty(Teuchos::ParameterList& p) :
   }
   else if (type == "Time Dependent") {
     matPropType = TIME_DEP_SCALAR;
-    timeValues = mp_list->get<Teuchos::Array<RealType>>("Time Values").toVector();
-    depValues = mp_list->get<Teuchos::Array<RealType>>("Dependent Values").toVector();
+    const auto timeValues = mp_list->get<Teuchos::Array<RealType>>("Time Values").toVector();
+    const auto depValues = mp_list->get<Teuchos::Array<RealType>>("Dependent Values").toVector();
 
     TEUCHOS_TEST_FOR_EXCEPTION( !(timeValues.size() == depValues.size()),
                               Teuchos::Exceptions::InvalidParameter,
                               "Dimension of \"Time Values\" and \"Dependent Values\" do not match" );
 
+    const std::string interp = mp_list->get<std::string>("Time Interpolation","Linear");
+    timeTable = Albany::TimeTable(timeValues, depValues, 1,
+                                  Albany::TimeTable::interpolationFromString(interp));
+
       // Add property as a Sacado-ized parameter
     this->registerSacadoParameter(name_mp, paramLib);
   }
@@ -261,24 +265,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
   else if (matPropType == TIME_DEP_SCALAR) {
 
-    RealType time = workset.current_time;
-    TEUCHOS_TEST_FOR_EXCEPTION(
-       time > timeValues.back(), Teuchos::Exceptions::InvalidParameter,
-      "Time is growing unbounded!" );
-
-    RealType slope;
-    unsigned int index(0);
-
-    while (timeValues[index] < time)
-      index++;
-
-    if (index == 0)
-      scalar_constant_value = depValues[index];
-    else {
-      slope = ((depValues[index] - depValues[index - 1]) /
-             (timeValues[index] - timeValues[index - 1]));
-      scalar_constant_value = depValues[index-1] + slope * (time - timeValues[index - 1]);
-    }
+    scalar_constant_value = timeTable.evaluate(workset.current_time);
 
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < dims[1]; ++qp) {
@@ -62,6 +62,14 @@ protected:
 
   unsigned short int tensorRank;
 
+  // Cells not yet activated (see Albany::ElementActivation) are not assembled
+  Kokkos::View<const int*, PHX::Device> activeCells;
+
+  KOKKOS_INLINE_FUNCTION
+  bool isCellActive (const int cell) const {
+    return activeCells.extent(0)==0 || activeCells(cell)!=0;
+  }
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 protected:
   Albany::WorksetConn nodeID;
@@ -127,6 +127,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Residual,Traits>::
 operator() (const PHAL_ScatterResRank0_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell,node,this->offset + eq);
@@ -139,6 +140,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Residual,Traits>::
 operator() (const PHAL_ScatterResRank1_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell,node,this->offset + eq);
@@ -151,6 +153,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Residual,Traits>::
 operator() (const PHAL_ScatterResRank2_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
@@ -165,6 +168,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  this->activeCells = workset.activeCells;
+
   Teuchos::RCP<Thyra_Vector> f = workset.f;
 
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
@@ -175,12 +180,14 @@ evaluateFields(typename Traits::EvalData workset)
 
   if (this->tensorRank == 0) {
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t eq = 0; eq < numFields; eq++)
           f_nonconstView[nodeID(cell,node,this->offset + eq)] += (this->val[eq])(cell,node);
     }
   } else if (this->tensorRank == 1) {
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t eq = 0; eq < numFields; eq++)
           f_nonconstView[nodeID(cell,node,this->offset + eq)] += (this->valVec)(cell,node,eq);
@@ -188,6 +195,7 @@ evaluateFields(typename Traits::EvalData workset)
   } else if (this->tensorRank == 2) {
     int numDims = this->valTensor.extent(2);
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       for (std::size_t node = 0; node < this->numNodes; ++node)
         for (std::size_t i = 0; i < numDims; i++)
           for (std::size_t j = 0; j < numDims; j++)
@@ -251,6 +259,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterResRank0_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell,node,this->offset + eq);
@@ -263,6 +272,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -296,6 +306,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank0_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -328,6 +339,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterResRank1_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++) {
     for (std::size_t eq = 0; eq < numFields; eq++) {
       const LO id = nodeID(cell,node,this->offset + eq);
@@ -341,6 +353,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -375,6 +388,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank1_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -408,6 +422,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterResRank2_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   for (std::size_t node = 0; node < this->numNodes; node++)
     for (std::size_t i = 0; i < numDims; i++)
       for (std::size_t j = 0; j < numDims; j++) {
@@ -421,6 +436,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -455,6 +471,7 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const
 {
+  if (!this->isCellActive(cell)) return;
   //const int neq = nodeID.extent(2);
   //const int nunk = neq*this->numNodes;
   // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
@@ -489,6 +506,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  this->activeCells = workset.activeCells;
+
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   Teuchos::RCP<Thyra_Vector>   f   = workset.f;
   Teuchos::RCP<Thyra_LinearOp> Jac = workset.Jac;
@@ -508,13 +527,52 @@ evaluateFields(typename Traits::EvalData workset)
     f_nonconstView = Albany::getNonconstLocalData(f);
   }
 
+  // With point-block storage, if this evaluator scatters all the equations,
+  // sum whole neq x neq blocks (one per element node) at once.
+  const bool blockScatter = !workset.is_adjoint && this->offset==0 && numFields==neq &&
+                            neq>1 && Albany::getBlockSize(Jac)==neq;
+  Teuchos::Array<LO> blockCol;
+  Teuchos::Array<ST> blockVals;
+  if (blockScatter) {
+    blockCol.resize(this->numNodes);
+    blockVals.resize(nunk*neq);
+  }
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    if (!this->isCellActive(cell)) continue;
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
       for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
         col[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
       }
     }
+    if (blockScatter) {
+      // Interleaved ordering: local dof = local node * neq + eq
+      for (unsigned int node_col=0; node_col<this->numNodes; node_col++) {
+        blockCol[node_col] = col[neq * node_col] / neq;
+      }
+      for (std::size_t node = 0; node < this->numNodes; ++node) {
+        for (std::size_t eq = 0; eq < numFields; eq++) {
+          typename PHAL::Ref<ScalarT const>::type
+            valptr = (this->tensorRank == 0 ? this->val[eq](cell,node) :
+                      this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+                      this->valTensor(cell,node, eq/numDims, eq%numDims));
+          if (loadResid) {
+            f_nonconstView[nodeID(cell,node,eq)] += valptr.val();
+          }
+          // Row eq of each (row-major) block
+          const bool hasDx = valptr.hasFastAccess();
+          for (unsigned int node_col=0; node_col<this->numNodes; node_col++) {
+            for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
+              blockVals[(node_col*neq + eq)*neq + eq_col] =
+                hasDx ? valptr.fastAccessDx(neq * node_col + eq_col) : 0.0;
+            }
+          }
+        }
+        Albany::addToLocalBlockRowValues(Jac, nodeID(cell,node,0) / neq, blockCol(), blockVals());
+      }
+      continue;
+    }
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT const>::type
@@ -636,6 +694,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  this->activeCells = workset.activeCells;
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_Vector> f = workset.f;
   Teuchos::RCP<Thyra_MultiVector> JV = workset.JV;
@@ -660,6 +720,7 @@ evaluateFields(typename Traits::EvalData workset)
   if (this->tensorRank == 2) numDims = this->valTensor.extent(2);
 
   for (std::size_t cell = 0; cell < workset.numCells; ++cell ) {
+    if (!this->isCellActive(cell)) continue;
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
         typename PHAL::Ref<ScalarT const>::type valref = (
@@ -705,6 +766,8 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  this->activeCells = workset.activeCells;
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> fpV = workset.fpV;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST>> fpV_nonconst2dView = Albany::getNonconstLocalData(fpV);
@@ -720,6 +783,7 @@ evaluateFields(typename Traits::EvalData workset)
     const int neq = nodeID.extent(2);
     const Albany::IDArray&  wsElDofs = workset.distParamLib->get(workset.dist_param_deriv_name)->workset_elem_dofs()[workset.wsIndex];
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = this->numNodes;//local_Vp.size()/numFields;
@@ -744,6 +808,7 @@ evaluateFields(typename Traits::EvalData workset)
     }
   } else {
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size();
@@ -773,6 +838,8 @@ template<typename Traits>
 void ScatterResidualWithExtrudedParams<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  this->activeCells = workset.activeCells;
+
   if(workset.local_Vp[0].size() == 0) { return; } //In case the parameter has not been gathered, e.g. parameter is used only in Dirichlet conditions.
 
   auto level_it = extruded_params_levels->find(workset.dist_param_deriv_name);
@@ -800,6 +867,7 @@ evaluateFields(typename Traits::EvalData workset)
     auto node_indexer = Albany::createGlobalLocalIndexer(overlapNodeVS);
     auto indexer = Albany::createGlobalLocalIndexer(overlapVS);
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[cell];
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
@@ -831,6 +899,7 @@ evaluateFields(typename Traits::EvalData workset)
     }
   } else {
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      if (!this->isCellActive(cell)) continue;
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size();
@@ -14,6 +14,7 @@
 #include "Sacado_ParameterRegistration.hpp"
 #include "Teuchos_VerboseObject.hpp"
 #include "Albany_Utils.hpp"
+#include "Albany_TimeTable.hpp"
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_KL_ExponentialRandomField.hpp"
 #endif
@@ -149,9 +150,7 @@ private :
   std::size_t m_num_qp;
   Teuchos::ParameterList* m_source_list;
   PHX::MDField<ScalarT,Cell,Point> m_source;
-  std::vector<double> time;
-  std::vector<double> sourceval;
-  int num_time_vals;
+  Albany::TimeTable m_table;
 };
 
 template<typename EvalT,typename Traits>
@@ -182,8 +181,9 @@ Table(Teuchos::ParameterList& p) {
              std::istreambuf_iterator<char>(), '\n');
 
   // Allocate and fill arrays
-  time.resize(array_size);
-  sourceval.resize(array_size);
+  std::vector<double> time(array_size);
+  std::vector<double> sourceval(array_size);
+  int num_time_vals;
 
   // rewind file
   inFile.seekg(0);
@@ -201,6 +201,12 @@ Table(Teuchos::ParameterList& p) {
 
   inFile.close();
 
+  time.resize(num_time_vals);
+  sourceval.resize(num_time_vals);
+  m_table = Albany::TimeTable(time, sourceval, 1,
+                              Albany::TimeTable::interpolationFromString(
+                                paramList.get<std::string>("Time Interpolation", "Linear")));
+
   m_constant = sourceval[0];
 
   // Add the factor as a Sacado-ized parameter
@@ -243,30 +249,18 @@ evaluateFields(typename Traits::EvalData workset){
 
   if(workset.current_time <= 0.0) // if time is uninitialized or zero, just take first value
 
-    m_constant = sourceval[0];
+    m_constant = m_table.evaluate(m_table.firstTime());
 
   else { // Interpolate between time values
 
-    bool found_it = false;
-
-    for(int i = 0; i < num_time_vals - 1; i++) // Stride through time
-
-      if(workset.current_time >= time[i] && workset.current_time <= time[i + 1] ){ // Have bracketed current time
-
-        double s = (workset.current_time - time[i]) / (time[i + 1] - time[i]); // 0 \leq s \leq 1
-
-        m_constant = sourceval[i] + s * (sourceval[i + 1] - sourceval[i]); // interp value corresponding to s
-
-        found_it = true;
-
-        break;
-
-      }
-
-    TEUCHOS_TEST_FOR_EXCEPTION(!found_it, Teuchos::Exceptions::InvalidParameter, std::endl <<
+    TEUCHOS_TEST_FOR_EXCEPTION(workset.current_time < m_table.firstTime() ||
+                               workset.current_time > m_table.lastTime(),
+                     Teuchos::Exceptions::InvalidParameter, std::endl <<
 		     "Error! Cannot locate the current time \"" << workset.current_time 
-		     << "\" in the time series data between the endpoints " << time[0]
-          << " and " << time[num_time_vals - 1] << "." << std::endl);
+		     << "\" in the time series data between the endpoints " << m_table.firstTime()
+          << " and " << m_table.lastTime() << "." << std::endl);
+
+    m_constant = m_table.evaluate(workset.current_time);
   }
 
   // Loop over cells, quad points: compute Table Source Term
@@ -150,6 +150,7 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->sublist("Neumann BCs", false, "");
   validPL->sublist("Adaptation", false, "");
   validPL->sublist("Catalyst", false, "");
+  validPL->sublist("Element Activation", false, "Layer-wise element birth schedule");
   validPL->set<bool>("Solve Adjoint", false, "");
   validPL->set<bool>("Overwrite Nominal Values With Final Point",false,
                      "Whether 'reportFinalPoint' should be allowed to overwrite nominal values");
@@ -159,6 +160,8 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->set<bool>("Use MDField Memoization For Parameters", false, "Use memoization to avoid recomputing MDFields dependent on parameters");
   validPL->set<bool>("Ignore Residual In Jacobian", false,
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
+  validPL->set<bool>("Save States In Residual Fill", false,
+                     "Save states during the residual fill and skip the separate state sweep after a converged step");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
 
@@ -170,6 +173,7 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   // Candidates for deprecation. Pertain to the solution rather than the problem definition.
   validPL->set<std::string>("Solution Method", "Steady", "Flag for Steady, Transient, or Continuation");
   validPL->set<double>("Homotopy Restart Step", 1., "Flag for LandIce Homotopy Restart Step");
+  validPL->set<bool>("Keep Solver Alive", false, "Flag for reusing the LandIce application and solver across MPAS calls if the mesh did not change");
   validPL->set<std::string>("Second Order", "No", "Flag to indicate that a transient problem has two time derivs");
   validPL->set<bool>("Print Response Expansion", true, "");
 
@@ -516,6 +516,9 @@ Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList(
         }
 
         p->set<bool>("Mesh Deforms", sub_list.get<bool>("Mesh Deforms", false));
+        p->set<string>(
+            "Time Interpolation",
+            sub_list.get<string>("Time Interpolation", "Linear"));
         p->set<RCP<DataLayout>>("Data Layout", dummy);
         p->set<string>("Dirichlet Name", ss);
         p->set<RealType>("Dirichlet Value", 0.0);
@@ -592,6 +595,9 @@ Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList(
         }
 
         p->set<bool>("Mesh Deforms", sub_list.get<bool>("Mesh Deforms", false));
+        p->set<string>(
+            "Time Interpolation",
+            sub_list.get<string>("Time Interpolation", "Linear"));
         p->set<RCP<DataLayout>>("Data Layout", dummy);
         p->set<string>("Dirichlet Name", ss);
         p->set<RealType>("Dirichlet Value", 0.0);
@@ -910,6 +916,9 @@ Albany::BCUtils<Albany::DirichletTraits>::buildEvaluatorsList(
             "KI Values", sub_list.get<Teuchos::Array<RealType>>("KI Values"));
         p->set<Teuchos::Array<RealType>>(
             "KII Values", sub_list.get<Teuchos::Array<RealType>>("KII Values"));
+        p->set<string>(
+            "Time Interpolation",
+            sub_list.get<string>("Time Interpolation", "Linear"));
 
         // Extract BC parameters
         p->set<string>("Kfield KI Name", "Kfield KI");
@@ -1252,6 +1261,8 @@ Albany::BCUtils<Albany::NeumannTraits>::buildEvaluatorsList(
 
           p->set<Teuchos::TwoDArray<RealType>>("BC Values", bcvals); 
 
+          p->set<string>("Time Interpolation", sub_list.get<string>("Time Interpolation", "Linear"));
+
           p->set<RCP<ParamLib>>("Parameter Library", paramLib);
 
           p->set<string>("Side Set ID", meshSpecs->ssNames[i]);
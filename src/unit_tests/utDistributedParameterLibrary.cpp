@@ -0,0 +1,146 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_DistributedParameterLibrary.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_Utils.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+using Param = Albany::DistributedParameter;
+
+// Each rank owns size consecutive ids and also sees the first id of the
+// next rank, so the scatter moves data between ranks when there are any.
+RCP<Param>
+createParameter(
+    std::string const&             name,
+    int const                      size,
+    RCP<Teuchos_Comm const> const& comm)
+{
+  int const rank      = comm->getRank();
+  int const num_ranks = comm->getSize();
+
+  Teuchos::Array<GO> owned_gids;
+  for (int i = 0; i < size; ++i) { owned_gids.push_back(rank * size + i); }
+
+  Teuchos::Array<GO> overlapped_gids = owned_gids;
+  if (rank + 1 < num_ranks) { overlapped_gids.push_back((rank + 1) * size); }
+
+  return rcp(new Param(
+      name,
+      Albany::createVectorSpace(comm, owned_gids()),
+      Albany::createVectorSpace(comm, overlapped_gids())));
+}
+
+// Whether every local entry of the overlapped vector equals value
+bool
+overlappedEquals(Param const& param, ST const value)
+{
+  auto const data = Albany::getLocalData(param.overlapped_vector().getConst());
+  for (int i = 0; i < data.size(); ++i) {
+    if (data[i] != value) return false;
+  }
+  return true;
+}
+
+// Put a marker in the overlapped vectors. It survives a library scatter
+// only for the parameters that were not scattered again.
+void
+markOverlapped(Albany::DistributedParameterLibrary const& library)
+{
+  for (auto const& it : library) {
+    it.second->overlapped_vector()->assign(-1.0);
+  }
+}
+
+TEUCHOS_UNIT_TEST(DistributedParameterLibrary, ScatterOnlyChanged)
+{
+  Albany::build_type(Albany::BuildType::Tpetra);
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+
+  // a and b share their vector spaces and are imported together, c is
+  // imported on its own.
+  auto const a = createParameter("a", 4, comm);
+  auto const b =
+      rcp(new Param("b", a->vector_space(), a->overlap_vector_space()));
+  auto const c = createParameter("c", 3, comm);
+
+  Albany::DistributedParameterLibrary library;
+  library.add("a", a);
+  library.add("b", b);
+  library.add("c", c);
+
+  a->vector()->assign(1.0);
+  b->vector()->assign(2.0);
+  c->vector()->assign(3.0);
+
+  // Nothing has been scattered yet
+  TEST_ASSERT(library.needs_scatter());
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, 1.0));
+  TEST_ASSERT(overlappedEquals(*b, 2.0));
+  TEST_ASSERT(overlappedEquals(*c, 3.0));
+  TEST_ASSERT(!library.needs_scatter());
+
+  // Unchanged parameters are not scattered again
+  markOverlapped(library);
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, -1.0));
+  TEST_ASSERT(overlappedEquals(*b, -1.0));
+  TEST_ASSERT(overlappedEquals(*c, -1.0));
+
+  // Only the changed member of the group is scattered
+  a->vector()->assign(5.0);
+  TEST_ASSERT(library.needs_scatter());
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, 5.0));
+  TEST_ASSERT(overlappedEquals(*b, -1.0));
+  TEST_ASSERT(overlappedEquals(*c, -1.0));
+  TEST_ASSERT(!library.needs_scatter());
+
+  // Both members of the group changed
+  markOverlapped(library);
+  a->vector()->assign(6.0);
+  b->vector()->assign(7.0);
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, 6.0));
+  TEST_ASSERT(overlappedEquals(*b, 7.0));
+  TEST_ASSERT(overlappedEquals(*c, -1.0));
+
+  // A change on a single rank is scattered on all ranks
+  markOverlapped(library);
+  if (comm->getRank() == 0) {
+    auto data = Albany::getNonconstLocalData(c->vector());
+    data[0]   = 8.0;
+  }
+  TEST_ASSERT(library.needs_scatter());
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, -1.0));
+  TEST_ASSERT(overlappedEquals(*b, -1.0));
+  TEST_ASSERT(!overlappedEquals(*c, -1.0));
+
+  // Writing the same values again is not a change
+  markOverlapped(library);
+  b->vector()->assign(7.0);
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*b, -1.0));
+
+  // An invalidated parameter is scattered even if unchanged
+  b->invalidate();
+  TEST_ASSERT(library.needs_scatter());
+  library.scatter();
+  TEST_ASSERT(overlappedEquals(*a, -1.0));
+  TEST_ASSERT(overlappedEquals(*b, 7.0));
+  TEST_ASSERT(overlappedEquals(*c, -1.0));
+}
+
+}  // namespace
@@ -0,0 +1,139 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <algorithm>
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_VerboseObject.hpp>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_ElementActivation.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_StateInfoStruct.hpp"
+#include "Albany_TmplSTKMeshStruct.hpp"
+#include "Albany_Utils.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+// A 2x2x4 hex mesh of the unit cube, built in layers of 0.25 along z.
+RCP<Albany::AbstractDiscretization>
+createLayeredCube(RCP<Teuchos_Comm const> const& comm)
+{
+  auto params = rcp(new Teuchos::ParameterList("Discretization"));
+  params->set<std::string>("Method", "STK3D");
+  params->set<int>("1D Elements", 2);
+  params->set<int>("2D Elements", 2);
+  params->set<int>("3D Elements", 4);
+  params->set<int>("Workset Size", 3);
+  params->set<int>("Number Of Time Derivatives", 0);
+
+  int const num_eqs = 1;
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  RCP<Albany::AbstractSTKMeshStruct> mesh_struct =
+      rcp(new Albany::TmplSTKMeshStruct<3>(params, Teuchos::null, comm));
+  mesh_struct->setFieldAndBulkData(
+      comm,
+      params,
+      num_eqs,
+      req,
+      rcp(new Albany::StateInfoStruct()),
+      mesh_struct->getMeshSpecs()[0]->worksetSize);
+
+  auto disc = rcp(new Albany::STKDiscretization(params, mesh_struct, comm));
+  disc->updateMesh();
+  return disc;
+}
+
+TEUCHOS_UNIT_TEST(ElementActivation, DepositionSchedule)
+{
+  Albany::build_type(Albany::BuildType::Tpetra);
+  Teuchos::GlobalMPISession mpi_session(void);
+  RCP<Teuchos_Comm const>   comm =
+      Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  auto const disc = createLayeredCube(comm);
+
+  // The first layer of elements is the substrate, the other three are
+  // deposited at times 1, 2 and 3.
+  Teuchos::ParameterList params("Element Activation");
+  params.set<int>("Build Direction", 2);
+  params.set<double>("Initial Height", 0.25);
+  params.set<double>("Layer Thickness", 0.25);
+  params.set<Teuchos::Array<double>>(
+      "Layer Times",
+      Teuchos::Array<double>(Teuchos::tuple<double>(1.0, 2.0, 3.0)));
+
+  Albany::ElementActivation activation(
+      params, disc, Teuchos::VerboseObjectBase::getDefaultOStream());
+
+  auto const& coords       = disc->getCoords();
+  auto const& wsElNodeEqID = disc->getWsElNodeEqID();
+  int const   num_ws       = wsElNodeEqID.size();
+
+  int const num_nodes_per_layer = 3 * 3;
+  int const num_cells_per_layer = 2 * 2;
+  int const num_dofs            = 5 * num_nodes_per_layer;
+
+  double const times[]  = {0.0, 0.5, 1.0, 2.5, 3.0, 10.0};
+  int const    layers[] = {1, 1, 2, 3, 4, 4};
+  for (int i = 0; i < 6; ++i) {
+    double const time       = times[i];
+    int const    num_layers = layers[i];
+    double const height     = 0.25 * num_layers;
+
+    bool const changed = activation.update(time);
+    TEST_EQUALITY(changed, i == 0 || layers[i] != layers[i - 1]);
+    TEST_FLOATING_EQUALITY(activation.depositedHeight(time), height, 1.0e-14);
+
+    // Active worksets, and the cell mask each of them gets
+    int num_active_ws = 0;
+    for (int ws = 0; ws < num_ws; ++ws) {
+      int const num_cells  = wsElNodeEqID[ws].extent(0);
+      int const num_nodes  = wsElNodeEqID[ws].extent(1);
+      int       num_active = 0;
+      auto const active_cells = activation.activeCells(ws);
+      Kokkos::View<
+          int*,
+          typename decltype(active_cells)::array_layout,
+          Kokkos::HostSpace>
+          mask("mask", active_cells.extent(0));
+      Kokkos::deep_copy(mask, active_cells);
+      for (int cell = 0; cell < num_cells; ++cell) {
+        double z_min = coords[ws][cell][0][2];
+        for (int node = 1; node < num_nodes; ++node) {
+          z_min = std::min(z_min, coords[ws][cell][node][2]);
+        }
+        bool const deposited = z_min < height - 1.0e-8;
+        if (deposited == true) ++num_active;
+        if (mask.extent(0) > 0) TEST_EQUALITY(mask(cell) != 0, deposited);
+      }
+      TEST_EQUALITY(activation.isWorksetActive(ws), num_active > 0);
+      TEST_EQUALITY(mask.extent(0) == 0, num_active == num_cells);
+      if (num_active > 0) ++num_active_ws;
+    }
+    TEST_EQUALITY(activation.numActiveWorksets(), num_active_ws);
+
+    // Global cell and DOF counts
+    int local_counts[2] = {activation.numActiveCells(),
+                           activation.numInactiveDofs()};
+    int global_counts[2];
+    Teuchos::reduceAll(
+        *comm, Teuchos::REDUCE_SUM, 2, local_counts, global_counts);
+    TEST_EQUALITY(global_counts[0], num_layers * num_cells_per_layer);
+    TEST_EQUALITY(
+        global_counts[1], num_dofs - (num_layers + 1) * num_nodes_per_layer);
+  }
+}
+
+}  // namespace
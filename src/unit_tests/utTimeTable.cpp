@@ -0,0 +1,168 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include <cmath>
+#include <stdexcept>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Albany_TimeTable.hpp"
+
+namespace {
+
+using Interpolation = Albany::TimeTable::Interpolation;
+
+// Piecewise linear data with a jump from 10 to 20 at t = 1
+std::vector<RealType> const jump_times  = {0.0, 1.0, 1.0, 2.0, 4.0};
+std::vector<RealType> const jump_values = {0.0, 10.0, 20.0, 20.0, 0.0};
+
+RealType
+jumpFunction(RealType const t)
+{
+  if (t <= 0.0) return 0.0;
+  if (t <= 1.0) return 10.0 * t;
+  if (t <= 2.0) return 20.0;
+  return 20.0 - 10.0 * (t - 2.0);
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, LinearIncreasingTimes)
+{
+  Albany::TimeTable const table(jump_times, jump_values);
+  TEST_EQUALITY(table.numTimes(), 5);
+  TEST_EQUALITY(table.numColumns(), 1);
+
+  // Small steps stay in the cached interval or move to the next one
+  auto const m = 400;
+  for (auto i = 0; i <= m; ++i) {
+    RealType const t = -0.5 + 4.5 * i / m;
+    TEST_COMPARE(std::abs(table.evaluate(t) - jumpFunction(t)), <=, 1.0e-12);
+  }
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, LinearArbitraryTimes)
+{
+  Albany::TimeTable const table(jump_times, jump_values);
+
+  // Times going backwards or skipping intervals need the binary search
+  RealType const ts[] = {3.5, 0.2, 3.9, 1.5, 0.7, 0.7, 2.0, -1.0, 4.0, 0.0};
+  for (auto t : ts) {
+    TEST_COMPARE(std::abs(table.evaluate(t) - jumpFunction(t)), <=, 1.0e-12);
+  }
+
+  // Times past the end of the table are an error
+  TEST_THROW(table.evaluate(4.5), std::invalid_argument);
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, Jump)
+{
+  Albany::TimeTable const table(jump_times, jump_values);
+
+  // At a repeated time the value is the left limit; just after, the right one
+  TEST_FLOATING_EQUALITY(table.evaluate(1.0), 10.0, 1.0e-14);
+  TEST_FLOATING_EQUALITY(table.evaluate(1.0 + 1.0e-10), 20.0, 1.0e-14);
+  TEST_FLOATING_EQUALITY(table.evaluate(1.0 - 1.0e-10), 10.0, 1.0e-8);
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, MultipleColumns)
+{
+  // Rows are times: the second column is twice the first one plus one
+  std::vector<RealType> values;
+  for (auto v : jump_values) {
+    values.push_back(v);
+    values.push_back(2.0 * v + 1.0);
+  }
+  Albany::TimeTable const table(jump_times, values, 2);
+  TEST_EQUALITY(table.numColumns(), 2);
+
+  RealType const ts[] = {0.5, 1.0, 1.5, 3.0, 0.25};
+  for (auto t : ts) {
+    RealType v[2];
+    table.evaluate(t, v);
+    TEST_COMPARE(std::abs(v[0] - jumpFunction(t)), <=, 1.0e-12);
+    TEST_COMPARE(std::abs(v[1] - (2.0 * jumpFunction(t) + 1.0)), <=, 1.0e-12);
+    TEST_COMPARE(std::abs(table.evaluate(t, 1) - v[1]), <=, 1.0e-12);
+  }
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, MonotoneCubicSlopes)
+{
+  Albany::TimeTable const table(
+      {0.0, 1.0, 3.0},
+      {0.0, 1.0, 5.0},
+      1,
+      Albany::TimeTable::interpolationFromString("Monotone Cubic"));
+
+  // Interior slope is the weighted harmonic mean of the secants 1 and 2,
+  // (w0 + w1) / (w0 / 1 + w1 / 2) with w0 = 2 h1 + h0 = 5, w1 = h1 + 2 h0 = 4
+  RealType const slope = 9.0 / 7.0;
+  RealType const eps   = 1.0e-6;
+  RealType const fd = (table.evaluate(1.0 + eps) - table.evaluate(1.0 - eps)) /
+                      (2.0 * eps);
+  TEST_FLOATING_EQUALITY(fd, slope, 1.0e-5);
+
+  // Midpoint of [1,3], with end slope equal to the last secant (2)
+  RealType const mid = 0.5 * 1.0 + 0.125 * 2.0 * slope + 0.5 * 5.0 -
+                       0.125 * 2.0 * 2.0;
+  TEST_FLOATING_EQUALITY(table.evaluate(2.0), mid, 1.0e-12);
+
+  // Samples are interpolated exactly
+  TEST_FLOATING_EQUALITY(table.evaluate(1.0), 1.0, 1.0e-14);
+  TEST_FLOATING_EQUALITY(table.evaluate(3.0), 5.0, 1.0e-14);
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, MonotoneCubicLinearData)
+{
+  // Linear data on a non-uniform grid is reproduced exactly
+  Albany::TimeTable const table(
+      {0.0, 1.0, 3.0, 4.0},
+      {1.0, 3.0, 7.0, 9.0},
+      1,
+      Interpolation::MonotoneCubic);
+
+  auto const m = 100;
+  for (auto i = 0; i <= m; ++i) {
+    RealType const t = 4.0 * i / m;
+    TEST_FLOATING_EQUALITY(table.evaluate(t), 2.0 * t + 1.0, 1.0e-12);
+  }
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, MonotoneCubicJump)
+{
+  // Zero slopes at the jump and at the plateaus: no overshoot anywhere
+  Albany::TimeTable const table(
+      {0.0, 1.0, 1.0, 2.0, 3.0},
+      {0.0, 1.0, 3.0, 3.0, 4.0},
+      1,
+      Interpolation::MonotoneCubic);
+
+  // On [0,1] the slopes are 1 (end) and 0 (jump)
+  TEST_FLOATING_EQUALITY(table.evaluate(0.5), 0.625, 1.0e-12);
+  TEST_FLOATING_EQUALITY(table.evaluate(1.0), 1.0, 1.0e-14);
+  TEST_FLOATING_EQUALITY(table.evaluate(1.5), 3.0, 1.0e-12);
+  // On [2,3] the slopes are 0 (plateau) and 1 (end)
+  TEST_FLOATING_EQUALITY(table.evaluate(2.5), 3.375, 1.0e-12);
+
+  RealType   previous = table.evaluate(0.0);
+  auto const m        = 300;
+  for (auto i = 1; i <= m; ++i) {
+    RealType const t = 3.0 * i / m;
+    RealType const v = table.evaluate(t);
+    TEST_COMPARE(v, >=, previous - 1.0e-14);
+    TEST_COMPARE(v, <=, 4.0 + 1.0e-14);
+    previous = v;
+  }
+}
+
+TEUCHOS_UNIT_TEST(TimeTable, InvalidInput)
+{
+  TEST_THROW(
+      Albany::TimeTable::interpolationFromString("Cubic"),
+      std::invalid_argument);
+  TEST_THROW(
+      Albany::TimeTable({0.0, 2.0, 1.0}, {0.0, 1.0, 2.0}),
+      std::invalid_argument);
+  TEST_THROW(
+      Albany::TimeTable({0.0, 1.0}, {0.0, 1.0, 2.0}), std::invalid_argument);
+}
+
+}  // namespace
@@ -117,6 +117,12 @@ combine (const Thyra_LinearOp& src,
          const CombineMode CM) const
 {
   auto cmT = combineModeT(CM);
+  auto srcB = Albany::getConstTpetraBlockMatrix(Teuchos::rcpFromRef(src));
+  if (!srcB.is_null()) {
+    auto dstB = Albany::getTpetraBlockMatrix(Teuchos::rcpFromRef(dst));
+    dstB->doExport(*srcB,*getBlockImporter(*dstB,*srcB),cmT);
+    return;
+  }
   auto srcT = Albany::getConstTpetraMatrix(src);
   auto dstT = Albany::getTpetraMatrix(dst);
 
@@ -205,6 +211,12 @@ combine (const Teuchos::RCP<const Thyra_LinearOp>& src,
          const CombineMode CM) const
 {
   auto cmT = combineModeT(CM);
+  auto srcB = Albany::getConstTpetraBlockMatrix(src);
+  if (!srcB.is_null()) {
+    auto dstB = Albany::getTpetraBlockMatrix(dst);
+    dstB->doExport(*srcB,*getBlockImporter(*dstB,*srcB),cmT);
+    return;
+  }
   auto srcT = Albany::getConstTpetraMatrix(src);
   auto dstT = Albany::getTpetraMatrix(dst);
 
@@ -294,6 +306,12 @@ scatter (const Thyra_LinearOp& src,
          const CombineMode CM) const
 {
   auto cmT  = combineModeT(CM);
+  auto srcB = Albany::getConstTpetraBlockMatrix(Teuchos::rcpFromRef(src));
+  if (!srcB.is_null()) {
+    auto dstB = Albany::getTpetraBlockMatrix(Teuchos::rcpFromRef(dst));
+    dstB->doImport(*srcB,*getBlockImporter(*srcB,*dstB),cmT);
+    return;
+  }
   auto srcT = Albany::getConstTpetraMatrix(src);
   auto dstT = Albany::getTpetraMatrix(dst);
 
@@ -382,6 +400,12 @@ scatter (const Teuchos::RCP<const Thyra_LinearOp>& src,
          const CombineMode CM) const
 {
   auto cmT  = combineModeT(CM);
+  auto srcB = Albany::getConstTpetraBlockMatrix(src);
+  if (!srcB.is_null()) {
+    auto dstB = Albany::getTpetraBlockMatrix(dst);
+    dstB->doImport(*srcB,*getBlockImporter(*srcB,*dstB),cmT);
+    return;
+  }
   auto srcT = Albany::getConstTpetraMatrix(src);
   auto dstT = Albany::getTpetraMatrix(dst);
 
@@ -395,6 +419,19 @@ scatter (const Teuchos::RCP<const Thyra_LinearOp>& src,
   dstT->doImport(*srcT,*importer,cmT);
 }
 
+Teuchos::RCP<const Tpetra_Import> CombineAndScatterManagerTpetra::
+getBlockImporter (const Tpetra_BlockCrsMatrix& owned,
+                  const Tpetra_BlockCrsMatrix& overlapped) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(static_cast<size_t>(owned.getBlockSize())*owned.getRowMap()->getNodeNumElements()!=
+                             importer->getSourceMap()->getNodeNumElements(), std::runtime_error,
+                             "Error! The point row map of the owned block matrix does not match the importer's source map.\n");
+  if (block_importer.is_null()) {
+    block_importer = Teuchos::rcp( new Tpetra_Import(owned.getRowMap(), overlapped.getRowMap()) );
+  }
+  return block_importer;
+}
+
 void CombineAndScatterManagerTpetra::
 create_ghosted_aura_owners () const {
   // Use the getter, so it creates the vs is if it's null
@@ -65,7 +65,14 @@ protected:
   void create_ghosted_aura_owners () const override;
   void create_owned_aura_users () const override;
 
+  // Point-block matrices are distributed by node, so they need a node importer,
+  // which is built from the matrices row maps upon first use.
+  Teuchos::RCP<const Tpetra_Import>
+  getBlockImporter (const Tpetra_BlockCrsMatrix& owned,
+                    const Tpetra_BlockCrsMatrix& overlapped) const;
+
   Teuchos::RCP<Tpetra_Import>   importer;
+  mutable Teuchos::RCP<Tpetra_Import>   block_importer;
 };
 
 } // namespace Albany
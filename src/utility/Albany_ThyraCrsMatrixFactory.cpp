@@ -23,17 +23,53 @@ struct ThyraCrsMatrixFactory::Impl {
   Teuchos::RCP<Tpetra_CrsGraph> t_graph;
 };
 
+namespace {
+
+// Given a point map, where the dofs of each node are contiguous (interleaved),
+// build the corresponding node map, with node gid = dof gid / block_size.
+Teuchos::RCP<const Tpetra_Map>
+createTpetraBlockMap (const Teuchos::RCP<const Tpetra_Map>& point_map, const int block_size)
+{
+  const LO num_points = point_map->getNodeNumElements();
+  TEUCHOS_TEST_FOR_EXCEPTION (num_points % block_size != 0, std::logic_error,
+                              "Error! The local size of the map (" << num_points << ") is not a multiple "
+                              "of the block size (" << block_size << ").\n");
+
+  Teuchos::Array<Tpetra_GO> block_gids(num_points / block_size);
+  for (LO iblock=0; iblock<block_gids.size(); ++iblock) {
+    const Tpetra_GO first = point_map->getGlobalElement(iblock*block_size);
+    for (int k=0; k<block_size; ++k) {
+      TEUCHOS_TEST_FOR_EXCEPTION (first % block_size != 0 ||
+                                  point_map->getGlobalElement(iblock*block_size+k) != first+k,
+                                  std::logic_error,
+                                  "Error! Point-block storage requires the dofs of each node to be "
+                                  "contiguous (interleaved ordering).\n");
+    }
+    block_gids[iblock] = first / block_size;
+  }
+
+  const auto invalid = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid();
+  return Teuchos::rcp(new Tpetra_Map(invalid, block_gids(), point_map->getIndexBase(), point_map->getComm()));
+}
+
+} // anonymous namespace
+
 ThyraCrsMatrixFactory::
 ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
                        const Teuchos::RCP<const Thyra_VectorSpace> range_vs,
-                       const int /*nonzeros_per_row*/)
+                       const int /*nonzeros_per_row*/,
+                       const int block_size)
  : m_graph(new Impl())
  , m_domain_vs(domain_vs)
  , m_range_vs(range_vs)
+ , m_block_size (block_size)
  , m_filled (false)
 {
   auto bt = Albany::build_type();
   TEUCHOS_TEST_FOR_EXCEPTION (bt==BuildType::None, std::logic_error, "Error! No build type set for albany.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (m_block_size<1, std::logic_error, "Error! Invalid block size " << m_block_size << ".\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (m_block_size>1 && bt!=BuildType::Tpetra, std::logic_error,
+                              "Error! Point-block storage is only available with Tpetra.\n");
 
   if (bt==BuildType::Epetra) {
 #ifdef ALBANY_EPETRA
@@ -44,6 +80,9 @@ ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
 #endif
   } else {
     t_range = getTpetraMap(range_vs);
+    if (m_block_size>1) {
+      t_range = createTpetraBlockMap(t_range,m_block_size);
+    }
     t_local_graph.resize(t_range->getNodeNumElements());
   }
 }
@@ -54,6 +93,7 @@ ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
                        const Teuchos::RCP<const ThyraCrsMatrixFactory> overlap_src)
  : m_domain_vs(domain_vs)
  , m_range_vs(range_vs)
+ , m_block_size(overlap_src->m_block_size)
 {
   TEUCHOS_TEST_FOR_EXCEPTION (!overlap_src->is_filled(), std::logic_error,
                               "Error! Can only build a graph from an overlapped source if source has been filled already.\n");
@@ -82,6 +122,13 @@ ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
     auto t_range = getTpetraMap(range_vs);
     auto t_overlap_range = getTpetraMap(overlap_src->m_range_vs);
     auto t_overlap_graph = overlap_src->m_graph->t_graph;
+    auto t_domain = getTpetraMap(domain_vs);
+    if (m_block_size>1) {
+      // The overlapped graph is a node graph, so export with node maps.
+      t_range = createTpetraBlockMap(t_range,m_block_size);
+      t_overlap_range = t_overlap_graph->getRowMap();
+      t_domain = createTpetraBlockMap(t_domain,m_block_size);
+    }
 
     //Creating an empty graph. The graph will be automatically resized when exported.
     m_graph->t_graph = createCrsGraph(t_range);
@@ -89,7 +136,6 @@ ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
     Tpetra_Export exporter(t_overlap_range,t_range);
     m_graph->t_graph->doExport(*t_overlap_graph,exporter,Tpetra::INSERT);
 
-    auto t_domain = getTpetraMap(domain_vs);
     m_graph->t_graph->fillComplete(t_domain,t_range);
   }
 
@@ -127,14 +173,16 @@ void ThyraCrsMatrixFactory::insertGlobalIndices (const GO row, const Teuchos::Ar
 #endif
   } else {
     // Despite being both 64 bits, GO and Tpetra_GO *may* be different *types*.
-    int lrow = t_range->getLocalElement(static_cast<Tpetra_GO>(row));
+    // With point-block storage, the local graph is a node graph, and dof gids
+    // are mapped to node gids (interleaved ordering is assumed).
+    int lrow = t_range->getLocalElement(static_cast<Tpetra_GO>(row / m_block_size));
 
     //ignore indices that are not owned by the this processor
     if(lrow < 0) return;
     
     auto& row_indices = t_local_graph[lrow];
     for (int i=0; i<indices.size(); ++i) {
-      row_indices.emplace(static_cast<Tpetra_GO>(indices[i]));
+      row_indices.emplace(static_cast<Tpetra_GO>(indices[i] / m_block_size));
     }
   }
 }
@@ -199,6 +247,9 @@ void ThyraCrsMatrixFactory::fillComplete () {
 
     t_local_graph.clear();
     auto t_domain = getTpetraMap(m_domain_vs);
+    if (m_block_size>1) {
+      t_domain = createTpetraBlockMap(t_domain,m_block_size);
+    }
     m_graph->t_graph->fillComplete(t_domain,t_range);
     t_range.reset();
   }
@@ -220,6 +271,12 @@ Teuchos::RCP<Thyra_LinearOp> ThyraCrsMatrixFactory::createOp () const {
 #else
     TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Epetra is not enabled in albany.\n");
 #endif
+  } else if (m_block_size>1) {
+    // The domain/range (point) maps of the matrix are built by Tpetra from the node maps
+    // of the graph, and coincide with the interleaved dof maps used to build the graph.
+    Teuchos::RCP<Tpetra_BlockCrsMatrix> mat = Teuchos::rcp (new Tpetra_BlockCrsMatrix(*m_graph->t_graph,m_block_size));
+    mat->setAllToScalar(Teuchos::ScalarTraits<ST>::zero());
+    op = createThyraLinearOp(Teuchos::rcp_implicit_cast<Tpetra_Operator>(mat));
   } else {
     Teuchos::RCP<Tpetra_CrsMatrix> mat = Teuchos::rcp (new Tpetra_CrsMatrix(m_graph->t_graph));
     auto const zero = Teuchos::ScalarTraits<ST>::zero();
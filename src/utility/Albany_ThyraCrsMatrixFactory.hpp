@@ -25,6 +25,14 @@ namespace Albany {
  * The implementation details of the graph are hidden, as is the concrete linear
  * algebra package underneath. The global function 'Albany::build_type' is used
  * to determine in which format the graph has to be stored.
+ *
+ * If a block size larger than one is requested (Tpetra only), the factory
+ * stores a node-level graph, where each row/column of the graph corresponds
+ * to block_size consecutive dofs, and createOp builds a point-block
+ * Tpetra::BlockCrsMatrix with dense block_size x block_size blocks.
+ * This requires the dofs of each node to be contiguous in both range and
+ * domain vector spaces (i.e., interleaved ordering), and all dofs of a node
+ * to share the same connectivity.
  */
 
 struct ThyraCrsMatrixFactory {
@@ -32,7 +40,8 @@ struct ThyraCrsMatrixFactory {
   // Create an empty graph, that needs to be filled later
   ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
                          const Teuchos::RCP<const Thyra_VectorSpace> range_vs,
-                         const int nonzeros_per_row=-1); //currently not used
+                         const int nonzeros_per_row=-1, //currently not used
+                         const int block_size=1);
 
   // Create a graph from an overlapped one
   ThyraCrsMatrixFactory (const Teuchos::RCP<const Thyra_VectorSpace> domain_vs,
@@ -54,6 +63,8 @@ struct ThyraCrsMatrixFactory {
 
   bool is_filled () const { return m_filled; }
 
+  int getBlockSize () const { return m_block_size; }
+
   Teuchos::RCP<Thyra_LinearOp>  createOp () const;
 
 private:
@@ -74,6 +85,7 @@ private:
   std::vector<std::set<Tpetra_GO>> t_local_graph;
   Teuchos::RCP<const Tpetra_Map> t_range;
 
+  int  m_block_size;
   bool m_filled;
 };
 
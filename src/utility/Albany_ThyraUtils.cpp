@@ -338,6 +338,69 @@ createVectorSpacesDifference (const Teuchos::RCP<const Thyra_VectorSpace>& vs1,
 
 // ========= Thyra_LinearOp utilities ========= //
 
+namespace {
+
+// Helpers for point-block (Tpetra_BlockCrsMatrix) operators. The Thyra_LinearOp
+// utilities below work on point (dof) local indices, so a point row/column lid
+// is split into a block lid (lid/block_size) and an offset within the block
+// (lid%block_size). Blocks are stored row-major by Tpetra.
+
+Teuchos::RCP<const Tpetra_Map>
+getBlockPointMap (const Tpetra_Map& mesh_map, const LO block_size)
+{
+  using BMV = Tpetra::BlockMultiVector<ST,Tpetra_LO,Tpetra_GO,KokkosNode>;
+  return Teuchos::rcp(new Tpetra_Map(BMV::makePointMap(mesh_map,block_size)));
+}
+
+void getBlockRowView (const Tpetra_BlockCrsMatrix& bmat, const LO lbrow,
+                      const LO*& bcols, ST*& vals, LO& numBlocks)
+{
+  const LO err = bmat.getLocalRowView(lbrow,bcols,vals,numBlocks);
+  TEUCHOS_TEST_FOR_EXCEPTION (err!=0, std::runtime_error,
+                              "Error! Could not get a view of local block row " << lbrow << ".\n");
+}
+
+// Returns the position of block column lbcol in the block row, or -1 if not found
+LO findBlockColumn (const LO* bcols, const LO numBlocks, const LO lbcol)
+{
+  for (LO k=0; k<numBlocks; ++k) {
+    if (bcols[k]==lbcol) {
+      return k;
+    }
+  }
+  return -1;
+}
+
+// Add (or replace) values in a point row of a block matrix.
+// Returns the number of entries that were actually found in the graph.
+int changeBlockPointRowValues (const Tpetra_BlockCrsMatrix& bmat,
+                               const LO lrow,
+                               const Teuchos::ArrayView<const LO> indices,
+                               const Teuchos::ArrayView<const ST> values,
+                               const bool sum)
+{
+  const LO bs = bmat.getBlockSize();
+  const LO* bcols;
+  ST* vals;
+  LO numBlocks;
+  getBlockRowView(bmat,lrow/bs,bcols,vals,numBlocks);
+
+  ST* row_vals = vals + (lrow%bs)*bs;
+  int num_found = 0;
+  for (int i=0; i<indices.size(); ++i) {
+    const LO k = findBlockColumn(bcols,numBlocks,indices[i]/bs);
+    if (k<0) {
+      continue;
+    }
+    ST& entry = row_vals[k*bs*bs + indices[i]%bs];
+    entry = sum ? entry + values[i] : values[i];
+    ++num_found;
+  }
+  return num_found;
+}
+
+} // anonymous namespace
+
 Teuchos::RCP<const Thyra_VectorSpace>
 getColumnSpace (const Teuchos::RCP<const Thyra_LinearOp>& lop)
 {
@@ -346,6 +409,10 @@ getColumnSpace (const Teuchos::RCP<const Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return createThyraVectorSpace(tmat->getColMap());
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    return createThyraVectorSpace(getBlockPointMap(*bmat->getColMap(),bmat->getBlockSize()));
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -370,6 +437,10 @@ getRowSpace (const Teuchos::RCP<const Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return createThyraVectorSpace(tmat->getRowMap());
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    return createThyraVectorSpace(getBlockPointMap(*bmat->getRowMap(),bmat->getBlockSize()));
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -394,6 +465,15 @@ getNumEntriesInLocalRow (const Teuchos::RCP<const Thyra_LinearOp>& lop, const LO
   if (!tmat.is_null()) {
     return tmat->getNumEntriesInLocalRow(lrow);
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const LO bs = bmat->getBlockSize();
+    const LO* bcols;
+    ST* vals;
+    LO numBlocks;
+    getBlockRowView(*bmat,lrow/bs,bcols,vals,numBlocks);
+    return numBlocks*bs;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -418,6 +498,10 @@ bool isFillActive (const Teuchos::RCP<const Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return tmat->isFillActive();
   }
+  // The values of a block matrix can always be modified
+  if (!getConstTpetraBlockMatrix(lop).is_null()) {
+    return true;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -440,6 +524,10 @@ bool isFillComplete (const Teuchos::RCP<const Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return tmat->isFillComplete();
   }
+  // A block matrix is built from a filled graph, so it is always fill complete
+  if (!getConstTpetraBlockMatrix(lop).is_null()) {
+    return true;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -463,6 +551,10 @@ void resumeFill (const Teuchos::RCP<Thyra_LinearOp>& lop)
     tmat->resumeFill();
     return;
   }
+  if (!getTpetraBlockMatrix(lop).is_null()) {
+    // Nothing to do: block matrices have no fill state
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -485,6 +577,10 @@ void fillComplete (const Teuchos::RCP<Thyra_LinearOp>& lop)
     tmat->fillComplete();
     return;
   }
+  if (!getTpetraBlockMatrix(lop).is_null()) {
+    // Nothing to do: block matrices have no fill state
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
@@ -519,6 +615,11 @@ void assign (const Teuchos::RCP<Thyra_LinearOp>& lop, const ST value)
 
     return;
   }
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    bmat->setAllToScalar(value);
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
@@ -554,6 +655,24 @@ void getDiagonalCopy (const Teuchos::RCP<const Thyra_LinearOp>& lop,
     tmat->getLocalDiagCopy(tvec);
     return;
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const LO bs = bmat->getBlockSize();
+    const auto& row_map = *bmat->getRowMap();
+    const auto& col_map = *bmat->getColMap();
+    auto diag_vals = getNonconstLocalData(diag);
+    for (LO lbrow=0; lbrow<static_cast<LO>(row_map.getNodeNumElements()); ++lbrow) {
+      const LO* bcols;
+      ST* vals;
+      LO numBlocks;
+      getBlockRowView(*bmat,lbrow,bcols,vals,numBlocks);
+      const LO k = findBlockColumn(bcols,numBlocks,col_map.getLocalElement(row_map.getGlobalElement(lbrow)));
+      for (LO i=0; i<bs; ++i) {
+        diag_vals[lbrow*bs+i] = k<0 ? 0.0 : vals[k*bs*bs + i*bs + i];
+      }
+    }
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -575,6 +694,21 @@ void scale (const Teuchos::RCP<Thyra_LinearOp>& lop, const ST val)
     tmat->scale(val); 
     return; 
   }
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const LO bs2 = bmat->getBlockSize()*bmat->getBlockSize();
+    const LO numBlockRows = bmat->getRowMap()->getNodeNumElements();
+    for (LO lbrow=0; lbrow<numBlockRows; ++lbrow) {
+      const LO* bcols;
+      ST* vals;
+      LO numBlocks;
+      getBlockRowView(*bmat,lbrow,bcols,vals,numBlocks);
+      for (LO i=0; i<numBlocks*bs2; ++i) {
+        vals[i] *= val;
+      }
+    }
+    return;
+  }
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
   if (!emat.is_null()) {
@@ -600,6 +734,24 @@ void getLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
     tmat->getLocalRowCopy(lrow,indices,values,numEntries);
     return;
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const LO bs = bmat->getBlockSize();
+    const LO* bcols;
+    ST* vals;
+    LO numBlocks;
+    getBlockRowView(*bmat,lrow/bs,bcols,vals,numBlocks);
+    indices.resize(numBlocks*bs);
+    values.resize(numBlocks*bs);
+    const ST* row_vals = vals + (lrow%bs)*bs;
+    for (LO k=0; k<numBlocks; ++k) {
+      for (LO j=0; j<bs; ++j) {
+        indices[k*bs+j] = bcols[k]*bs + j;
+        values[k*bs+j]  = row_vals[k*bs*bs + j];
+      }
+    }
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -636,6 +788,12 @@ int addToLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
     if (returned_val != indices.size()) integer_error_code = 1; 
     return integer_error_code; 
   }
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const int num_found = changeBlockPointRowValues(*bmat,lrow,indices,values,true);
+    if (num_found != indices.size()) integer_error_code = 1;
+    return integer_error_code;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
@@ -651,6 +809,30 @@ int addToLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
   TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error, "Error in addToLocalRowValues! Could not cast Thyra_LinearOp to any of the supported concrete types.\n");
 }
 
+int getBlockSize (const Teuchos::RCP<const Thyra_LinearOp>& lop)
+{
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  return bmat.is_null() ? 1 : bmat->getBlockSize();
+}
+
+int addToLocalBlockRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
+                              const LO lbrow,
+                              const Teuchos::ArrayView<const LO> block_indices,
+                              const Teuchos::ArrayView<const ST> values)
+{
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    const LO bs = bmat->getBlockSize();
+    ALBANY_EXPECT(values.size()==block_indices.size()*bs*bs,
+                  "Error in addToLocalBlockRowValues! Input values must contain one dense block per block index.\n");
+    const LO returned_val = bmat->sumIntoLocalValues(lbrow,block_indices.getRawPtr(),values.getRawPtr(),block_indices.size());
+    return returned_val != block_indices.size() ? 1 : 0;
+  }
+
+  // If all the tries above are unsuccessful, throw an error.
+  TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error, "Error in addToLocalBlockRowValues! The Thyra_LinearOp does not store a point-block matrix.\n");
+}
+
 void insertGlobalValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
                          const GO grow,
                          const Teuchos::ArrayView<const GO> cols,
@@ -794,6 +976,11 @@ void setLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
     tmat->replaceLocalValues(lrow,indices,values);
     return;
   }
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    changeBlockPointRowValues(*bmat,lrow,indices,values,false);
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
@@ -822,6 +1009,25 @@ void setLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
     tmat->replaceLocalValues(lrow,indices,values);
     return;
   }
+  auto bmat = getTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    // Same ordering as in getLocalRowValues
+    const LO bs = bmat->getBlockSize();
+    const LO* bcols;
+    ST* vals;
+    LO numBlocks;
+    getBlockRowView(*bmat,lrow/bs,bcols,vals,numBlocks);
+    TEUCHOS_TEST_FOR_EXCEPTION(numBlocks*bs!=values.size(), std::logic_error,
+                               "Error! This routine is meant for setting *all* values in a row, "
+                               "but the length of the input values array does not match the number of indices in the local row.\n");
+    ST* row_vals = vals + (lrow%bs)*bs;
+    for (LO k=0; k<numBlocks; ++k) {
+      for (LO j=0; j<bs; ++j) {
+        row_vals[k*bs*bs + j] = values[k*bs+j];
+      }
+    }
+    return;
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
@@ -850,6 +1056,10 @@ int getGlobalMaxNumRowEntries (const Teuchos::RCP<const Thyra_LinearOp>& lop)
     auto return_value = tmat->getGlobalMaxNumRowEntries();
     return return_value; 
   }
+  auto bmat = getConstTpetraBlockMatrix(lop);
+  if (!bmat.is_null()) {
+    return bmat->getCrsGraph().getGlobalMaxNumRowEntries()*bmat->getBlockSize();
+  }
 
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
@@ -871,6 +1081,9 @@ bool isStaticGraph(const Teuchos::RCP<Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return tmat->isStaticGraph(); 
   }
+  if (!getTpetraBlockMatrix(lop).is_null()) {
+    return true;
+  }
 #if defined(ALBANY_EPETRA)
   auto emat = getEpetraMatrix(lop,false);
   if (!emat.is_null()) {
@@ -890,6 +1103,9 @@ bool isStaticGraph(const Teuchos::RCP<const Thyra_LinearOp>& lop)
   if (!tmat.is_null()) {
     return tmat->isStaticGraph(); 
   }
+  if (!getConstTpetraBlockMatrix(lop).is_null()) {
+    return true;
+  }
 #if defined(ALBANY_EPETRA)
   auto emat = getConstEpetraMatrix(lop,false);
   if (!emat.is_null()) {
@@ -1084,6 +1300,9 @@ DeviceLocalMatrix<const ST> getDeviceData (Teuchos::RCP<const Thyra_LinearOp>& l
   }
 #endif
 
+  TEUCHOS_TEST_FOR_EXCEPTION (!getConstTpetraBlockMatrix(lop).is_null(), std::logic_error,
+                              "Error in getDeviceData! Point-block matrices do not expose a device crs matrix.\n");
+
   // If all the tries above are unsuccessful, throw an error.
   TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error, "Error in getDeviceData! Could not cast Thyra_Vector to any of the supported concrete types.\n");
 
@@ -1155,6 +1374,9 @@ DeviceLocalMatrix<ST> getNonconstDeviceData (Teuchos::RCP<Thyra_LinearOp>& lop)
   }
 #endif
 
+  TEUCHOS_TEST_FOR_EXCEPTION (!getTpetraBlockMatrix(lop).is_null(), std::logic_error,
+                              "Error in getNonconstDeviceData! Point-block matrices do not expose a device crs matrix.\n");
+
   // If all the tries above are unsuccessful, throw an error.
   TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error, "Error in getNonconstDeviceData! Could not cast Thyra_Vector to any of the supported concrete types.\n");
 
@@ -105,6 +105,15 @@ int addToLocalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
                           const Teuchos::ArrayView<const LO> indices,
                           const Teuchos::ArrayView<const ST> values);
 
+// Point-block helpers. getBlockSize returns 1 for operators that are not
+// point-block matrices. addToLocalBlockRowValues sums dense row-major blocks
+// (one per block column index) into the local block row lbrow.
+int getBlockSize (const Teuchos::RCP<const Thyra_LinearOp>& lop);
+int addToLocalBlockRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
+                              const LO lbrow,
+                              const Teuchos::ArrayView<const LO> block_indices,
+                              const Teuchos::ArrayView<const ST> values);
+
 int addToGlobalRowValues (const Teuchos::RCP<Thyra_LinearOp>& lop,
                           const GO grow,
                           const Teuchos::ArrayView<const GO> indices,
@@ -0,0 +1,137 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_TimeTable.hpp"
+
+#include "Teuchos_TestForException.hpp"
+
+#include <algorithm>
+
+namespace Albany {
+
+TimeTable::
+TimeTable (const std::vector<RealType>& times,
+           const std::vector<RealType>& values,
+           const int numColumns,
+           const Interpolation interp)
+ : m_times (times)
+ , m_values (values)
+ , m_num_cols (numColumns)
+ , m_interp (interp)
+{
+  const int n = m_times.size();
+  TEUCHOS_TEST_FOR_EXCEPTION (n==0, std::invalid_argument,
+      "Error! The time table is empty.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (m_num_cols<1, std::invalid_argument,
+      "Error! The time table must have at least one column.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (static_cast<int>(m_values.size())!=n*m_num_cols, std::invalid_argument,
+      "Error! The number of values (" << m_values.size() << ") does not match the number of "
+      "times (" << n << ") times the number of columns (" << m_num_cols << ").\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (!std::is_sorted(m_times.begin(),m_times.end()), std::invalid_argument,
+      "Error! The times in the time table must be non-decreasing.\n");
+
+  if (m_interp==Interpolation::MonotoneCubic && n>1) {
+    // Slopes of the monotone cubic interpolant at the samples. At repeated
+    // times (jumps) and local extrema the slope is set to zero.
+    m_slopes.resize(n*m_num_cols,0.0);
+    for (int c=0; c<m_num_cols; ++c) {
+      auto y = [&](const int i) { return m_values[i*m_num_cols+c]; };
+      auto h = [&](const int i) { return m_times[i+1]-m_times[i]; };
+      auto delta = [&](const int i) { return h(i)>0 ? (y(i+1)-y(i))/h(i) : 0.0; };
+
+      m_slopes[c] = delta(0);
+      m_slopes[(n-1)*m_num_cols+c] = delta(n-2);
+      for (int i=1; i<n-1; ++i) {
+        const RealType h0 = h(i-1);
+        const RealType h1 = h(i);
+        const RealType d0 = delta(i-1);
+        const RealType d1 = delta(i);
+        RealType& d = m_slopes[i*m_num_cols+c];
+        if (h0==0 || h1==0 || d0*d1<=0) {
+          d = 0;
+        } else {
+          const RealType w0 = 2*h1+h0;
+          const RealType w1 = h1+2*h0;
+          d = (w0+w1) / (w0/d0 + w1/d1);
+        }
+      }
+    }
+  }
+}
+
+TimeTable::Interpolation TimeTable::
+interpolationFromString (const std::string& name)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (name!="Linear" && name!="Monotone Cubic", std::invalid_argument,
+      "Error! Unknown time interpolation '" << name << "'. Valid choices: 'Linear', 'Monotone Cubic'.\n");
+  return name=="Linear" ? Interpolation::Linear : Interpolation::MonotoneCubic;
+}
+
+int TimeTable::findInterval (const RealType time) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (time>m_times.back(), std::invalid_argument,
+      "Time is growing unbounded!");
+
+  if (time<=m_times[0]) {
+    return 0;
+  }
+
+  // Time usually stays in the same interval or moves to the next one
+  const int n = m_times.size();
+  for (int i=std::max(m_last,1); i<std::min(m_last+2,n); ++i) {
+    if (m_times[i-1]<time && time<=m_times[i]) {
+      m_last = i;
+      return i;
+    }
+  }
+
+  m_last = std::lower_bound(m_times.begin(),m_times.end(),time) - m_times.begin();
+  return m_last;
+}
+
+RealType TimeTable::
+interpolate (const int i, const RealType time, const int col) const
+{
+  if (i==0) {
+    return m_values[col];
+  }
+
+  const RealType t0 = m_times[i-1];
+  const RealType h  = m_times[i]-t0;
+  const RealType y0 = m_values[(i-1)*m_num_cols+col];
+  const RealType y1 = m_values[i*m_num_cols+col];
+  const RealType s  = (time-t0)/h;
+
+  if (m_interp==Interpolation::Linear) {
+    return y0 + s*(y1-y0);
+  }
+
+  // Cubic Hermite basis
+  const RealType d0 = m_slopes[(i-1)*m_num_cols+col];
+  const RealType d1 = m_slopes[i*m_num_cols+col];
+  const RealType h00 = (1+2*s)*(1-s)*(1-s);
+  const RealType h10 = s*(1-s)*(1-s);
+  const RealType h01 = s*s*(3-2*s);
+  const RealType h11 = s*s*(s-1);
+  return h00*y0 + h10*h*d0 + h01*y1 + h11*h*d1;
+}
+
+RealType TimeTable::
+evaluate (const RealType time, const int col) const
+{
+  return interpolate(findInterval(time),time,col);
+}
+
+void TimeTable::
+evaluate (const RealType time, RealType* values) const
+{
+  const int i = findInterval(time);
+  for (int c=0; c<m_num_cols; ++c) {
+    values[c] = interpolate(i,time,c);
+  }
+}
+
+} // namespace Albany
@@ -0,0 +1,79 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_TIME_TABLE_HPP
+#define ALBANY_TIME_TABLE_HPP
+
+#include "Albany_ScalarOrdinalTypes.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+/*
+ * A table of values sampled at a non-decreasing sequence of times, as used
+ * by time dependent BCs and sources. Each time can have several values
+ * (columns), stored row by row (one row per time).
+ *
+ * The interval containing the time is cached, so that looking up a time
+ * equal to or just after the previous one is O(1); otherwise, we fall back
+ * to a binary search. For times before the first one, the first row is
+ * returned; times after the last one are an error.
+ *
+ * Between samples, values are interpolated either linearly or with a
+ * monotone (Fritsch-Carlson) cubic Hermite interpolant, which is smooth
+ * but does not overshoot the data. Repeated times can be used to encode
+ * jumps in the data.
+ */
+
+class TimeTable
+{
+public:
+  enum class Interpolation { Linear, MonotoneCubic };
+
+  TimeTable () = default;
+
+  TimeTable (const std::vector<RealType>& times,
+             const std::vector<RealType>& values,
+             const int numColumns = 1,
+             const Interpolation interp = Interpolation::Linear);
+
+  // Either "Linear" or "Monotone Cubic"
+  static Interpolation interpolationFromString (const std::string& name);
+
+  // Value of the given column at the given time
+  RealType evaluate (const RealType time, const int col = 0) const;
+
+  // Values of all the columns at the given time (looking up the time once)
+  void evaluate (const RealType time, RealType* values) const;
+
+  int numTimes   () const { return m_times.size(); }
+  int numColumns () const { return m_num_cols; }
+
+  RealType firstTime () const { return m_times.front(); }
+  RealType lastTime  () const { return m_times.back(); }
+
+private:
+  // Returns i such that m_times[i-1] < time <= m_times[i], or 0 if time <= m_times[0]
+  int findInterval (const RealType time) const;
+
+  RealType interpolate (const int i, const RealType time, const int col) const;
+
+  std::vector<RealType>   m_times;
+  std::vector<RealType>   m_values;
+  std::vector<RealType>   m_slopes;   // Only for cubic interpolation
+
+  int             m_num_cols = 1;
+  Interpolation   m_interp   = Interpolation::Linear;
+
+  // Interval found by the last lookup
+  mutable int     m_last = 0;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_TIME_TABLE_HPP
@@ -227,6 +227,30 @@ getConstTpetraMatrix (const Teuchos::RCP<const Thyra_LinearOp>& lop,
   return mat;
 }
 
+Teuchos::RCP<Tpetra_BlockCrsMatrix>
+getTpetraBlockMatrix (const Teuchos::RCP<Thyra_LinearOp>& lop)
+{
+  Teuchos::RCP<Tpetra_BlockCrsMatrix> mat;
+  if (!lop.is_null()) {
+    auto op = getTpetraOperator(lop,false);
+    mat = Teuchos::rcp_dynamic_cast<Tpetra_BlockCrsMatrix>(op,false);
+  }
+
+  return mat;
+}
+
+Teuchos::RCP<const Tpetra_BlockCrsMatrix>
+getConstTpetraBlockMatrix (const Teuchos::RCP<const Thyra_LinearOp>& lop)
+{
+  Teuchos::RCP<const Tpetra_BlockCrsMatrix> mat;
+  if (!lop.is_null()) {
+    auto op = getConstTpetraOperator(lop,false);
+    mat = Teuchos::rcp_dynamic_cast<const Tpetra_BlockCrsMatrix>(op,false);
+  }
+
+  return mat;
+}
+
 // --- Casts taking references as inputs --- //
 
 Teuchos::RCP<Tpetra_Vector>
@@ -71,6 +71,14 @@ Teuchos::RCP<const Tpetra_CrsMatrix>
 getConstTpetraMatrix (const Teuchos::RCP<const Thyra_LinearOp>& lop,
                       const bool throw_if_not_tpetra = true);
 
+// Point-block matrices are never the default storage, so these casts
+// return null (rather than throwing) if the operator is not a BlockCrsMatrix.
+Teuchos::RCP<Tpetra_BlockCrsMatrix>
+getTpetraBlockMatrix (const Teuchos::RCP<Thyra_LinearOp>& lop);
+
+Teuchos::RCP<const Tpetra_BlockCrsMatrix>
+getConstTpetraBlockMatrix (const Teuchos::RCP<const Thyra_LinearOp>& lop);
+
 // --- Conversion from references rather than RCPs --- //
 
 Teuchos::RCP<Tpetra_Vector>
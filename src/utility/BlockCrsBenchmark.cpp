@@ -0,0 +1,315 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Compare point (Tpetra_CrsMatrix) and point-block (Tpetra_BlockCrsMatrix)
+// storage of a Jacobian with neq equations per node, on a structured hex mesh.
+// Both matrices are built with Albany::ThyraCrsMatrixFactory, assembled
+// element by element through the Albany linear algebra utilities, combined
+// into the owned matrix, and applied. Reports memory, assembly and SpMV times.
+//
+// Usage: AlbanyBlockCrsBenchmark [--cells N] [--neq NEQ] [--reps R]
+
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_CommUtils.hpp"
+#include "Albany_ThyraCrsMatrixFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_TpetraThyraUtils.hpp"
+#include "Albany_Utils.hpp"
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Thyra_MultiVectorStdOps.hpp>
+#include <Thyra_VectorStdOps.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double
+seconds_since(Clock::time_point const start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// A structured mesh of n^3 hexes, with nodes partitioned in contiguous
+// slabs of gids. A rank owns the elements whose first node it owns.
+struct HexMesh
+{
+  HexMesh(int const n, Teuchos::RCP<Teuchos_Comm const> const& comm)
+      : n(n), np(n + 1)
+  {
+    GO const num_nodes = static_cast<GO>(np) * np * np;
+    GO const rank      = comm->getRank();
+    GO const size      = comm->getSize();
+    GO const first     = (num_nodes * rank) / size;
+    GO const last      = (num_nodes * (rank + 1)) / size;
+
+    for (GO node = first; node < last; ++node) {
+      owned_nodes.push_back(node);
+      int const i = node % np;
+      int const j = (node / np) % np;
+      int const k = node / (np * np);
+      if (i < n && j < n && k < n) elements.push_back(node);
+    }
+
+    std::set<GO> overlap(owned_nodes.begin(), owned_nodes.end());
+    for (auto const first_node : elements) {
+      GO nodes[8];
+      element_nodes(first_node, nodes);
+      overlap.insert(nodes, nodes + 8);
+    }
+    // Owned nodes first, then the ghosted ones
+    overlap_nodes = owned_nodes;
+    for (auto const node : overlap) {
+      if (node < first || node >= last) overlap_nodes.push_back(node);
+    }
+  }
+
+  void
+  element_nodes(GO const first_node, GO nodes[8]) const
+  {
+    GO const dj = np;
+    GO const dk = static_cast<GO>(np) * np;
+    nodes[0]    = first_node;
+    nodes[1]    = first_node + 1;
+    nodes[2]    = first_node + 1 + dj;
+    nodes[3]    = first_node + dj;
+    nodes[4]    = nodes[0] + dk;
+    nodes[5]    = nodes[1] + dk;
+    nodes[6]    = nodes[2] + dk;
+    nodes[7]    = nodes[3] + dk;
+  }
+
+  int             n;
+  int             np;
+  std::vector<GO> owned_nodes;
+  std::vector<GO> overlap_nodes;
+  std::vector<GO> elements;
+};
+
+Teuchos::RCP<Thyra_VectorSpace const>
+create_dof_space(
+    Teuchos::RCP<Teuchos_Comm const> const& comm,
+    std::vector<GO> const&                  nodes,
+    int const                               neq)
+{
+  Teuchos::Array<GO> dofs(nodes.size() * neq);
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    for (int eq = 0; eq < neq; ++eq) { dofs[i * neq + eq] = nodes[i] * neq + eq; }
+  }
+  return Albany::createVectorSpace(comm, dofs());
+}
+
+// Element matrix entry coupling dofs (a,eq_a) and (b,eq_b) of an element
+ST
+element_entry(int const a, int const eq_a, int const b, int const eq_b)
+{
+  if (a == b && eq_a == eq_b) return 8.0;
+  return -1.0 / (1.0 + std::abs(a - b) + std::abs(eq_a - eq_b));
+}
+
+struct Results
+{
+  double graph_time{0.0};
+  double assembly_time{0.0};
+  double spmv_time{0.0};
+  double memory_mb{0.0};
+  ST     y_norm{0.0};
+};
+
+Results
+run(HexMesh const&                          mesh,
+    Teuchos::RCP<Teuchos_Comm const> const& comm,
+    int const                               neq,
+    int const                               block_size,
+    int const                               reps)
+{
+  Results results;
+
+  auto const owned_vs   = create_dof_space(comm, mesh.owned_nodes, neq);
+  auto const overlap_vs = create_dof_space(comm, mesh.overlap_nodes, neq);
+  auto const overlap_map = Albany::getTpetraMap(overlap_vs);
+
+  // Graph
+  auto start           = Clock::now();
+  auto overlap_factory = Teuchos::rcp(new Albany::ThyraCrsMatrixFactory(
+      overlap_vs, overlap_vs, 8 * neq, block_size));
+  Teuchos::Array<GO> cols(8 * neq);
+  for (auto const first_node : mesh.elements) {
+    GO nodes[8];
+    mesh.element_nodes(first_node, nodes);
+    for (int b = 0; b < 8; ++b) {
+      for (int eq = 0; eq < neq; ++eq) { cols[b * neq + eq] = nodes[b] * neq + eq; }
+    }
+    for (int a = 0; a < 8; ++a) {
+      for (int eq = 0; eq < neq; ++eq) {
+        overlap_factory->insertGlobalIndices(nodes[a] * neq + eq, cols());
+      }
+    }
+  }
+  overlap_factory->fillComplete();
+  auto owned_factory = Teuchos::rcp(
+      new Albany::ThyraCrsMatrixFactory(owned_vs, owned_vs, overlap_factory));
+  auto overlap_jac = overlap_factory->createOp();
+  auto jac         = owned_factory->createOp();
+  results.graph_time = seconds_since(start);
+
+  // Assembly: scatter the element matrices, then combine into the owned matrix
+  auto cas_manager = Albany::createCombineAndScatterManager(owned_vs, overlap_vs);
+  start            = Clock::now();
+  Albany::assign(overlap_jac, 0.0);
+  Teuchos::Array<LO> lcols(8 * neq);
+  Teuchos::Array<LO> lblock_cols(8);
+  Teuchos::Array<ST> vals(8 * neq * neq);
+  for (auto const first_node : mesh.elements) {
+    GO nodes[8];
+    mesh.element_nodes(first_node, nodes);
+    for (int b = 0; b < 8; ++b) {
+      LO const lnode = overlap_map->getLocalElement(nodes[b] * neq) / neq;
+      lblock_cols[b] = lnode;
+      for (int eq = 0; eq < neq; ++eq) { lcols[b * neq + eq] = lnode * neq + eq; }
+    }
+    for (int a = 0; a < 8; ++a) {
+      if (block_size > 1) {
+        // One row-major neq x neq block per element node
+        for (int b = 0; b < 8; ++b) {
+          for (int eq_a = 0; eq_a < neq; ++eq_a) {
+            for (int eq_b = 0; eq_b < neq; ++eq_b) {
+              vals[(b * neq + eq_a) * neq + eq_b] = element_entry(a, eq_a, b, eq_b);
+            }
+          }
+        }
+        Albany::addToLocalBlockRowValues(overlap_jac, lblock_cols[a], lblock_cols(), vals());
+      } else {
+        for (int eq_a = 0; eq_a < neq; ++eq_a) {
+          for (int b = 0; b < 8; ++b) {
+            for (int eq_b = 0; eq_b < neq; ++eq_b) {
+              vals[b * neq + eq_b] = element_entry(a, eq_a, b, eq_b);
+            }
+          }
+          Albany::addToLocalRowValues(
+              overlap_jac, lcols[a * neq + eq_a], lcols(), vals(0, 8 * neq));
+        }
+      }
+    }
+  }
+  Albany::fillComplete(overlap_jac);
+  Albany::resumeFill(jac);
+  Albany::assign(jac, 0.0);
+  cas_manager->combine(overlap_jac, jac, Albany::CombineMode::ADD);
+  Albany::fillComplete(jac);
+  results.assembly_time = seconds_since(start);
+
+  // SpMV
+  auto x = Thyra::createMember(jac->domain());
+  auto y = Thyra::createMember(jac->range());
+  Thyra::put_scalar(1.0, x.ptr());
+  jac->apply(Thyra::NOTRANS, *x, y.ptr(), 1.0, 0.0);
+  start = Clock::now();
+  for (int r = 0; r < reps; ++r) {
+    jac->apply(Thyra::NOTRANS, *x, y.ptr(), 1.0, 0.0);
+  }
+  results.spmv_time = seconds_since(start) / reps;
+  results.y_norm    = Thyra::norm_2(*y);
+
+  // Memory of the local values, column indices and row offsets
+  double bytes = 0.0;
+  auto   tmat  = Albany::getTpetraMatrix(jac, false);
+  auto   bmat  = Albany::getTpetraBlockMatrix(jac);
+  if (!tmat.is_null()) {
+    double const nnz  = tmat->getNodeNumEntries();
+    double const rows = tmat->getNodeNumRows();
+    bytes = nnz * (sizeof(ST) + sizeof(LO)) + (rows + 1) * sizeof(std::size_t);
+  } else if (!bmat.is_null()) {
+    auto const&  graph = bmat->getCrsGraph();
+    double const nnzb  = graph.getNodeNumEntries();
+    double const rows  = graph.getNodeNumRows();
+    double const bs2   = static_cast<double>(block_size) * block_size;
+    bytes = nnzb * (bs2 * sizeof(ST) + sizeof(LO)) + (rows + 1) * sizeof(std::size_t);
+  }
+  double total_bytes = 0.0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, bytes, Teuchos::outArg(total_bytes));
+  results.memory_mb = total_bytes / (1024.0 * 1024.0);
+
+  // Report the slowest rank
+  double times[3] = {results.graph_time, results.assembly_time, results.spmv_time};
+  double max_times[3];
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 3, times, max_times);
+  results.graph_time    = max_times[0];
+  results.assembly_time = max_times[1];
+  results.spmv_time     = max_times[2];
+
+  return results;
+}
+
+}  // anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+
+  int cells = 32;
+  int neq   = 3;
+  int reps  = 20;
+  for (int i = 1; i < argc - 1; ++i) {
+    if (std::strcmp(argv[i], "--cells") == 0) cells = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "--neq") == 0) neq = std::atoi(argv[++i]);
+    else if (std::strcmp(argv[i], "--reps") == 0) reps = std::atoi(argv[++i]);
+  }
+
+  int status = 0;
+  {
+    static_cast<void>(Albany::build_type(Albany::BuildType::Tpetra));
+    auto const comm = Albany::getDefaultComm();
+    HexMesh const mesh(cells, comm);
+
+    auto const point = run(mesh, comm, neq, 1, reps);
+    auto const block = run(mesh, comm, neq, neq, reps);
+
+    if (comm->getRank() == 0) {
+      std::cout << "Hex mesh " << cells << "^3, neq = " << neq
+                << ", ranks = " << comm->getSize() << "\n";
+      std::cout << std::setw(12) << "storage" << std::setw(14) << "memory [MB]"
+                << std::setw(14) << "graph [s]" << std::setw(14)
+                << "assembly [s]" << std::setw(14) << "spmv [s]" << "\n";
+      std::cout << std::scientific << std::setprecision(4);
+      std::cout << std::setw(12) << "CrsMatrix" << std::setw(14)
+                << point.memory_mb << std::setw(14) << point.graph_time
+                << std::setw(14) << point.assembly_time << std::setw(14)
+                << point.spmv_time << "\n";
+      std::cout << std::setw(12) << "BlockCrs" << std::setw(14)
+                << block.memory_mb << std::setw(14) << block.graph_time
+                << std::setw(14) << block.assembly_time << std::setw(14)
+                << block.spmv_time << "\n";
+    }
+
+    // Both storages hold the same operator
+    ST const rel_diff = std::abs(point.y_norm - block.y_norm) /
+                        std::max(std::abs(point.y_norm), 1.0);
+    if (rel_diff > 1.0e-12) {
+      if (comm->getRank() == 0) {
+        std::cout << "Error! Point and block operators differ: |y| = "
+                  << point.y_norm << " vs " << block.y_norm << "\n";
+      }
+      status = 1;
+    }
+  }
+
+  Kokkos::finalize_all();
+  return status;
+}
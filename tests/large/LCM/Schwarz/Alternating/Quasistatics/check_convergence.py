@@ -5,8 +5,9 @@ import re
 
 from subprocess import Popen
 
+# The log file may be given, for variants of the same problem.
 name = "cuboid"
-log_file_name = name + ".log"
+log_file_name = sys.argv[1] if len(sys.argv) > 1 else name + ".log"
 result = 0
 
 with open(log_file_name, 'r') as log_file:
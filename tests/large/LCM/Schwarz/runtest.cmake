@@ -18,8 +18,7 @@ if(HAD_ERROR)
 endif()
 
 
-EXECUTE_PROCESS(COMMAND python
-                INPUT_FILE ${PY_FILE}
+EXECUTE_PROCESS(COMMAND python ${PY_FILE} ${LOGFILE}
                 RESULT_VARIABLE PY_ERROR)
 if(PY_ERROR)
         message(FATAL_ERROR "Python step failed")
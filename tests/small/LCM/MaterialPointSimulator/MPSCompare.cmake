@@ -0,0 +1,42 @@
+# 1. Run the reference model and the model under test
+
+message("Running the command:")
+message("${TEST_PROG} " " ${REF_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${REF_ARGS}
+                RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+	message(FATAL_ERROR "MPS didn't run the reference: test failed")
+endif()
+
+message("Running the command:")
+message("${TEST_PROG} " " ${TEST_ARGS}")
+
+EXECUTE_PROCESS(COMMAND ${TEST_PROG} ${TEST_ARGS}
+                RESULT_VARIABLE HAD_ERROR)
+
+if(HAD_ERROR)
+	message(FATAL_ERROR "MPS didn't run: test failed")
+endif()
+
+
+# 2. Compare the two outputs with exodiff
+
+if (NOT SEACAS_EXODIFF)
+  message(FATAL_ERROR "Cannot find exodiff")
+endif()
+
+SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${TEST_NAME}.exodiff ${OUTPUT_FILENAME} ${REF_FILENAME})
+
+message("Running the command:")
+message("${EXODIFF_TEST}")
+
+EXECUTE_PROCESS(
+    COMMAND ${EXODIFF_TEST}
+    RESULT_VARIABLE HAD_ERROR)
+
+
+if(HAD_ERROR)
+	message(FATAL_ERROR "Test failed")
+endif()